@@ -0,0 +1,180 @@
+use std::collections::VecDeque;
+use std::fs;
+use std::io;
+use std::path::{Path, PathBuf};
+use std::sync::mpsc;
+use std::sync::Mutex;
+use std::thread;
+use std::time::{Duration, Instant};
+
+use tree_sitter::Parser;
+use tree_sitter_vjass::LANGUAGE;
+
+/// File extensions picked up when walking a directory tree.
+pub const EXTENSIONS: &[&str] = &["j", "vj"];
+
+#[derive(Debug, Clone)]
+pub struct Job {
+    pub path: PathBuf,
+    pub size: u64,
+}
+
+#[derive(Debug, Clone)]
+pub struct Report {
+    pub path: PathBuf,
+    pub bytes: usize,
+    pub elapsed: Duration,
+    pub has_error: bool,
+}
+
+#[derive(Debug, Default, Clone)]
+pub struct Summary {
+    pub files: usize,
+    pub failed: usize,
+    pub bytes: u64,
+    pub wall: Duration,
+    /// Sum of per-file parse times over all workers.
+    pub busy: Duration,
+}
+
+pub fn mb_per_sec(bytes: u64, elapsed: Duration) -> f64 {
+    let secs = elapsed.as_secs_f64();
+    if secs == 0.0 {
+        return 0.0;
+    }
+    bytes as f64 / (1024.0 * 1024.0) / secs
+}
+
+/// Recursively collects every `.j`/`.vj` file under `root`, largest first.
+pub fn collect(root: &Path) -> io::Result<Vec<Job>> {
+    let mut jobs = Vec::new();
+    let mut dirs = vec![root.to_path_buf()];
+
+    while let Some(dir) = dirs.pop() {
+        if !dir.is_dir() {
+            jobs.push(Job {
+                size: fs::metadata(&dir)?.len(),
+                path: dir,
+            });
+            continue;
+        }
+        for entry in fs::read_dir(&dir)? {
+            let entry = entry?;
+            let kind = entry.file_type()?;
+            let path = entry.path();
+            if kind.is_dir() {
+                dirs.push(path);
+            } else if kind.is_file() && has_extension(&path) {
+                jobs.push(Job {
+                    size: entry.metadata()?.len(),
+                    path,
+                });
+            }
+        }
+    }
+
+    jobs.sort_by(|a, b| b.size.cmp(&a.size).then_with(|| a.path.cmp(&b.path)));
+    Ok(jobs)
+}
+
+fn has_extension(path: &Path) -> bool {
+    path.extension()
+        .and_then(|e| e.to_str())
+        .is_some_and(|e| EXTENSIONS.iter().any(|x| e.eq_ignore_ascii_case(x)))
+}
+
+/// One deque per worker. A worker pops from the front of its own deque and,
+/// once it runs dry, steals from the back of the others.
+struct Pool {
+    queues: Vec<Mutex<VecDeque<Job>>>,
+}
+
+impl Pool {
+    /// Deals the (largest-first) jobs round-robin so every worker starts on
+    /// one of the big files and the small ones are left over for stealing.
+    fn new(jobs: Vec<Job>, workers: usize) -> Self {
+        let mut queues: Vec<VecDeque<Job>> = (0..workers).map(|_| VecDeque::new()).collect();
+        for (i, job) in jobs.into_iter().enumerate() {
+            queues[i % workers].push_back(job);
+        }
+        Pool {
+            queues: queues.into_iter().map(Mutex::new).collect(),
+        }
+    }
+
+    fn next(&self, worker: usize) -> Option<Job> {
+        if let Some(job) = self.queues[worker].lock().unwrap().pop_front() {
+            return Some(job);
+        }
+        let n = self.queues.len();
+        (1..n).find_map(|k| self.queues[(worker + k) % n].lock().unwrap().pop_back())
+    }
+}
+
+/// Parses `jobs` on `threads` workers, each owning a single [`Parser`].
+///
+/// `on_report` is called on the calling thread as soon as a file is done.
+pub fn run(jobs: Vec<Job>, threads: usize, mut on_report: impl FnMut(&Report)) -> Summary {
+    let threads = threads.max(1).min(jobs.len().max(1));
+    let pool = Pool::new(jobs, threads);
+    let (tx, rx) = mpsc::channel::<io::Result<Report>>();
+    let start = Instant::now();
+    let mut summary = Summary::default();
+
+    thread::scope(|scope| {
+        for worker in 0..threads {
+            let pool = &pool;
+            let tx = tx.clone();
+            scope.spawn(move || {
+                let mut parser = Parser::new();
+                parser
+                    .set_language(&LANGUAGE.into())
+                    .expect("Error loading Vjass parser");
+
+                while let Some(job) = pool.next(worker) {
+                    let report = match fs::read(&job.path) {
+                        Ok(source) => {
+                            let t = Instant::now();
+                            let tree = parser.parse(&source, None);
+                            Ok(Report {
+                                bytes: source.len(),
+                                elapsed: t.elapsed(),
+                                has_error: tree.map_or(true, |t| t.root_node().has_error()),
+                                path: job.path,
+                            })
+                        }
+                        Err(err) => Err(io::Error::new(
+                            err.kind(),
+                            format!("{}: {err}", job.path.display()),
+                        )),
+                    };
+                    if tx.send(report).is_err() {
+                        return;
+                    }
+                }
+            });
+        }
+        drop(tx);
+
+        for report in rx {
+            match report {
+                Ok(report) => {
+                    summary.files += 1;
+                    summary.bytes += report.bytes as u64;
+                    summary.busy += report.elapsed;
+                    if report.has_error {
+                        summary.failed += 1;
+                    }
+                    on_report(&report);
+                }
+                Err(err) => {
+                    summary.failed += 1;
+                    eprintln!("{err}");
+                }
+            }
+        }
+    });
+
+    summary.wall = start.elapsed();
+    summary
+}
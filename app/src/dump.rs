@@ -0,0 +1,308 @@
+use std::fs;
+use std::io::{self, Write};
+use std::path::Path;
+use std::time::{Duration, Instant};
+
+use tree_sitter::{Parser, Point, Tree, TreeCursor};
+use tree_sitter_vjass::LANGUAGE;
+
+/// How a tree is written out.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Format {
+    /// One indented line per node: `field: kind [row, col] - [row, col]`,
+    /// with the source text of leaves.
+    Text,
+    /// One `to_sexp()`-style line per file: named nodes only.
+    Sexp,
+    /// One JSON object per node and line, in preorder.
+    Json,
+}
+
+impl Format {
+    pub fn from_name(name: &str) -> Option<Self> {
+        match name {
+            "text" => Some(Format::Text),
+            "sexp" => Some(Format::Sexp),
+            "json" | "jsonl" => Some(Format::Json),
+            _ => None,
+        }
+    }
+}
+
+/// A `Write` that counts the bytes that went through it.
+pub struct Counting<W> {
+    pub inner: W,
+    pub bytes: u64,
+}
+
+impl<W: Write> Write for Counting<W> {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        let n = self.inner.write(buf)?;
+        self.bytes += n as u64;
+        Ok(n)
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        self.inner.flush()
+    }
+}
+
+/// What one file's dump cost.
+#[derive(Debug, Default, Clone, Copy)]
+pub struct Dumped {
+    pub bytes: usize,
+    pub nodes: u64,
+    pub max_depth: usize,
+    pub parse: Duration,
+    pub dump: Duration,
+}
+
+/// Parses `path` and writes its tree to `out`.
+///
+/// The tree is walked with a single `TreeCursor` and written as it goes:
+/// no recursion, no per-node `String`s and no `to_sexp()`, so memory is the
+/// source, the tree and the cursor, whatever the size of the output.
+pub fn dump_file(
+    parser: &mut Parser,
+    path: &Path,
+    format: Format,
+    out: &mut impl Write,
+) -> io::Result<Dumped> {
+    let source = fs::read(path)?;
+    let start = Instant::now();
+    let tree = parser
+        .parse(&source, None)
+        .ok_or_else(|| io::Error::other("parse failed"))?;
+    let parse = start.elapsed();
+
+    let start = Instant::now();
+    let (nodes, max_depth) = match format {
+        Format::Text => {
+            out.write_all(path.display().to_string().as_bytes())?;
+            out.write_all(b"\n")?;
+            dump_text(&tree, &source, out)?
+        }
+        Format::Sexp => dump_sexp(&tree, out)?,
+        Format::Json => {
+            out.write_all(b"{\"file\":")?;
+            write_json_string(out, path.display().to_string().as_bytes())?;
+            writeln!(out, ",\"bytes\":{}}}", source.len())?;
+            dump_json(&tree, &source, out)?
+        }
+    };
+    Ok(Dumped {
+        bytes: source.len(),
+        nodes,
+        max_depth,
+        parse,
+        dump: start.elapsed(),
+    })
+}
+
+/// Preorder over every node of `tree`. `enter` sees each node with its depth
+/// and says whether to descend; `leave` sees every entered node once its
+/// children are done. Returns the number of nodes entered and the deepest
+/// depth reached.
+fn walk<'t>(
+    tree: &'t Tree,
+    mut enter: impl FnMut(&TreeCursor<'t>, usize) -> io::Result<bool>,
+    mut leave: impl FnMut(&TreeCursor<'t>, usize) -> io::Result<()>,
+) -> io::Result<(u64, usize)> {
+    let mut cursor = tree.walk();
+    let mut depth = 0;
+    let mut nodes = 0;
+    let mut max_depth = 0;
+    loop {
+        nodes += 1;
+        max_depth = max_depth.max(depth);
+        if enter(&cursor, depth)? && cursor.goto_first_child() {
+            depth += 1;
+            continue;
+        }
+        loop {
+            leave(&cursor, depth)?;
+            if cursor.goto_next_sibling() {
+                break;
+            }
+            if !cursor.goto_parent() {
+                return Ok((nodes, max_depth));
+            }
+            depth -= 1;
+        }
+    }
+}
+
+fn dump_text(tree: &Tree, source: &[u8], out: &mut impl Write) -> io::Result<(u64, usize)> {
+    walk(
+        tree,
+        |cursor, depth| {
+            let node = cursor.node();
+            write_indent(out, depth + 1)?;
+            if let Some(field) = cursor.field_name() {
+                write!(out, "{field}: ")?;
+            }
+            if node.is_missing() {
+                out.write_all(b"MISSING ")?;
+            }
+            if node.is_named() {
+                out.write_all(node.kind().as_bytes())?;
+            } else {
+                write_json_string(out, node.kind().as_bytes())?;
+            }
+            write_range(out, node.start_position(), node.end_position())?;
+            if node.child_count() == 0 && !node.is_missing() {
+                out.write_all(b" ")?;
+                write_json_string(out, &source[node.byte_range()])?;
+            }
+            out.write_all(b"\n")?;
+            Ok(true)
+        },
+        |_, _| Ok(()),
+    )
+}
+
+/// The same text as `Node::to_sexp()`, without building it in memory.
+fn dump_sexp(tree: &Tree, out: &mut impl Write) -> io::Result<(u64, usize)> {
+    let out = std::cell::RefCell::new(out);
+    walk(
+        tree,
+        |cursor, depth| {
+            let node = cursor.node();
+            if !node.is_named() && !node.is_missing() {
+                return Ok(false);
+            }
+            let mut out = out.borrow_mut();
+            if depth > 0 {
+                out.write_all(b" ")?;
+            }
+            if let Some(field) = cursor.field_name() {
+                write!(out, "{field}: ")?;
+            }
+            match (node.is_missing(), node.is_named()) {
+                (true, true) => write!(out, "(MISSING {}", node.kind())?,
+                (true, false) => {
+                    out.write_all(b"(MISSING ")?;
+                    write_json_string(&mut *out, node.kind().as_bytes())?;
+                }
+                _ => write!(out, "({}", node.kind())?,
+            }
+            Ok(true)
+        },
+        |cursor, depth| {
+            let node = cursor.node();
+            if node.is_named() || node.is_missing() {
+                out.borrow_mut()
+                    .write_all(if depth == 0 { b")\n" } else { b")" })?;
+            }
+            Ok(())
+        },
+    )
+}
+
+/// One object per node: its preorder `id`, the `id` of its `parent`, its
+/// kind, field and range, and the source text of leaves.
+fn dump_json(tree: &Tree, source: &[u8], out: &mut impl Write) -> io::Result<(u64, usize)> {
+    // ids[d] is the id of the open node at depth d.
+    let mut ids: Vec<u64> = Vec::new();
+    let mut next_id = 0;
+    walk(
+        tree,
+        |cursor, depth| {
+            let node = cursor.node();
+            ids.truncate(depth);
+            let id = next_id;
+            next_id += 1;
+            match ids.last() {
+                Some(parent) => write!(out, "{{\"id\":{id},\"parent\":{parent}")?,
+                None => write!(out, "{{\"id\":{id},\"parent\":null")?,
+            }
+            ids.push(id);
+            write!(out, ",\"depth\":{depth},\"kind\":")?;
+            write_json_string(out, node.kind().as_bytes())?;
+            write!(out, ",\"named\":{},\"field\":", node.is_named())?;
+            match cursor.field_name() {
+                Some(field) => write!(out, "\"{field}\"")?,
+                None => out.write_all(b"null")?,
+            }
+            let (start, end) = (node.start_position(), node.end_position());
+            write!(
+                out,
+                ",\"start_byte\":{},\"end_byte\":{},\"start\":[{},{}],\"end\":[{},{}]",
+                node.start_byte(),
+                node.end_byte(),
+                start.row,
+                start.column,
+                end.row,
+                end.column
+            )?;
+            if node.is_error() {
+                out.write_all(b",\"error\":true")?;
+            }
+            if node.is_missing() {
+                out.write_all(b",\"missing\":true")?;
+            } else if node.child_count() == 0 {
+                out.write_all(b",\"text\":")?;
+                write_json_string(out, &source[node.byte_range()])?;
+            }
+            out.write_all(b"}\n")?;
+            Ok(true)
+        },
+        |_, _| Ok(()),
+    )
+}
+
+fn write_indent(out: &mut impl Write, depth: usize) -> io::Result<()> {
+    const SPACES: &[u8] = &[b' '; 64];
+    let mut width = depth * 2;
+    while width > 0 {
+        let n = width.min(SPACES.len());
+        out.write_all(&SPACES[..n])?;
+        width -= n;
+    }
+    Ok(())
+}
+
+fn write_range(out: &mut impl Write, start: Point, end: Point) -> io::Result<()> {
+    write!(
+        out,
+        " [{}, {}] - [{}, {}]",
+        start.row, start.column, end.row, end.column
+    )
+}
+
+/// Writes `bytes` as a JSON string; invalid UTF-8 becomes U+FFFD.
+fn write_json_string(out: &mut impl Write, bytes: &[u8]) -> io::Result<()> {
+    let text = String::from_utf8_lossy(bytes);
+    let text = text.as_bytes();
+    out.write_all(b"\"")?;
+    let mut plain = 0;
+    for (i, &c) in text.iter().enumerate() {
+        let escape: &[u8] = match c {
+            b'"' => b"\\\"",
+            b'\\' => b"\\\\",
+            b'\n' => b"\\n",
+            b'\r' => b"\\r",
+            b'\t' => b"\\t",
+            0..=0x1f => b"",
+            _ => continue,
+        };
+        out.write_all(&text[plain..i])?;
+        if escape.is_empty() {
+            write!(out, "\\u{c:04x}")?;
+        } else {
+            out.write_all(escape)?;
+        }
+        plain = i + 1;
+    }
+    out.write_all(&text[plain..])?;
+    out.write_all(b"\"")
+}
+
+/// A parser for `dump_file`.
+pub fn parser() -> Parser {
+    let mut parser = Parser::new();
+    parser
+        .set_language(&LANGUAGE.into())
+        .expect("Error loading Vjass parser");
+    parser
+}
@@ -1,42 +1,229 @@
-use tree_sitter::{Node, Parser};
-use tree_sitter_vjass::LANGUAGE;
-fn main() {
-    let mut parser = Parser::new();
-    let language = LANGUAGE;
-    parser
-        .set_language(&language.into())
-        .expect("Error loading Vjass parser");
+mod driver;
+mod dump;
+mod walk;
 
-    let source_code = r#"[1, 2, {{"a": 3, "b": 4}]"#;
+use std::fs::File;
+use std::io::{self, BufWriter, Write};
+use std::path::Path;
+use std::process::ExitCode;
+use std::time::{Duration, Instant};
 
-    let tree = parser.parse(source_code, None).unwrap();
+const USAGE: &str = "usage: app parse <dir|file>... [--threads N] [--quiet]\n       app walk <file>... [--repeat N]\n       app dump <file>... [--format text|sexp|json] [--output FILE]";
 
-    let root_node = tree.root_node();
+/// Output buffer for `app dump`; the dump streams through it.
+const DUMP_BUFFER: usize = 1 << 16;
 
-    println!("Tree structure:");
-    print_node(root_node, source_code, 0);
-
-    println!("{:?}", tree.root_node().to_sexp());
+fn main() -> ExitCode {
+    let args: Vec<String> = std::env::args().skip(1).collect();
+    match args.first().map(String::as_str) {
+        Some("parse") => parse_files(&args[1..]),
+        Some("walk") => walk_files(&args[1..]),
+        Some("dump") => dump_files(&args[1..]),
+        _ => {
+            eprintln!("{USAGE}");
+            ExitCode::FAILURE
+        }
+    }
 }
 
-fn print_node(node: Node, source: &str, indent: usize) {
-    let indent_str = "  ".repeat(indent);
-    let kind = node.kind();
-    let text = node.utf8_text(source.as_bytes()).unwrap_or("<?>");
-    let pos = node.start_position();
-    
-    
+fn parse_files(args: &[String]) -> ExitCode {
+    let mut roots = Vec::new();
+    let mut threads = std::thread::available_parallelism().map_or(1, |n| n.get());
+    let mut quiet = false;
+
+    let mut it = args.iter();
+    while let Some(arg) = it.next() {
+        match arg.as_str() {
+            "--threads" | "-j" => match it.next().and_then(|n| n.parse().ok()) {
+                Some(n) => threads = n,
+                None => {
+                    eprintln!("{USAGE}");
+                    return ExitCode::FAILURE;
+                }
+            },
+            "--quiet" | "-q" => quiet = true,
+            _ => roots.push(arg),
+        }
+    }
+    if roots.is_empty() {
+        eprintln!("{USAGE}");
+        return ExitCode::FAILURE;
+    }
+
+    let mut jobs = Vec::new();
+    for root in roots {
+        match driver::collect(Path::new(root)) {
+            Ok(found) => jobs.extend(found),
+            Err(err) => {
+                eprintln!("{root}: {err}");
+                return ExitCode::FAILURE;
+            }
+        }
+    }
+    jobs.sort_by(|a, b| b.size.cmp(&a.size));
+
+    let summary = driver::run(jobs, threads, |r| {
+        if !quiet {
+            println!(
+                "{}\t{} B\t{:.3} ms\t{:.2} MB/s{}",
+                r.path.display(),
+                r.bytes,
+                r.elapsed.as_secs_f64() * 1000.0,
+                driver::mb_per_sec(r.bytes as u64, r.elapsed),
+                if r.has_error { "\tERROR" } else { "" }
+            );
+        }
+    });
 
     println!(
-        "{indent_str}{kind} (line {}, column {}): {}",
-        pos.row,
-        pos.column,
-        text.replace("\n", "\\n")
+        "{} files, {} B in {:.3} s on {threads} threads: {:.2} MB/s wall, {:.2} MB/s per thread, {} with errors",
+        summary.files,
+        summary.bytes,
+        summary.wall.as_secs_f64(),
+        driver::mb_per_sec(summary.bytes, summary.wall),
+        driver::mb_per_sec(summary.bytes, summary.busy),
+        summary.failed
     );
 
-    for i in 0..node.child_count() {
-        if let Some(child) = node.child(i) {
-            print_node(child, source, indent + 1);
+    if summary.failed == 0 {
+        ExitCode::SUCCESS
+    } else {
+        ExitCode::FAILURE
+    }
+}
+
+fn walk_files(args: &[String]) -> ExitCode {
+    let mut paths = Vec::new();
+    let mut repeat = 3;
+
+    let mut it = args.iter();
+    while let Some(arg) = it.next() {
+        match arg.as_str() {
+            "--repeat" | "-r" => match it.next().and_then(|n| n.parse().ok()) {
+                Some(n) => repeat = n,
+                None => {
+                    eprintln!("{USAGE}");
+                    return ExitCode::FAILURE;
+                }
+            },
+            _ => paths.push(arg),
         }
     }
+    if paths.is_empty() {
+        eprintln!("{USAGE}");
+        return ExitCode::FAILURE;
+    }
+
+    let mut ok = true;
+    for path in paths {
+        ok &= walk::bench(Path::new(path), repeat);
+    }
+    if ok {
+        ExitCode::SUCCESS
+    } else {
+        ExitCode::FAILURE
+    }
+}
+
+fn dump_files(args: &[String]) -> ExitCode {
+    let mut paths = Vec::new();
+    let mut format = dump::Format::Text;
+    let mut output = None;
+
+    let mut it = args.iter();
+    while let Some(arg) = it.next() {
+        match arg.as_str() {
+            "--format" | "-f" => match it.next().and_then(|name| dump::Format::from_name(name)) {
+                Some(f) => format = f,
+                None => {
+                    eprintln!("{USAGE}");
+                    return ExitCode::FAILURE;
+                }
+            },
+            "--output" | "-o" => match it.next() {
+                Some(path) => output = Some(path),
+                None => {
+                    eprintln!("{USAGE}");
+                    return ExitCode::FAILURE;
+                }
+            },
+            _ => paths.push(arg),
+        }
+    }
+    if paths.is_empty() {
+        eprintln!("{USAGE}");
+        return ExitCode::FAILURE;
+    }
+
+    let sink: Box<dyn Write> = match output {
+        Some(path) => match File::create(path) {
+            Ok(file) => Box::new(file),
+            Err(err) => {
+                eprintln!("{path}: {err}");
+                return ExitCode::FAILURE;
+            }
+        },
+        None => Box::new(io::stdout().lock()),
+    };
+    let mut out = dump::Counting {
+        inner: BufWriter::with_capacity(DUMP_BUFFER, sink),
+        bytes: 0,
+    };
+
+    // The report goes to stderr, so stdout holds nothing but the dump.
+    let mut parser = dump::parser();
+    let mut ok = true;
+    let (mut files, mut bytes, mut nodes) = (0, 0u64, 0u64);
+    let (mut parse, mut dumping) = (Duration::ZERO, Duration::ZERO);
+    let wall = Instant::now();
+    for path in paths {
+        let written = out.bytes;
+        match dump::dump_file(&mut parser, Path::new(path), format, &mut out) {
+            Ok(d) => {
+                eprintln!(
+                    "{path}\t{} B\t{} nodes\tdepth {}\tparse {:.3} ms\tdump {:.3} ms\t{:.2} MB/s\t{:.2} ns/node\t{} B out",
+                    d.bytes,
+                    d.nodes,
+                    d.max_depth,
+                    d.parse.as_secs_f64() * 1000.0,
+                    d.dump.as_secs_f64() * 1000.0,
+                    driver::mb_per_sec(d.bytes as u64, d.dump),
+                    d.dump.as_secs_f64() * 1e9 / d.nodes.max(1) as f64,
+                    out.bytes - written
+                );
+                files += 1;
+                bytes += d.bytes as u64;
+                nodes += d.nodes;
+                parse += d.parse;
+                dumping += d.dump;
+            }
+            // `app dump big.j | head` is not an error.
+            Err(err) if err.kind() == io::ErrorKind::BrokenPipe => return ExitCode::SUCCESS,
+            Err(err) => {
+                eprintln!("{path}: {err}");
+                ok = false;
+            }
+        }
+    }
+    match out.flush() {
+        Ok(()) => {}
+        Err(err) if err.kind() == io::ErrorKind::BrokenPipe => return ExitCode::SUCCESS,
+        Err(err) => {
+            eprintln!("{err}");
+            return ExitCode::FAILURE;
+        }
+    }
+
+    eprintln!(
+        "{files} files, {bytes} B, {nodes} nodes in {:.3} s: parse {:.2} MB/s, dump {:.2} MB/s, {} B out",
+        wall.elapsed().as_secs_f64(),
+        driver::mb_per_sec(bytes, parse),
+        driver::mb_per_sec(bytes, dumping),
+        out.bytes
+    );
+    if ok {
+        ExitCode::SUCCESS
+    } else {
+        ExitCode::FAILURE
+    }
 }
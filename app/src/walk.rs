@@ -0,0 +1,165 @@
+use std::fs;
+use std::path::Path;
+use std::time::{Duration, Instant};
+
+use tree_sitter::{Node, Parser, Tree};
+use tree_sitter_vjass::table::{NodeTable, NODE_NAMED, NONE};
+use tree_sitter_vjass::LANGUAGE;
+
+/// What every walk computes, so the walks can be checked against each other
+/// and none of them is optimised away.
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct Visit {
+    pub nodes: u64,
+    pub named: u64,
+    /// Sum of `kind_id * (end_byte - start_byte)` over all nodes.
+    pub checksum: u64,
+}
+
+impl Visit {
+    fn add(&mut self, kind_id: u16, named: bool, start: usize, end: usize) {
+        self.nodes += 1;
+        self.named += named as u64;
+        self.checksum = self
+            .checksum
+            .wrapping_add(u64::from(kind_id) * (end - start) as u64);
+    }
+}
+
+/// Preorder through `Node::child(i)`, the way downstream analysers do it.
+/// `child(i)` is O(i), so this is quadratic in the number of children.
+pub fn walk_nodes(tree: &Tree) -> Visit {
+    let mut visit = Visit::default();
+    let mut stack: Vec<Node> = vec![tree.root_node()];
+    while let Some(node) = stack.pop() {
+        visit.add(
+            node.kind_id(),
+            node.is_named(),
+            node.start_byte(),
+            node.end_byte(),
+        );
+        for i in (0..node.child_count()).rev() {
+            if let Some(child) = node.child(i) {
+                stack.push(child);
+            }
+        }
+    }
+    visit
+}
+
+/// Preorder through a `TreeCursor`.
+pub fn walk_cursor(tree: &Tree) -> Visit {
+    let mut visit = Visit::default();
+    let mut cursor = tree.walk();
+    loop {
+        let node = cursor.node();
+        visit.add(
+            node.kind_id(),
+            node.is_named(),
+            node.start_byte(),
+            node.end_byte(),
+        );
+        if cursor.goto_first_child() {
+            continue;
+        }
+        while !cursor.goto_next_sibling() {
+            if !cursor.goto_parent() {
+                return visit;
+            }
+        }
+    }
+}
+
+/// Preorder through the `first_child` / `next_sibling` links of a table.
+pub fn walk_links(table: &NodeTable) -> Visit {
+    let mut visit = Visit::default();
+    let mut stack = vec![0u32];
+    while let Some(mut node) = stack.pop() {
+        // Follow the first-child chain, leaving siblings for later.
+        while node != NONE {
+            let i = node as usize;
+            visit.add(
+                table.symbol[i],
+                table.flags[i] & NODE_NAMED != 0,
+                table.start_byte[i] as usize,
+                table.end_byte[i] as usize,
+            );
+            if table.next_sibling[i] != NONE {
+                stack.push(table.next_sibling[i]);
+            }
+            node = table.first_child[i];
+        }
+    }
+    visit
+}
+
+/// The same visit as a linear scan; valid because the table is in preorder.
+pub fn walk_scan(table: &NodeTable) -> Visit {
+    let mut visit = Visit::default();
+    for i in 0..table.len() {
+        visit.add(
+            table.symbol[i],
+            table.flags[i] & NODE_NAMED != 0,
+            table.start_byte[i] as usize,
+            table.end_byte[i] as usize,
+        );
+    }
+    visit
+}
+
+fn best<T>(repeat: usize, mut f: impl FnMut() -> T) -> (Duration, T) {
+    let mut best = Duration::MAX;
+    let mut result = None;
+    for _ in 0..repeat.max(1) {
+        let start = Instant::now();
+        let value = f();
+        best = best.min(start.elapsed());
+        result = Some(value);
+    }
+    (best, result.unwrap())
+}
+
+/// Times every walk over `path` and prints one row per walk. Returns false
+/// if the file could not be read or parsed, or the walks disagree.
+pub fn bench(path: &Path, repeat: usize) -> bool {
+    let source = match fs::read(path) {
+        Ok(source) => source,
+        Err(err) => {
+            eprintln!("{}: {err}", path.display());
+            return false;
+        }
+    };
+    let mut parser = Parser::new();
+    parser
+        .set_language(&LANGUAGE.into())
+        .expect("Error loading Vjass parser");
+    let Some(tree) = parser.parse(&source, None) else {
+        eprintln!("{}: parse failed", path.display());
+        return false;
+    };
+
+    let (build, table) = best(repeat, || NodeTable::from_tree(&tree));
+    let (cursor_time, expected) = best(repeat, || walk_cursor(&tree));
+    let rows = [
+        ("node.child(i)", best(repeat, || walk_nodes(&tree))),
+        ("cursor", (cursor_time, expected)),
+        ("table build", (build, walk_scan(&table))),
+        ("table links", best(repeat, || walk_links(&table))),
+        ("table scan", best(repeat, || walk_scan(&table))),
+    ];
+
+    let mut same = true;
+    for (name, (elapsed, visit)) in rows {
+        let ns = elapsed.as_secs_f64() * 1e9 / expected.nodes.max(1) as f64;
+        println!(
+            "{}\t{name}\t{} nodes\t{:.3} ms\t{ns:.2} ns/node\t{:.2}x cursor{}",
+            path.display(),
+            visit.nodes,
+            elapsed.as_secs_f64() * 1000.0,
+            cursor_time.as_secs_f64() / elapsed.as_secs_f64(),
+            if visit == expected { "" } else { "\tMISMATCH" }
+        );
+        same &= visit == expected;
+    }
+    same
+}
@@ -0,0 +1,159 @@
+// Event-loop stall and throughput of the Node async parse API.
+//
+//   node bench/async.js [--concurrency 4,8,16] [--repeat N] PATH...
+//
+// Parses every file (PATH is a file or a directory of *.j files) with
+// parseFiles() once per concurrency and reports wall time, MB/s and how
+// long the event loop stalled meanwhile (max and p99 delay, from
+// perf_hooks.monitorEventLoopDelay). When the `tree-sitter` package is
+// installed, a synchronous Parser.parse() loop on the main thread is timed
+// first for comparison: its stall is the length of the longest parse.
+//
+// The libuv pool is sized to the largest concurrency unless
+// UV_THREADPOOL_SIZE is already set. Needs the addon built with the runtime
+// sources (see binding.gyp).
+
+"use strict";
+
+const fs = require("node:fs");
+const path = require("node:path");
+const { monitorEventLoopDelay, performance } = require("node:perf_hooks");
+
+function usage() {
+  console.error("usage: node bench/async.js [--concurrency 4,8,16] [--repeat N] PATH...");
+  process.exit(2);
+}
+
+let concurrencies = [4, 8, 16];
+let repeat = 3;
+const roots = [];
+for (let i = 2; i < process.argv.length; i++) {
+  const arg = process.argv[i];
+  if (arg === "--concurrency") {
+    concurrencies = (process.argv[++i] || "").split(",").map(Number);
+    if (concurrencies.some((n) => !Number.isInteger(n) || n < 1)) usage();
+  } else if (arg === "--repeat") {
+    repeat = Number(process.argv[++i]);
+    if (!Number.isInteger(repeat) || repeat < 1) usage();
+  } else if (arg.startsWith("--")) {
+    usage();
+  } else {
+    roots.push(arg);
+  }
+}
+if (roots.length === 0) usage();
+
+// Must happen before anything queues work on the pool.
+process.env.UV_THREADPOOL_SIZE ||= String(Math.max(...concurrencies));
+
+const vjass = require("..");
+if (!vjass.parseFiles) {
+  console.error("bench/async.js: the addon was built without the runtime sources");
+  process.exit(1);
+}
+
+const paths = [];
+for (const root of roots) {
+  if (fs.statSync(root).isDirectory()) {
+    const names = fs.readdirSync(root).filter((name) => name.endsWith(".j")).sort();
+    paths.push(...names.map((name) => path.join(root, name)));
+  } else {
+    paths.push(root);
+  }
+}
+const bytes = paths.reduce((sum, p) => sum + fs.statSync(p).size, 0);
+const mb = bytes / (1024 * 1024);
+
+// Runs `body` `repeat` times while sampling the event loop; keeps the
+// fastest run.
+async function measure(body) {
+  let best;
+  for (let r = 0; r < repeat; r++) {
+    const histogram = monitorEventLoopDelay({ resolution: 1 });
+    histogram.enable();
+    const start = performance.now();
+    const failures = await body();
+    const ms = performance.now() - start;
+    // Let the monitor record the delay of the last blocking stretch.
+    await new Promise((resolve) => setTimeout(resolve, 5));
+    histogram.disable();
+    const run = { ms, failures, maxMs: histogram.max / 1e6, p99Ms: histogram.percentile(99) / 1e6 };
+    if (!best || run.ms < best.ms) best = run;
+  }
+  return best;
+}
+
+function print(mode, concurrency, run) {
+  console.log(
+    [
+      mode.padEnd(12),
+      String(concurrency).padStart(11),
+      String(paths.length).padStart(8),
+      mb.toFixed(2).padStart(10),
+      run.ms.toFixed(1).padStart(10),
+      (mb / (run.ms / 1000)).toFixed(2).padStart(10),
+      run.maxMs.toFixed(2).padStart(12),
+      run.p99Ms.toFixed(2).padStart(12),
+    ].join(" "),
+  );
+}
+
+async function main() {
+  console.log(
+    [
+      "mode".padEnd(12),
+      "concurrency".padStart(11),
+      "files".padStart(8),
+      "MB".padStart(10),
+      "ms".padStart(10),
+      "MB/s".padStart(10),
+      "stall max ms".padStart(12),
+      "stall p99 ms".padStart(12),
+    ].join(" "),
+  );
+
+  let failures = 0;
+  let Parser = null;
+  try {
+    Parser = require("tree-sitter");
+  } catch (_) {}
+  if (Parser) {
+    const parser = new Parser();
+    parser.setLanguage(vjass);
+    const run = await measure(async () => {
+      for (const p of paths) parser.parse(fs.readFileSync(p, "utf8"));
+      return 0;
+    });
+    print("sync", 1, run);
+  }
+
+  for (const concurrency of concurrencies) {
+    const run = await measure(async () => {
+      const results = await vjass.parseFiles(paths, { concurrency });
+      return results.filter((result) => result.error).length;
+    });
+    failures += run.failures;
+    print("parseFiles", concurrency, run);
+  }
+
+  // The same number of parseBuffer() calls kept in flight at once.
+  const sources = paths.map((p) => fs.readFileSync(p));
+  for (const concurrency of concurrencies) {
+    const run = await measure(async () => {
+      let next = 0;
+      const lane = async () => {
+        while (next < sources.length) await vjass.parseBuffer(sources[next++]);
+      };
+      await Promise.all(Array.from({ length: concurrency }, lane));
+      return 0;
+    });
+    print("parseBuffer", concurrency, run);
+  }
+
+  if (failures > 0) {
+    console.error(`bench/async.js: ${failures} files could not be read or parsed`);
+    process.exitCode = 1;
+  }
+}
+
+main();
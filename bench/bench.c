@@ -0,0 +1,236 @@
+// Parse throughput harness.
+//
+//   vjass-bench [--repeat N] [--versions] [--mmap] [--arena] [--outline] FILE...
+//
+// Every file is read into memory and parsed N times with a fresh tree each
+// time. Reports bytes/s, node count, tree depth, nodes/s, allocator calls,
+// bytes and peak live bytes per parse (tree-sitter-vjass-stats.h), and the
+// process peak RSS after the file.
+//
+// With --mmap, files are mapped with tree_sitter_vjass_map_file() and parsed
+// through its chunked TSInput instead of being read into a buffer first;
+// compare the RSS column of two separate runs, since peak RSS is per process.
+//
+// With --arena, the runtime allocates through the recycling arena from
+// tree-sitter-vjass-arena.h. "allocs" counts calls into the allocator hooks
+// and "sys allocs" the ones that actually reached malloc; run a small file
+// with a large --repeat to see the difference on a reused parser.
+//
+// With --outline, files are parsed with tree_sitter_vjass_outline(), which
+// leaves function bodies unparsed.
+//
+// With --versions, one extra (untimed) parse runs with a logger attached and
+// the maximum and average number of GLR stack versions the parser had to
+// process are reported. A deterministic grammar stays at 1.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include <tree_sitter/api.h>
+#define TREE_SITTER_VJASS_ARENA_IMPLEMENTATION
+#include <tree_sitter/tree-sitter-vjass-arena.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#define TREE_SITTER_VJASS_STATS_IMPLEMENTATION
+#include <tree_sitter/tree-sitter-vjass-stats.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+typedef struct {
+  uint64_t steps;
+  uint64_t sum;
+  unsigned max;
+} VersionStats;
+
+// The parser logs "process version:%u, version_count:%u, ..." once per
+// version per token.
+static void version_logger(void *payload, TSLogType type, const char *message) {
+  VersionStats *stats = payload;
+  if (type != TSLogTypeParse || strncmp(message, "process version:", 16) != 0) return;
+  const char *count = strstr(message, "version_count:");
+  if (!count) return;
+  unsigned versions = (unsigned)strtoul(count + 14, NULL, 10);
+  stats->steps++;
+  stats->sum += versions;
+  if (versions > stats->max) stats->max = versions;
+}
+
+static VersionStats count_versions(TSParser *parser, const char *source, size_t length) {
+  VersionStats stats = {0, 0, 0};
+  ts_parser_set_logger(parser, (TSLogger){&stats, version_logger});
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+  ts_parser_set_logger(parser, (TSLogger){NULL, NULL});
+  ts_tree_delete(tree);
+  return stats;
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static double peak_rss_mb(void) {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return (double)usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+  return (double)usage.ru_maxrss / 1024.0;
+#endif
+}
+
+static char *read_file(const char *path, size_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *data = size >= 0 ? malloc((size_t)size + 1) : NULL;
+  if (data && fread(data, 1, (size_t)size, file) != (size_t)size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  if (data) *length = (size_t)size;
+  return data;
+}
+
+typedef struct {
+  uint64_t nodes;
+  unsigned depth;
+} TreeStats;
+
+static TreeStats tree_stats(TSTree *tree) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  TreeStats stats = {1, 0};
+  unsigned depth = 0;
+  for (;;) {
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      if (++depth > stats.depth) stats.depth = depth;
+      stats.nodes++;
+      continue;
+    }
+    if (ts_tree_cursor_goto_next_sibling(&cursor)) {
+      stats.nodes++;
+      continue;
+    }
+    bool found = false;
+    while (ts_tree_cursor_goto_parent(&cursor)) {
+      depth--;
+      if (ts_tree_cursor_goto_next_sibling(&cursor)) {
+        stats.nodes++;
+        found = true;
+        break;
+      }
+    }
+    if (!found) break;
+  }
+  ts_tree_cursor_delete(&cursor);
+  return stats;
+}
+
+int main(int argc, char **argv) {
+  unsigned repeat = 5;
+  bool versions = false;
+  bool use_mmap = false;
+  bool use_arena = false;
+  bool use_outline = false;
+  int first = 1;
+  for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+    if (strcmp(argv[first], "--repeat") == 0 && first + 1 < argc) {
+      repeat = (unsigned)atoi(argv[++first]);
+    } else if (strcmp(argv[first], "--versions") == 0) {
+      versions = true;
+    } else if (strcmp(argv[first], "--mmap") == 0) {
+      use_mmap = true;
+    } else if (strcmp(argv[first], "--arena") == 0) {
+      use_arena = true;
+    } else if (strcmp(argv[first], "--outline") == 0) {
+      use_outline = true;
+    } else {
+      repeat = 0;
+      break;
+    }
+  }
+  if (first >= argc || repeat == 0) {
+    fprintf(stderr, "usage: vjass-bench [--repeat N] [--versions] [--mmap] [--arena] [--outline] FILE...\n");
+    return 2;
+  }
+
+  const TSLanguage *language = use_outline ? tree_sitter_vjass_outline() : tree_sitter_vjass();
+
+  TSVjassStatsBackend arena = {tree_sitter_vjass_arena_malloc, tree_sitter_vjass_arena_realloc,
+                               tree_sitter_vjass_arena_free};
+  tree_sitter_vjass_stats_install_over(use_arena ? &arena : NULL);
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+
+  printf("%-32s %12s %10s %10s %12s %6s %10s %12s %12s %12s %10s %10s %6s", "file", "bytes", "ms", "MB/s", "nodes",
+         "depth", "Mnodes/s", "allocs", "sys allocs", "alloc MB", "peak MB", "RSS MB", "error");
+  if (versions) printf(" %8s %8s", "max ver", "avg ver");
+  printf("\n");
+
+  int status = 0;
+  for (int i = first; i < argc; i++) {
+    size_t length = 0;
+    char *source = NULL;
+    TSVjassMappedFile mapped;
+    bool loaded = use_mmap ? tree_sitter_vjass_map_file(&mapped, argv[i])
+                           : (source = read_file(argv[i], &length)) != NULL;
+    if (!loaded) {
+      perror(argv[i]);
+      status = 1;
+      continue;
+    }
+    if (use_mmap) length = mapped.length;
+
+    double elapsed = 0;
+    TreeStats stats = {0, 0};
+    bool has_error = false;
+    uint64_t allocations = 0, system_allocs = 0, bytes = 0;
+    int64_t peak = 0;
+
+    for (unsigned r = 0; r < repeat; r++) {
+      tree_sitter_vjass_stats_reset();
+      uint64_t arena_allocs = tree_sitter_vjass_arena_stats().system_allocs;
+      double start = now();
+      TSTree *tree = use_mmap ? ts_parser_parse(parser, NULL, tree_sitter_vjass_mapped_input(&mapped))
+                              : ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+      elapsed += now() - start;
+      TSVjassAllocStats alloc = tree_sitter_vjass_stats();
+      allocations += alloc.allocations;
+      bytes += alloc.bytes;
+      if (alloc.peak_live_bytes > peak) peak = alloc.peak_live_bytes;
+      system_allocs += use_arena ? tree_sitter_vjass_arena_stats().system_allocs - arena_allocs : alloc.allocations;
+
+      stats = tree_stats(tree);
+      has_error = ts_node_has_error(ts_tree_root_node(tree));
+      ts_tree_delete(tree);
+    }
+
+    double seconds = elapsed / repeat;
+    printf("%-32s %12zu %10.3f %10.2f %12llu %6u %10.2f %12llu %12llu %12.2f %10.2f %10.1f %6s", argv[i], length,
+           seconds * 1e3, (double)length / (1024.0 * 1024.0) / seconds, (unsigned long long)stats.nodes,
+           stats.depth, (double)stats.nodes / 1e6 / seconds, (unsigned long long)(allocations / repeat),
+           (unsigned long long)(system_allocs / repeat), (double)bytes / repeat / (1024.0 * 1024.0),
+           (double)peak / (1024.0 * 1024.0), peak_rss_mb(), has_error ? "yes" : "no");
+    if (versions) {
+      VersionStats v = count_versions(parser, use_mmap ? mapped.data : source, length);
+      printf(" %8u %8.3f", v.max, v.steps ? (double)v.sum / (double)v.steps : 0.0);
+    }
+    printf("\n");
+    fflush(stdout);
+    if (use_mmap) tree_sitter_vjass_unmap_file(&mapped);
+    free(source);
+  }
+
+  ts_parser_delete(parser);
+  return status;
+}
@@ -0,0 +1,241 @@
+// Parse cache startup harness.
+//
+//   vjass-cache-bench --cache DIR [--repeat N] PATH...
+//
+// Loads a workspace the way an indexer starts up: every file (PATH is a
+// file or a directory of *.j files) is read and turned into a node table,
+// in three phases:
+//
+//   parse  parse and flatten every file, no cache
+//   cold   the same through tree_sitter_vjass_cached_parse() on an empty
+//          cache: hash, miss, parse, flatten, store
+//   warm   the same again with every entry present: hash and load
+//
+// Reports wall time, files/s and source MB/s per phase, the hit count, and
+// the size of the cache the cold phase wrote. The cold phase empties DIR of
+// *.vjt entries first. Warm and parse report the best of --repeat runs.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-cache.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+typedef struct {
+  char **paths;
+  size_t count;
+  size_t capacity;
+} Paths;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static char *read_file(const char *path, size_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  char *data = size >= 0 ? malloc((size_t)size + 1) : NULL;
+  if (data && fread(data, 1, (size_t)size, file) != (size_t)size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  if (data) *length = (size_t)size;
+  return data;
+}
+
+static bool has_suffix(const char *name, const char *suffix) {
+  size_t length = strlen(name), suffix_length = strlen(suffix);
+  return length >= suffix_length && strcmp(name + length - suffix_length, suffix) == 0;
+}
+
+static void add_path(Paths *paths, const char *dir, const char *name) {
+  if (paths->count == paths->capacity) {
+    paths->capacity = paths->capacity ? paths->capacity * 2 : 256;
+    paths->paths = realloc(paths->paths, paths->capacity * sizeof(char *));
+  }
+  size_t length = (dir ? strlen(dir) + 1 : 0) + strlen(name) + 1;
+  char *path = malloc(length);
+  if (dir) {
+    snprintf(path, length, "%s/%s", dir, name);
+  } else {
+    snprintf(path, length, "%s", name);
+  }
+  paths->paths[paths->count++] = path;
+}
+
+static int compare_paths(const void *a, const void *b) {
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Adds `path`, or the *.j files in it when it is a directory, sorted.
+static bool collect(Paths *paths, const char *path) {
+  struct stat st;
+  if (stat(path, &st) != 0) return false;
+  if (!S_ISDIR(st.st_mode)) {
+    add_path(paths, NULL, path);
+    return true;
+  }
+  DIR *dir = opendir(path);
+  if (!dir) return false;
+  size_t first = paths->count;
+  for (struct dirent *entry; (entry = readdir(dir)) != NULL;) {
+    if (has_suffix(entry->d_name, ".j")) add_path(paths, path, entry->d_name);
+  }
+  closedir(dir);
+  qsort(paths->paths + first, paths->count - first, sizeof(char *), compare_paths);
+  return true;
+}
+
+// Sums the size of the *.vjt entries in `dir`, removing them if asked to.
+static uint64_t cache_bytes(const char *dir, bool remove_entries) {
+  uint64_t bytes = 0;
+  DIR *handle = opendir(dir);
+  if (!handle) return 0;
+  for (struct dirent *entry; (entry = readdir(handle)) != NULL;) {
+    if (!has_suffix(entry->d_name, ".vjt")) continue;
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+    struct stat st;
+    if (stat(path, &st) == 0) bytes += (uint64_t)st.st_size;
+    if (remove_entries) remove(path);
+  }
+  closedir(handle);
+  return bytes;
+}
+
+typedef enum { PHASE_PARSE, PHASE_COLD, PHASE_WARM } Phase;
+
+typedef struct {
+  double seconds;
+  uint64_t bytes;
+  uint64_t nodes;
+  size_t hits;
+  size_t failures;
+} PhaseResult;
+
+static PhaseResult run_phase(Phase phase, TSParser *parser, const char *cache_dir, const Paths *paths) {
+  PhaseResult result = {0, 0, 0, 0, 0};
+  double start = now();
+  for (size_t i = 0; i < paths->count; i++) {
+    size_t length = 0;
+    char *source = read_file(paths->paths[i], &length);
+    if (!source) {
+      result.failures++;
+      continue;
+    }
+    TSVjassNodeTable table;
+    bool hit = false, ok;
+    if (phase == PHASE_PARSE) {
+      TSTree *tree = ts_parser_parse_string(parser, NULL, source, (uint32_t)length);
+      ok = tree && tree_sitter_vjass_node_table_build(tree, &table);
+      ts_tree_delete(tree);
+    } else {
+      ok = tree_sitter_vjass_cached_parse(parser, cache_dir, source, (uint32_t)length, &table, &hit);
+    }
+    if (ok) {
+      result.nodes += table.count;
+      tree_sitter_vjass_node_table_delete(&table);
+    } else {
+      result.failures++;
+    }
+    result.hits += hit;
+    result.bytes += length;
+    free(source);
+  }
+  result.seconds = now() - start;
+  return result;
+}
+
+static void print_phase(const char *name, const PhaseResult *r, size_t files, uint64_t cache_size) {
+  printf("%-6s %8zu %10.2f %10.1f %10.0f %10.2f %12llu %8zu %10.2f\n", name, files,
+         (double)r->bytes / (1024.0 * 1024.0), r->seconds * 1e3, (double)files / r->seconds,
+         (double)r->bytes / (1024.0 * 1024.0) / r->seconds, (unsigned long long)r->nodes, r->hits,
+         (double)cache_size / (1024.0 * 1024.0));
+}
+
+static int usage(void) {
+  fprintf(stderr, "usage: vjass-cache-bench --cache DIR [--repeat N] PATH...\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  const char *cache_dir = NULL;
+  unsigned repeat = 3;
+  int first = 1;
+  for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+    const char *value = first + 1 < argc ? argv[first + 1] : NULL;
+    if (!value) return usage();
+    if (strcmp(argv[first], "--cache") == 0) {
+      cache_dir = value;
+    } else if (strcmp(argv[first], "--repeat") == 0) {
+      repeat = (unsigned)atoi(value);
+    } else {
+      return usage();
+    }
+    first++;
+  }
+  if (first >= argc || !cache_dir || repeat == 0) return usage();
+  if (mkdir(cache_dir, 0777) != 0 && errno != EEXIST) {
+    perror(cache_dir);
+    return 1;
+  }
+
+  Paths paths = {NULL, 0, 0};
+  for (int i = first; i < argc; i++) {
+    if (!collect(&paths, argv[i])) {
+      perror(argv[i]);
+      return 1;
+    }
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vjass());
+
+  printf("%-6s %8s %10s %10s %10s %10s %12s %8s %10s\n", "phase", "files", "MB", "ms", "files/s", "MB/s", "nodes",
+         "hits", "cache MB");
+
+  PhaseResult parse = {0, 0, 0, 0, 0};
+  for (unsigned r = 0; r < repeat; r++) {
+    PhaseResult result = run_phase(PHASE_PARSE, parser, cache_dir, &paths);
+    if (r == 0 || result.seconds < parse.seconds) parse = result;
+  }
+  print_phase("parse", &parse, paths.count, 0);
+
+  cache_bytes(cache_dir, true);
+  PhaseResult cold = run_phase(PHASE_COLD, parser, cache_dir, &paths);
+  print_phase("cold", &cold, paths.count, cache_bytes(cache_dir, false));
+
+  PhaseResult warm = {0, 0, 0, 0, 0};
+  for (unsigned r = 0; r < repeat; r++) {
+    PhaseResult result = run_phase(PHASE_WARM, parser, cache_dir, &paths);
+    if (r == 0 || result.seconds < warm.seconds) warm = result;
+  }
+  print_phase("warm", &warm, paths.count, 0);
+  printf("warm/parse speedup %.2fx\n", parse.seconds / warm.seconds);
+
+  ts_parser_delete(parser);
+  for (size_t i = 0; i < paths.count; i++) free(paths.paths[i]);
+  free(paths.paths);
+
+  size_t failures = parse.failures + cold.failures + warm.failures;
+  bool all_hit = warm.hits == paths.count;
+  if (failures > 0) fprintf(stderr, "vjass-cache-bench: %zu files could not be read or parsed\n", failures);
+  if (!all_hit) fprintf(stderr, "vjass-cache-bench: only %zu of %zu warm lookups hit\n", warm.hits, paths.count);
+  return failures == 0 && all_hit ? 0 : 1;
+}
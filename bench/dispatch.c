@@ -0,0 +1,212 @@
+// Node kind dispatch harness: ts_node_type() strings against symbol ids.
+//
+//   vjass-dispatch-bench [--repeat N] FILE...
+//
+// Parses every file once, then walks the tree with a TSTreeCursor and sorts
+// every node into one of a handful of kinds, as a visitor does, in three
+// ways; reports the best of --repeat runs of each:
+//
+//   walk         the cursor walk alone, for reference
+//   strcmp       an if / else if chain of strcmp(ts_node_type(node), ...)
+//   switch       a switch on ts_node_symbol(node) over the
+//                TREE_SITTER_VJASS_SYM_* constants
+//
+// The ns/node column includes the walk; subtract the walk row for the cost
+// of the dispatch itself. Both dispatches must count the same nodes per
+// kind; a mismatch fails the run.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#include <tree_sitter/tree-sitter-vjass-symbols.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+typedef enum {
+  KIND_PROGRAM,
+  KIND_STRUCT,
+  KIND_GLOBALS,
+  KIND_LOOP,
+  KIND_EXPR,
+  KIND_VAR_STMT,
+  KIND_STRING,
+  KIND_SET_STATEMENT,
+  KIND_CALL_STATEMENT,
+  KIND_FUNCTION,
+  KIND_FUNCTION_CALL,
+  KIND_COMMENT,
+  KIND_ID,
+  KIND_OTHER,
+  KIND_COUNT
+} Kind;
+
+typedef struct {
+  uint64_t counts[KIND_COUNT];
+} Visit;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// In grammar order, but with the most frequent kind, id, last, so it pays
+// for every compare.
+static Kind kind_of_type(const char *type) {
+  if (strcmp(type, "program") == 0) return KIND_PROGRAM;
+  if (strcmp(type, "struct") == 0) return KIND_STRUCT;
+  if (strcmp(type, "globals") == 0) return KIND_GLOBALS;
+  if (strcmp(type, "loop") == 0) return KIND_LOOP;
+  if (strcmp(type, "expr") == 0) return KIND_EXPR;
+  if (strcmp(type, "var_stmt") == 0) return KIND_VAR_STMT;
+  if (strcmp(type, "string") == 0) return KIND_STRING;
+  if (strcmp(type, "set_statement") == 0) return KIND_SET_STATEMENT;
+  if (strcmp(type, "call_statement") == 0) return KIND_CALL_STATEMENT;
+  if (strcmp(type, "function") == 0) return KIND_FUNCTION;
+  if (strcmp(type, "function_call") == 0) return KIND_FUNCTION_CALL;
+  if (strcmp(type, "comment") == 0) return KIND_COMMENT;
+  if (strcmp(type, "id") == 0) return KIND_ID;
+  return KIND_OTHER;
+}
+
+static Kind kind_of_symbol(TSSymbol symbol) {
+  switch (symbol) {
+    case TREE_SITTER_VJASS_SYM_PROGRAM:
+      return KIND_PROGRAM;
+    case TREE_SITTER_VJASS_SYM_STRUCT:
+      return KIND_STRUCT;
+    case TREE_SITTER_VJASS_SYM_GLOBALS:
+      return KIND_GLOBALS;
+    case TREE_SITTER_VJASS_SYM_LOOP:
+      return KIND_LOOP;
+    case TREE_SITTER_VJASS_SYM_EXPR:
+      return KIND_EXPR;
+    case TREE_SITTER_VJASS_SYM_VAR_STMT:
+      return KIND_VAR_STMT;
+    case TREE_SITTER_VJASS_SYM_STRING:
+      return KIND_STRING;
+    case TREE_SITTER_VJASS_SYM_SET_STATEMENT:
+      return KIND_SET_STATEMENT;
+    case TREE_SITTER_VJASS_SYM_CALL_STATEMENT:
+      return KIND_CALL_STATEMENT;
+    case TREE_SITTER_VJASS_SYM_FUNCTION:
+      return KIND_FUNCTION;
+    case TREE_SITTER_VJASS_SYM_FUNCTION_CALL:
+      return KIND_FUNCTION_CALL;
+    case TREE_SITTER_VJASS_SYM_COMMENT:
+      return KIND_COMMENT;
+    case TREE_SITTER_VJASS_SYM_ID:
+      return KIND_ID;
+    default:
+      return KIND_OTHER;
+  }
+}
+
+typedef enum { DISPATCH_WALK, DISPATCH_STRCMP, DISPATCH_SWITCH, DISPATCH_COUNT } Dispatch;
+
+static const char *const DISPATCH_NAMES[DISPATCH_COUNT] = {"walk", "strcmp", "switch"};
+
+static Visit run(Dispatch dispatch, const TSTree *tree) {
+  Visit visit;
+  memset(&visit, 0, sizeof(visit));
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    switch (dispatch) {
+      case DISPATCH_STRCMP:
+        visit.counts[kind_of_type(ts_node_type(node))]++;
+        break;
+      case DISPATCH_SWITCH:
+        visit.counts[kind_of_symbol(ts_node_symbol(node))]++;
+        break;
+      default:
+        visit.counts[KIND_OTHER] += ts_node_is_named(node);
+        break;
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return visit;
+      }
+    }
+  }
+}
+
+static int usage(void) {
+  fprintf(stderr, "usage: vjass-dispatch-bench [--repeat N] FILE...\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  unsigned repeat = 5;
+  int first = 1;
+  for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+    const char *value = first + 1 < argc ? argv[first + 1] : NULL;
+    if (!value) return usage();
+    if (strcmp(argv[first], "--repeat") == 0) {
+      repeat = (unsigned)atoi(value);
+    } else {
+      return usage();
+    }
+    first++;
+  }
+  if (first >= argc || repeat == 0) return usage();
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vjass());
+
+  printf("%-32s %-8s %12s %10s %10s %10s %6s\n", "file", "dispatch", "nodes", "ms", "ns/node", "vs strcmp", "same");
+
+  int status = 0;
+  for (int i = first; i < argc; i++) {
+    TSVjassMappedFile file;
+    if (!tree_sitter_vjass_map_file(&file, argv[i])) {
+      perror(argv[i]);
+      status = 1;
+      continue;
+    }
+    TSTree *tree = ts_parser_parse_string(parser, NULL, file.data, (uint32_t)file.length);
+    if (!tree) {
+      fprintf(stderr, "%s: parse failed\n", argv[i]);
+      tree_sitter_vjass_unmap_file(&file);
+      status = 1;
+      continue;
+    }
+    uint32_t nodes = ts_node_descendant_count(ts_tree_root_node(tree));
+
+    double times[DISPATCH_COUNT];
+    Visit visits[DISPATCH_COUNT];
+    for (unsigned d = 0; d < DISPATCH_COUNT; d++) {
+      for (unsigned r = 0; r < repeat; r++) {
+        double start = now();
+        Visit visit = run((Dispatch)d, tree);
+        double elapsed = now() - start;
+        if (r == 0 || elapsed < times[d]) times[d] = elapsed;
+        visits[d] = visit;
+      }
+    }
+
+    for (unsigned d = 0; d < DISPATCH_COUNT; d++) {
+      // The walk row only counts named nodes.
+      bool same = d == DISPATCH_WALK || memcmp(&visits[d], &visits[DISPATCH_STRCMP], sizeof(Visit)) == 0;
+      if (!same) status = 1;
+      printf("%-32s %-8s %12u %10.3f %10.2f %10.2f %6s\n", argv[i], DISPATCH_NAMES[d], nodes, times[d] * 1e3,
+             times[d] * 1e9 / (double)nodes, times[DISPATCH_STRCMP] / times[d], same ? "yes" : "NO");
+    }
+    fflush(stdout);
+
+    ts_tree_delete(tree);
+    tree_sitter_vjass_unmap_file(&file);
+  }
+
+  ts_parser_delete(parser);
+  return status;
+}
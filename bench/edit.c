@@ -0,0 +1,422 @@
+// Incremental reparse latency harness.
+//
+//   vjass-edit-bench [--edits N] [--seed S] [--kind type,delete,paste,comment] [--script FILE] FILE...
+//
+// Every file is parsed once, then an edit script is replayed on it the way
+// an editor would: change the text, ts_tree_edit() the old tree and reparse
+// with it. Reports the full parse time, the p50/p99/max latency of the
+// incremental reparses, the reused-subtree ratio and the average number of
+// bytes ts_tree_get_changed_ranges() reports per edit.
+//
+// Synthetic scripts are deterministic for a given --seed and mix:
+//
+//   type     a statement typed one character per edit at a line start
+//   delete   up to 40 characters of a line removed with backspace
+//   paste    a block of lines copied from elsewhere in the file
+//   comment  "//" toggled at the start of a line
+//
+// --script replays a recorded script instead, one edit per line:
+//
+//   <byte offset> <deleted bytes> <inserted text>
+//
+// where the inserted text runs to the end of the line and may use \n, \t
+// and \\ escapes.
+//
+// The reused-subtree ratio is reuse / (reuse + lexed) over the parser log of
+// an extra, untimed reparse of every edit: the share of parser steps that
+// took a subtree from the old tree instead of lexing a fresh token.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+enum Kind {
+  KIND_TYPE,
+  KIND_DELETE,
+  KIND_PASTE,
+  KIND_COMMENT,
+  KIND_COUNT,
+};
+
+static const char *kind_names[KIND_COUNT] = {"type", "delete", "paste", "comment"};
+
+typedef struct {
+  uint32_t offset;
+  uint32_t deleted;
+  char *inserted;
+  uint32_t inserted_length;
+} Edit;
+
+typedef struct {
+  Edit *edits;
+  size_t count;
+  size_t capacity;
+} Script;
+
+typedef struct {
+  char *data;
+  size_t length;
+  size_t capacity;
+} Text;
+
+typedef struct {
+  uint64_t reused;
+  uint64_t lexed;
+} ReuseStats;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t next_random(uint64_t *rng) {
+  // xorshift64*
+  *rng ^= *rng >> 12;
+  *rng ^= *rng << 25;
+  *rng ^= *rng >> 27;
+  return *rng * UINT64_C(2685821657736338717);
+}
+
+static uint32_t below(uint64_t *rng, uint32_t n) { return n == 0 ? 0 : (uint32_t)(next_random(rng) % n); }
+
+static void *checked_realloc(void *ptr, size_t size) {
+  void *result = realloc(ptr, size);
+  if (!result) {
+    fprintf(stderr, "vjass-edit-bench: out of memory\n");
+    exit(1);
+  }
+  return result;
+}
+
+static bool read_text(const char *path, Text *text) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  bool ok = size >= 0;
+  if (ok) {
+    text->capacity = (size_t)size + 1;
+    text->data = checked_realloc(NULL, text->capacity);
+    text->length = (size_t)size;
+    ok = fread(text->data, 1, text->length, file) == text->length;
+  }
+  fclose(file);
+  return ok;
+}
+
+static void push_edit(Script *script, uint32_t offset, uint32_t deleted, const char *inserted, uint32_t length) {
+  if (script->count == script->capacity) {
+    script->capacity = script->capacity ? script->capacity * 2 : 256;
+    script->edits = checked_realloc(script->edits, script->capacity * sizeof(Edit));
+  }
+  Edit *edit = &script->edits[script->count++];
+  edit->offset = offset;
+  edit->deleted = deleted;
+  edit->inserted = checked_realloc(NULL, length + 1);
+  memcpy(edit->inserted, inserted, length);
+  edit->inserted[length] = '\0';
+  edit->inserted_length = length;
+}
+
+static void free_script(Script *script) {
+  for (size_t i = 0; i < script->count; i++) free(script->edits[i].inserted);
+  free(script->edits);
+  memset(script, 0, sizeof(*script));
+}
+
+static bool load_script(const char *path, Script *script) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  char *line = NULL;
+  size_t capacity = 0;
+  ssize_t length;
+  while ((length = getline(&line, &capacity, file)) >= 0) {
+    unsigned long offset, deleted;
+    int consumed = 0;
+    if (sscanf(line, "%lu %lu%n", &offset, &deleted, &consumed) != 2) continue;
+    const char *in = line + consumed;
+    if (*in == ' ') in++;
+    char *out = line;
+    for (; *in && *in != '\n'; in++) {
+      if (*in == '\\' && in[1]) {
+        in++;
+        *out++ = *in == 'n' ? '\n' : *in == 't' ? '\t' : *in;
+      } else {
+        *out++ = *in;
+      }
+    }
+    push_edit(script, (uint32_t)offset, (uint32_t)deleted, line, (uint32_t)(out - line));
+  }
+  free(line);
+  fclose(file);
+  return true;
+}
+
+// Start of the line that contains `offset`.
+static uint32_t line_start(const char *data, uint32_t offset) {
+  while (offset > 0 && data[offset - 1] != '\n') offset--;
+  return offset;
+}
+
+static uint32_t line_end(const char *data, size_t length, uint32_t offset) {
+  while (offset < length && data[offset] != '\n') offset++;
+  return offset < length ? offset + 1 : offset;
+}
+
+static void apply(Text *text, const Edit *edit);
+
+// Appends synthetic edits until `count` are scheduled. The script is
+// generated against a shadow copy of the text so every offset is valid at
+// the time it is replayed.
+static void generate_script(Script *script, const Text *source, size_t count, uint64_t seed, const bool *kinds) {
+  static const char *statements[] = {
+    "    call BJDebugMsg(\"tick \" + I2S(i))\n",
+    "    set udg_Index = udg_Index + 1\n",
+    "    if u != null and GetUnitState(u, UNIT_STATE_LIFE) > 0. then\n",
+    "    local integer tmp = 0\n",
+    "    exitwhen i > 10\n",
+  };
+  Text shadow = {checked_realloc(NULL, source->capacity), source->length, source->capacity};
+  memcpy(shadow.data, source->data, source->length);
+  uint64_t rng = seed * UINT64_C(0x9E3779B97F4A7C15) | 1;
+
+  while (script->count < count && shadow.length > 0) {
+    enum Kind kind = (enum Kind)below(&rng, KIND_COUNT);
+    if (!kinds[kind]) continue;
+    size_t first = script->count;
+    uint32_t at = line_start(shadow.data, below(&rng, (uint32_t)shadow.length));
+
+    if (kind == KIND_TYPE) {
+      const char *statement = statements[below(&rng, sizeof(statements) / sizeof(*statements))];
+      uint32_t length = (uint32_t)strlen(statement);
+      for (uint32_t i = 0; i < length; i++) push_edit(script, at + i, 0, statement + i, 1);
+    } else if (kind == KIND_DELETE) {
+      // Backspace up to 40 characters at the start of the line.
+      uint32_t end = line_end(shadow.data, shadow.length, at);
+      uint32_t length = 1 + below(&rng, 40);
+      if (length > end - at) length = end - at;
+      for (uint32_t i = length; i > 0; i--) push_edit(script, at + i - 1, 1, "", 0);
+    } else if (kind == KIND_PASTE) {
+      uint32_t from = line_start(shadow.data, below(&rng, (uint32_t)shadow.length));
+      uint32_t to = from;
+      for (unsigned lines = 5 + below(&rng, 30); lines > 0 && to < shadow.length; lines--) {
+        to = line_end(shadow.data, shadow.length, to);
+      }
+      push_edit(script, at, 0, shadow.data + from, to - from);
+    } else {
+      bool commented = shadow.length - at >= 2 && memcmp(shadow.data + at, "//", 2) == 0;
+      push_edit(script, at, commented ? 2 : 0, commented ? "" : "//", commented ? 0 : 2);
+    }
+
+    for (size_t i = first; i < script->count; i++) apply(&shadow, &script->edits[i]);
+  }
+  if (script->count > count) {
+    for (size_t i = count; i < script->count; i++) free(script->edits[i].inserted);
+    script->count = count;
+  }
+  free(shadow.data);
+}
+
+static TSPoint point_at(const char *data, uint32_t offset) {
+  TSPoint point = {0, 0};
+  const char *end = data + offset, *line = data, *newline;
+  while ((newline = memchr(line, '\n', (size_t)(end - line)))) {
+    point.row++;
+    line = newline + 1;
+  }
+  point.column = (uint32_t)(end - line);
+  return point;
+}
+
+// Clamps `edit` to the text and applies it in place.
+static void apply(Text *text, const Edit *edit) {
+  uint32_t offset = edit->offset < text->length ? edit->offset : (uint32_t)text->length;
+  uint32_t deleted = edit->deleted < text->length - offset ? edit->deleted : (uint32_t)(text->length - offset);
+  size_t length = text->length - deleted + edit->inserted_length;
+  if (length + 1 > text->capacity) {
+    text->capacity = (length + 1) * 2;
+    text->data = checked_realloc(text->data, text->capacity);
+  }
+  memmove(text->data + offset + edit->inserted_length, text->data + offset + deleted,
+          text->length - offset - deleted);
+  memcpy(text->data + offset, edit->inserted, edit->inserted_length);
+  text->length = length;
+}
+
+// Applies `edit` to `text` and describes it for ts_tree_edit().
+static TSInputEdit apply_edit(Text *text, const Edit *edit) {
+  uint32_t offset = edit->offset < text->length ? edit->offset : (uint32_t)text->length;
+  uint32_t deleted = edit->deleted < text->length - offset ? edit->deleted : (uint32_t)(text->length - offset);
+  TSInputEdit input = {
+    .start_byte = offset,
+    .old_end_byte = offset + deleted,
+    .new_end_byte = offset + edit->inserted_length,
+    .start_point = point_at(text->data, offset),
+    .old_end_point = point_at(text->data, offset + deleted),
+  };
+  apply(text, edit);
+  input.new_end_point = point_at(text->data, input.new_end_byte);
+  return input;
+}
+
+// "reuse_node symbol:..." and "lexed_lookahead sym:..." are logged once per
+// reused subtree and per freshly lexed token.
+static void reuse_logger(void *payload, TSLogType type, const char *message) {
+  ReuseStats *stats = payload;
+  if (type != TSLogTypeParse) return;
+  if (strncmp(message, "reuse_node", 10) == 0) {
+    stats->reused++;
+  } else if (strncmp(message, "lexed_lookahead", 15) == 0) {
+    stats->lexed++;
+  }
+}
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, size_t count, double p) {
+  if (count == 0) return 0;
+  size_t index = (size_t)(p * (double)(count - 1) + 0.5);
+  return sorted[index];
+}
+
+static bool parse_kinds(const char *s, bool *kinds) {
+  memset(kinds, 0, KIND_COUNT * sizeof(bool));
+  while (*s) {
+    size_t len = strcspn(s, ",");
+    bool found = false;
+    for (unsigned i = 0; i < KIND_COUNT; i++) {
+      if (strlen(kind_names[i]) == len && strncmp(s, kind_names[i], len) == 0) kinds[i] = found = true;
+    }
+    if (!found) return false;
+    s += len;
+    if (*s == ',') s++;
+  }
+  return true;
+}
+
+static int usage(void) {
+  fprintf(stderr, "usage: vjass-edit-bench [--edits N] [--seed S] [--kind type,delete,paste,comment] "
+                  "[--script FILE] FILE...\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  size_t edits = 1000;
+  uint64_t seed = 1;
+  bool kinds[KIND_COUNT] = {true, true, true, true};
+  const char *script_path = NULL;
+  int first = 1;
+  for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+    const char *value = first + 1 < argc ? argv[first + 1] : NULL;
+    if (!value) return usage();
+    if (strcmp(argv[first], "--edits") == 0) {
+      edits = (size_t)strtoull(value, NULL, 10);
+    } else if (strcmp(argv[first], "--seed") == 0) {
+      seed = strtoull(value, NULL, 10);
+    } else if (strcmp(argv[first], "--kind") == 0) {
+      if (!parse_kinds(value, kinds)) return usage();
+    } else if (strcmp(argv[first], "--script") == 0) {
+      script_path = value;
+    } else {
+      return usage();
+    }
+    first++;
+  }
+  bool any_kind = false;
+  for (unsigned k = 0; k < KIND_COUNT; k++) any_kind |= kinds[k];
+  if (first >= argc || edits == 0 || !any_kind) return usage();
+
+  Script recorded = {0};
+  if (script_path && !load_script(script_path, &recorded)) {
+    perror(script_path);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vjass());
+
+  printf("%-32s %12s %8s %10s %10s %10s %10s %8s %12s %6s\n", "file", "bytes", "edits", "full ms", "p50 ms",
+         "p99 ms", "max ms", "reuse %", "changed B", "error");
+
+  int status = 0;
+  for (int i = first; i < argc; i++) {
+    Text text = {0};
+    if (!read_text(argv[i], &text)) {
+      perror(argv[i]);
+      free(text.data);
+      status = 1;
+      continue;
+    }
+
+    Script generated = {0};
+    const Script *script = &recorded;
+    if (!script_path) {
+      generate_script(&generated, &text, edits, seed, kinds);
+      script = &generated;
+    }
+
+    double start = now();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, text.data, (uint32_t)text.length);
+    double full = now() - start;
+    size_t bytes = text.length;
+
+    double *latencies = checked_realloc(NULL, (script->count + 1) * sizeof(double));
+    ReuseStats reuse = {0, 0};
+    uint64_t changed = 0;
+
+    for (size_t e = 0; e < script->count; e++) {
+      TSInputEdit input = apply_edit(&text, &script->edits[e]);
+      ts_tree_edit(tree, &input);
+
+      // Untimed reparse of a copy of the edited tree, with the logger on.
+      TSTree *copy = ts_tree_copy(tree);
+      ts_parser_set_logger(parser, (TSLogger){&reuse, reuse_logger});
+      ts_tree_delete(ts_parser_parse_string(parser, copy, text.data, (uint32_t)text.length));
+      ts_parser_set_logger(parser, (TSLogger){NULL, NULL});
+      ts_tree_delete(copy);
+
+      start = now();
+      TSTree *new_tree = ts_parser_parse_string(parser, tree, text.data, (uint32_t)text.length);
+      latencies[e] = now() - start;
+
+      uint32_t range_count;
+      TSRange *ranges = ts_tree_get_changed_ranges(tree, new_tree, &range_count);
+      for (uint32_t r = 0; r < range_count; r++) changed += ranges[r].end_byte - ranges[r].start_byte;
+      free(ranges);
+
+      ts_tree_delete(tree);
+      tree = new_tree;
+    }
+
+    qsort(latencies, script->count, sizeof(double), compare_doubles);
+    size_t count = script->count;
+    printf("%-32s %12zu %8zu %10.3f %10.3f %10.3f %10.3f %8.1f %12.0f %6s\n", argv[i], bytes, count, full * 1e3,
+           percentile(latencies, count, 0.50) * 1e3, percentile(latencies, count, 0.99) * 1e3,
+           count ? latencies[count - 1] * 1e3 : 0.0,
+           reuse.reused + reuse.lexed ? 100.0 * (double)reuse.reused / (double)(reuse.reused + reuse.lexed) : 0.0,
+           count ? (double)changed / (double)count : 0.0, ts_node_has_error(ts_tree_root_node(tree)) ? "yes" : "no");
+    fflush(stdout);
+
+    ts_tree_delete(tree);
+    free(latencies);
+    free_script(&generated);
+    free(text.data);
+  }
+
+  free_script(&recorded);
+  ts_parser_delete(parser);
+  return status;
+}
@@ -0,0 +1,469 @@
+// Deterministic generator of synthetic vJASS sources for benchmarking.
+//
+//   vjass-gen [--size 10M] [--seed 1] [--shape globals,structs,loops,exprs,strings,comments,lists,disabled,rawcodes]
+//             [--depth 4] [--expr-len 8] [--string-len 64] [--comment-len 256]
+//             [--list-len 64] [--disabled-len 1M] [--files N] [-o out.j]
+//
+// The same options always produce the same bytes, so corpora can be
+// regenerated on any machine instead of being checked in.
+//
+// With --files N, -o names an existing directory that receives N files
+// file-00000.j, file-00001.j, ... of --size each, seeded --seed, --seed+1, ...
+// (a workspace rather than one big map).
+
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum Shape {
+  SHAPE_GLOBALS,
+  SHAPE_STRUCTS,
+  SHAPE_LOOPS,
+  SHAPE_EXPRS,
+  SHAPE_STRINGS,
+  SHAPE_COMMENTS,
+  SHAPE_LISTS,
+  SHAPE_DISABLED,
+  SHAPE_RAWCODES,
+  SHAPE_COUNT,
+};
+
+static const char *shape_names[SHAPE_COUNT] = {
+  "globals", "structs", "loops", "exprs", "strings", "comments", "lists", "disabled", "rawcodes",
+};
+
+typedef struct {
+  uint64_t size;
+  uint64_t seed;
+  bool shapes[SHAPE_COUNT];
+  unsigned depth;
+  unsigned expr_len;
+  unsigned string_len;
+  unsigned comment_len;
+  unsigned list_len;
+  uint64_t disabled_len;
+  uint64_t files;
+} Options;
+
+typedef struct {
+  FILE *out;
+  uint64_t written;
+  uint64_t rng;
+  const Options *options;
+} Gen;
+
+static uint64_t next_random(Gen *gen) {
+  // xorshift64*
+  gen->rng ^= gen->rng >> 12;
+  gen->rng ^= gen->rng << 25;
+  gen->rng ^= gen->rng >> 27;
+  return gen->rng * UINT64_C(2685821657736338717);
+}
+
+static unsigned below(Gen *gen, unsigned n) { return n == 0 ? 0 : (unsigned)(next_random(gen) % n); }
+
+static void emit(Gen *gen, const char *s) {
+  size_t len = strlen(s);
+  fwrite(s, 1, len, gen->out);
+  gen->written += len;
+}
+
+static void emitf(Gen *gen, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int len = vfprintf(gen->out, format, args);
+  va_end(args);
+  if (len > 0) gen->written += (uint64_t)len;
+}
+
+static void indent(Gen *gen, unsigned level) {
+  for (unsigned i = 0; i < level; i++) emit(gen, "    ");
+}
+
+static void emit_id(Gen *gen) {
+  static const char *prefixes[] = {"u", "i", "r", "s", "unitGroup", "udg_Hero", "tmp", "Index"};
+  emitf(gen, "%s%u", prefixes[below(gen, 8)], below(gen, 1000));
+}
+
+static void emit_atom(Gen *gen) {
+  switch (below(gen, 6)) {
+    case 0: emitf(gen, "%u", below(gen, 100000)); break;
+    case 1: emitf(gen, "%u.%u", below(gen, 1000), below(gen, 100)); break;
+    case 2: emit_id(gen); emit(gen, "."); emit_id(gen); break;
+    default: emit_id(gen); break;
+  }
+}
+
+static void emit_expr(Gen *gen, unsigned terms) {
+  static const char *ops[] = {" + ", " - ", " * ", " / ", " < ", " >= ", " == ", " and ", " or "};
+  for (unsigned i = 0; i < terms; i++) {
+    if (i > 0) emit(gen, ops[below(gen, 9)]);
+    if (terms > 2 && below(gen, 5) == 0) {
+      emit(gen, "(");
+      emit_expr(gen, 2 + below(gen, 2));
+      emit(gen, ")");
+    } else {
+      emit_atom(gen);
+    }
+  }
+}
+
+static void emit_string(Gen *gen, unsigned len) {
+  static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789|cffffcc00";
+  emit(gen, "\"");
+  for (unsigned i = 0; i < len; i++) fputc(alphabet[below(gen, sizeof(alphabet) - 1)], gen->out);
+  gen->written += len;
+  emit(gen, "\"");
+}
+
+static void emit_comment(Gen *gen, unsigned level, unsigned len) {
+  indent(gen, level);
+  unsigned kind = below(gen, 3);
+  if (kind == 0) {
+    emit(gen, "// ");
+    emit_string(gen, len < 80 ? len : 80);
+    emit(gen, "\n");
+    return;
+  }
+  emit(gen, kind == 1 ? "--[[\n" : "/*\n");
+  for (unsigned i = 0; i < len; i += 64) {
+    emit(gen, "    call Disabled(");
+    emit_expr(gen, 3);
+    emit(gen, ")\n");
+  }
+  emit(gen, kind == 1 ? "]]\n" : "*/\n");
+}
+
+// Object ids as in `CreateUnit(p, 'hfoo', x, y, 0)`, with the odd
+// single-character code.
+static void emit_rawcode(Gen *gen) {
+  static const char kinds[] = "AhoeunIBRS";
+  static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+  if (below(gen, 8) == 0) {
+    emitf(gen, "'%c'", alphabet[below(gen, 26)]);
+    return;
+  }
+  emitf(gen, "'%c%c%c%c'", kinds[below(gen, sizeof(kinds) - 1)], alphabet[below(gen, sizeof(alphabet) - 1)],
+        alphabet[below(gen, sizeof(alphabet) - 1)], alphabet[below(gen, sizeof(alphabet) - 1)]);
+}
+
+static void emit_value(Gen *gen) {
+  const Options *o = gen->options;
+  if (o->shapes[SHAPE_RAWCODES] && below(gen, 3) == 0) {
+    emit_rawcode(gen);
+  } else if (o->shapes[SHAPE_STRINGS] && below(gen, 4) == 0) {
+    emit_string(gen, 1 + below(gen, o->string_len));
+  } else if (o->shapes[SHAPE_EXPRS]) {
+    emit_expr(gen, 1 + below(gen, o->expr_len));
+  } else {
+    emit_atom(gen);
+  }
+}
+
+static void emit_type(Gen *gen) {
+  static const char *types[] = {"integer", "real", "boolean", "string", "unit", "group", "trigger", "timer"};
+  emit(gen, types[below(gen, 8)]);
+}
+
+static void emit_declaration(Gen *gen, unsigned level, const char *modifier) {
+  indent(gen, level);
+  if (modifier) {
+    emit(gen, modifier);
+    emit(gen, " ");
+  }
+  emit_type(gen);
+  if (below(gen, 5) == 0) {
+    emit(gen, " array ");
+    emit_id(gen);
+  } else {
+    emit(gen, " ");
+    emit_id(gen);
+    emit(gen, " = ");
+    emit_value(gen);
+  }
+  emit(gen, "\n");
+}
+
+static void emit_call(Gen *gen) {
+  static const char *natives[] = {"DisplayTextToPlayer", "SetUnitX", "GroupAddUnit", "TriggerAddAction", "BJDebugMsg"};
+  emit(gen, natives[below(gen, 5)]);
+  emit(gen, "(");
+  unsigned args = below(gen, 5);
+  for (unsigned i = 0; i < args; i++) {
+    if (i > 0) emit(gen, ", ");
+    emit_value(gen);
+  }
+  emit(gen, ")");
+}
+
+static void emit_block(Gen *gen, unsigned level, unsigned depth);
+
+static void emit_statement(Gen *gen, unsigned level, unsigned depth) {
+  const Options *o = gen->options;
+  unsigned kind = below(gen, 8);
+
+  if (depth > 1 && o->shapes[SHAPE_LOOPS] && kind == 0) {
+    indent(gen, level);
+    emit(gen, "loop\n");
+    indent(gen, level + 1);
+    emit(gen, "exitwhen ");
+    emit_expr(gen, 3);
+    emit(gen, "\n");
+    emit_block(gen, level + 1, depth - 1);
+    indent(gen, level);
+    emit(gen, "endloop\n");
+  } else if (depth > 1 && kind == 1) {
+    indent(gen, level);
+    emit(gen, "if ");
+    emit_expr(gen, 3);
+    emit(gen, " then\n");
+    emit_block(gen, level + 1, depth - 1);
+    if (below(gen, 2) == 0) {
+      indent(gen, level);
+      emit(gen, "else\n");
+      emit_block(gen, level + 1, depth - 1);
+    }
+    indent(gen, level);
+    emit(gen, "endif\n");
+  } else if (o->shapes[SHAPE_COMMENTS] && kind == 2) {
+    emit_comment(gen, level, o->comment_len);
+  } else if (kind < 5) {
+    indent(gen, level);
+    emit(gen, "call ");
+    emit_call(gen);
+    emit(gen, "\n");
+  } else {
+    indent(gen, level);
+    emit(gen, "set ");
+    emit_id(gen);
+    if (below(gen, 4) == 0) {
+      emit(gen, "[");
+      emit_atom(gen);
+      emit(gen, "]");
+    }
+    emit(gen, " = ");
+    emit_value(gen);
+    emit(gen, "\n");
+  }
+}
+
+static void emit_block(Gen *gen, unsigned level, unsigned depth) {
+  unsigned statements = 1 + below(gen, 6);
+  for (unsigned i = 0; i < statements; i++) emit_statement(gen, level, depth);
+}
+
+static void emit_function(Gen *gen) {
+  const Options *o = gen->options;
+  emitf(gen, "function F%u takes ", below(gen, 1000000));
+  unsigned params = below(gen, 4);
+  if (params == 0) emit(gen, "nothing");
+  for (unsigned i = 0; i < params; i++) {
+    if (i > 0) emit(gen, ", ");
+    emit_type(gen);
+    emit(gen, " ");
+    emit_id(gen);
+  }
+  emit(gen, " returns nothing\n");
+
+  unsigned locals = below(gen, 5);
+  for (unsigned i = 0; i < locals; i++) emit_declaration(gen, 1, "local");
+  unsigned blocks = 1 + below(gen, 3);
+  for (unsigned i = 0; i < blocks; i++) emit_block(gen, 1, o->depth);
+
+  emit(gen, "endfunction\n\n");
+}
+
+static void emit_globals(Gen *gen) {
+  emit(gen, "globals\n");
+  unsigned count = 4 + below(gen, 60);
+  for (unsigned i = 0; i < count; i++) emit_declaration(gen, 1, below(gen, 6) == 0 ? "constant" : NULL);
+  emit(gen, "endglobals\n\n");
+}
+
+static void emit_struct(Gen *gen) {
+  emitf(gen, "struct S%u\n", below(gen, 100000));
+  unsigned members = 2 + below(gen, 12);
+  for (unsigned i = 0; i < members; i++) emit_declaration(gen, 1, NULL);
+  emit(gen, "endstruct\n\n");
+}
+
+// One declaration and one call with `list_len` comma-separated entries each.
+static void emit_lists(Gen *gen) {
+  unsigned len = gen->options->list_len;
+  emit(gen, "globals\n    integer");
+  for (unsigned i = 0; i < len; i++) emitf(gen, "%s v%u = %u", i > 0 ? "," : "", i, below(gen, 100000));
+  emit(gen, "\nendglobals\n\nfunction L takes nothing returns nothing\n    call Init(");
+  for (unsigned i = 0; i < len; i++) emitf(gen, "%sv%u", i > 0 ? ", " : "", i);
+  emit(gen, ")\nendfunction\n\n");
+}
+
+// A commented-out region of whole functions, `disabled_len` bytes long.
+static void emit_disabled(Gen *gen) {
+  uint64_t end = gen->written + gen->options->disabled_len;
+  emit(gen, "/*\n");
+  while (gen->written < end) emit_function(gen);
+  emit(gen, "*/\n\n");
+}
+
+static void generate(Gen *gen) {
+  const Options *o = gen->options;
+  enum Shape enabled[SHAPE_COUNT];
+  unsigned enabled_count = 0;
+  for (unsigned i = 0; i < SHAPE_COUNT; i++) {
+    if (o->shapes[i]) enabled[enabled_count++] = (enum Shape)i;
+  }
+
+  while (gen->written < o->size) {
+    switch (enabled[below(gen, enabled_count)]) {
+      case SHAPE_GLOBALS: emit_globals(gen); break;
+      case SHAPE_STRUCTS: emit_struct(gen); break;
+      case SHAPE_COMMENTS: emit_comment(gen, 0, o->comment_len); break;
+      case SHAPE_LISTS: emit_lists(gen); break;
+      case SHAPE_DISABLED: emit_disabled(gen); break;
+      default: emit_function(gen); break;
+    }
+  }
+}
+
+static bool parse_size(const char *s, uint64_t *out) {
+  char *end;
+  unsigned long long value = strtoull(s, &end, 10);
+  if (end == s) return false;
+  switch (*end) {
+    case 'k': case 'K': value <<= 10; end++; break;
+    case 'm': case 'M': value <<= 20; end++; break;
+    case 'g': case 'G': value <<= 30; end++; break;
+    default: break;
+  }
+  if (*end == 'B' || *end == 'b') end++;
+  *out = value;
+  return *end == 0;
+}
+
+static bool parse_shapes(const char *s, bool *shapes) {
+  memset(shapes, 0, sizeof(bool) * SHAPE_COUNT);
+  while (*s) {
+    size_t len = strcspn(s, ",");
+    bool found = false;
+    for (unsigned i = 0; i < SHAPE_COUNT; i++) {
+      if (strlen(shape_names[i]) == len && strncmp(s, shape_names[i], len) == 0) {
+        shapes[i] = found = true;
+      }
+    }
+    if (!found) return false;
+    s += len;
+    if (*s == ',') s++;
+  }
+  return true;
+}
+
+// Writes one corpus to `path` (stdout when NULL).
+static bool write_corpus(const Options *options, const char *path, uint64_t *written) {
+  FILE *out = path ? fopen(path, "wb") : stdout;
+  if (!out) return false;
+
+  static char buffer[1 << 16];
+  setvbuf(out, buffer, _IOFBF, sizeof(buffer));
+
+  Gen gen = {
+    .out = out,
+    .rng = options->seed * UINT64_C(0x9E3779B97F4A7C15) | 1,
+    .options = options,
+  };
+  generate(&gen);
+  *written = gen.written;
+  return path ? fclose(out) == 0 : fflush(out) == 0;
+}
+
+static int usage(void) {
+  fprintf(stderr,
+          "usage: vjass-gen [--size 10M] [--seed N] [--shape LIST] [--depth N]\n"
+          "                 [--expr-len N] [--string-len N] [--comment-len N] [--list-len N]\n"
+          "                 [--disabled-len N] [--files N] [-o FILE|DIR]\n"
+          "shapes: globals,structs,loops,exprs,strings,comments,lists,disabled,rawcodes\n"
+          "        (default: all but lists, disabled and rawcodes)\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  Options options = {
+    .size = 10 << 10,
+    .seed = 1,
+    .depth = 4,
+    .expr_len = 8,
+    .string_len = 64,
+    .comment_len = 256,
+    .list_len = 64,
+    .disabled_len = 1 << 20,
+  };
+  for (unsigned i = 0; i < SHAPE_COUNT; i++) options.shapes[i] = i != SHAPE_LISTS && i != SHAPE_DISABLED && i != SHAPE_RAWCODES;
+  const char *output = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    bool ok = value != NULL;
+    if (strcmp(arg, "--size") == 0) {
+      ok = ok && parse_size(value, &options.size);
+    } else if (strcmp(arg, "--seed") == 0) {
+      ok = ok && parse_size(value, &options.seed);
+    } else if (strcmp(arg, "--shape") == 0) {
+      ok = ok && parse_shapes(value, options.shapes);
+    } else if (strcmp(arg, "--depth") == 0) {
+      options.depth = ok ? (unsigned)atoi(value) : 0;
+    } else if (strcmp(arg, "--expr-len") == 0) {
+      options.expr_len = ok ? (unsigned)atoi(value) : 0;
+    } else if (strcmp(arg, "--string-len") == 0) {
+      options.string_len = ok ? (unsigned)atoi(value) : 0;
+    } else if (strcmp(arg, "--comment-len") == 0) {
+      options.comment_len = ok ? (unsigned)atoi(value) : 0;
+    } else if (strcmp(arg, "--list-len") == 0) {
+      options.list_len = ok ? (unsigned)atoi(value) : 0;
+    } else if (strcmp(arg, "--disabled-len") == 0) {
+      ok = ok && parse_size(value, &options.disabled_len);
+    } else if (strcmp(arg, "--files") == 0) {
+      ok = ok && parse_size(value, &options.files);
+    } else if (strcmp(arg, "-o") == 0) {
+      output = value;
+    } else {
+      ok = false;
+    }
+    if (!ok) return usage();
+    i++;
+  }
+
+  bool any_shape = false;
+  for (unsigned i = 0; i < SHAPE_COUNT; i++) any_shape |= options.shapes[i];
+  if (!any_shape || options.depth == 0 || options.expr_len == 0) return usage();
+
+  if (options.files > 0) {
+    if (!output) return usage();
+    uint64_t total = 0;
+    for (uint64_t f = 0; f < options.files; f++) {
+      char path[4096];
+      snprintf(path, sizeof(path), "%s/file-%05" PRIu64 ".j", output, f);
+      Options file_options = options;
+      file_options.seed = options.seed + f;
+      uint64_t written = 0;
+      if (!write_corpus(&file_options, path, &written)) {
+        perror(path);
+        return 1;
+      }
+      total += written;
+    }
+    fprintf(stderr, "%s: %" PRIu64 " files, %" PRIu64 " bytes\n", output, options.files, total);
+    return 0;
+  }
+
+  uint64_t written = 0;
+  if (!write_corpus(&options, output, &written)) {
+    perror(output);
+    return 1;
+  }
+  if (output) fprintf(stderr, "%s: %" PRIu64 " bytes\n", output, written);
+  return 0;
+}
@@ -0,0 +1,145 @@
+// Chunked parallel parse harness.
+//
+//   vjass-parallel-bench [--threads 1,2,4,8,16,32] [--chunks-per-thread N] [--repeat N] FILE...
+//
+// Every file is parsed once as a whole, then split with
+// tree_sitter_vjass_split() and parsed with tree_sitter_vjass_parse_chunked()
+// on each thread count in turn. Reports the wall time of the best of
+// --repeat runs, the speedup over the whole-file parse, and whether the
+// chunked parse produced the same number of top-level nodes and no errors
+// where the whole-file parse had none.
+//
+// More chunks than threads (--chunks-per-thread) evens out chunks of
+// unequal cost at the price of more parsers and included-range setup.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#include <tree_sitter/tree-sitter-vjass-split.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+#define MAX_THREAD_COUNTS 32
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static unsigned parse_threads(const char *s, uint32_t *threads) {
+  unsigned count = 0;
+  while (*s && count < MAX_THREAD_COUNTS) {
+    char *end;
+    unsigned long value = strtoul(s, &end, 10);
+    if (end == s || value == 0 || value > 1024 || (*end != ',' && *end != 0)) return 0;
+    threads[count++] = (uint32_t)value;
+    s = *end == ',' ? end + 1 : end;
+  }
+  return *s ? 0 : count;
+}
+
+static int usage(void) {
+  fprintf(stderr, "usage: vjass-parallel-bench [--threads 1,2,4,8,16,32] [--chunks-per-thread N] [--repeat N] FILE...\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  uint32_t threads[MAX_THREAD_COUNTS] = {1, 2, 4, 8, 16, 32};
+  unsigned thread_counts = 6;
+  uint32_t chunks_per_thread = 1;
+  unsigned repeat = 3;
+  int first = 1;
+  for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+    const char *value = first + 1 < argc ? argv[first + 1] : NULL;
+    if (!value) return usage();
+    if (strcmp(argv[first], "--threads") == 0) {
+      thread_counts = parse_threads(value, threads);
+    } else if (strcmp(argv[first], "--chunks-per-thread") == 0) {
+      chunks_per_thread = (uint32_t)atoi(value);
+    } else if (strcmp(argv[first], "--repeat") == 0) {
+      repeat = (unsigned)atoi(value);
+    } else {
+      return usage();
+    }
+    first++;
+  }
+  if (first >= argc || thread_counts == 0 || chunks_per_thread == 0 || repeat == 0) return usage();
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vjass());
+
+  printf("%-32s %12s %8s %8s %10s %10s %8s %10s %6s %6s\n", "file", "bytes", "threads", "chunks", "ms", "MB/s",
+         "speedup", "split ms", "same", "error");
+
+  int status = 0;
+  for (int i = first; i < argc; i++) {
+    TSVjassMappedFile file;
+    if (!tree_sitter_vjass_map_file(&file, argv[i])) {
+      perror(argv[i]);
+      status = 1;
+      continue;
+    }
+    uint32_t length = (uint32_t)file.length;
+    double mb = (double)length / (1024.0 * 1024.0);
+
+    double whole = 0;
+    uint32_t whole_children = 0;
+    bool whole_error = false;
+    for (unsigned r = 0; r < repeat; r++) {
+      double start = now();
+      TSTree *tree = ts_parser_parse_string(parser, NULL, file.data, length);
+      double elapsed = now() - start;
+      if (r == 0 || elapsed < whole) whole = elapsed;
+      whole_children = ts_node_child_count(ts_tree_root_node(tree));
+      whole_error = ts_node_has_error(ts_tree_root_node(tree));
+      ts_tree_delete(tree);
+    }
+    printf("%-32s %12u %8s %8u %10.3f %10.2f %8.2f %10s %6s %6s\n", argv[i], length, "whole", 1, whole * 1e3,
+           mb / whole, 1.0, "-", "-", whole_error ? "yes" : "no");
+
+    for (unsigned t = 0; t < thread_counts; t++) {
+      uint32_t chunks = threads[t] * chunks_per_thread;
+      TSRange *ranges = malloc(sizeof(TSRange) * chunks);
+      double split_start = now();
+      tree_sitter_vjass_split(file.data, length, ranges, chunks);
+      double split = now() - split_start;
+      free(ranges);
+
+      double best = 0;
+      TSVjassChunkedTree chunked = {0};
+      bool ok = true;
+      for (unsigned r = 0; r < repeat && ok; r++) {
+        tree_sitter_vjass_chunked_tree_delete(&chunked);
+        double start = now();
+        ok = tree_sitter_vjass_parse_chunked(tree_sitter_vjass(), file.data, length, threads[t], chunks, &chunked);
+        double elapsed = now() - start;
+        if (r == 0 || elapsed < best) best = elapsed;
+      }
+      if (!ok) {
+        fprintf(stderr, "%s: chunked parse on %u threads failed\n", argv[i], threads[t]);
+        status = 1;
+        continue;
+      }
+
+      bool has_error = tree_sitter_vjass_chunked_has_error(&chunked);
+      bool same = tree_sitter_vjass_chunked_child_count(&chunked) == whole_children && has_error == whole_error;
+      if (!same) status = 1;
+      printf("%-32s %12u %8u %8u %10.3f %10.2f %8.2f %10.3f %6s %6s\n", argv[i], length, threads[t], chunked.count,
+             best * 1e3, mb / best, whole / best, split * 1e3, same ? "yes" : "NO", has_error ? "yes" : "no");
+      fflush(stdout);
+      tree_sitter_vjass_chunked_tree_delete(&chunked);
+    }
+    tree_sitter_vjass_unmap_file(&file);
+  }
+
+  ts_parser_delete(parser);
+  return status;
+}
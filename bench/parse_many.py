@@ -0,0 +1,108 @@
+# Python batch parsing: parse_many() against a loop over Parser.parse().
+#
+#   python3 bench/parse_many.py [--threads 1,2,4,8] [--repeat N] PATH...
+#
+# Parses every file (PATH is a file or a directory of *.j files) and reports
+# the best of --repeat runs as files/s and MB/s:
+#
+#   loop         open() + Parser.parse() + root_node.descendant_count per
+#                file, from the `tree_sitter` package; skipped when the
+#                package is not installed
+#   parse_many   parse_many(paths, threads=N) once per thread count; reads,
+#                parses and builds the node table of every file on native
+#                threads with the GIL released
+#
+# Every run must count the same nodes as the first one; a mismatch fails the
+# run.
+
+import argparse
+import os
+import sys
+import time
+
+import tree_sitter_vjass
+
+
+def collect(roots):
+    paths = []
+    for root in roots:
+        if os.path.isdir(root):
+            paths.extend(os.path.join(root, name) for name in sorted(os.listdir(root)) if name.endswith(".j"))
+        else:
+            paths.append(root)
+    return paths
+
+
+def loop(parser, paths):
+    nodes = 0
+    for path in paths:
+        with open(path, "rb") as file:
+            nodes += parser.parse(file.read()).root_node.descendant_count
+    return nodes
+
+
+def many(paths, threads):
+    nodes = 0
+    for table in tree_sitter_vjass.parse_many(paths, threads=threads):
+        if isinstance(table, OSError):
+            raise table
+        nodes += len(table)
+    return nodes
+
+
+def measure(repeat, body):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        nodes = body()
+        elapsed = time.perf_counter() - start
+        if best is None or elapsed < best[0]:
+            best = (elapsed, nodes)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(usage="python3 bench/parse_many.py [--threads 1,2,4,8] [--repeat N] PATH...")
+    parser.add_argument("--threads", default="1,2,4,8")
+    parser.add_argument("--repeat", type=int, default=3)
+    parser.add_argument("paths", nargs="+")
+    args = parser.parse_args()
+    try:
+        thread_counts = [int(n) for n in args.threads.split(",")]
+    except ValueError:
+        parser.error("--threads takes a comma-separated list of counts")
+    if args.repeat < 1 or any(n < 1 for n in thread_counts):
+        parser.error("--threads and --repeat must be positive")
+
+    paths = collect(args.paths)
+    mb = sum(os.path.getsize(path) for path in paths) / (1024 * 1024)
+
+    runs = []
+    try:
+        import tree_sitter
+
+        ts_parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_vjass.language()))
+        runs.append(("loop", 1, lambda: loop(ts_parser, paths)))
+    except ImportError:
+        pass
+    for threads in thread_counts:
+        runs.append(("parse_many", threads, lambda threads=threads: many(paths, threads)))
+
+    print(f"{'mode':<12} {'threads':>7} {'files':>8} {'MB':>10} {'ms':>10} {'files/s':>10} {'MB/s':>10} {'nodes':>12} "
+          f"{'same':>6}")
+    status = 0
+    expected = None
+    for mode, threads, body in runs:
+        elapsed, nodes = measure(args.repeat, body)
+        if expected is None:
+            expected = nodes
+        same = nodes == expected
+        if not same:
+            status = 1
+        print(f"{mode:<12} {threads:>7} {len(paths):>8} {mb:>10.2f} {elapsed * 1e3:>10.1f} "
+              f"{len(paths) / elapsed:>10.0f} {mb / elapsed:>10.2f} {nodes:>12} {'yes' if same else 'NO':>6}")
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
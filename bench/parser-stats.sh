@@ -0,0 +1,42 @@
+#!/bin/sh
+# Prints the size of the generated parse and lex tables, so grammar changes
+# can be compared before and after `tree-sitter generate`.
+#
+#   bench/parser-stats.sh [src/parser.c]
+
+set -e
+
+PARSER=${1:-src/parser.c}
+CC=${CC:-cc}
+OBJ=$(mktemp)
+trap 'rm -f "$OBJ"' EXIT
+
+for define in STATE_COUNT LARGE_STATE_COUNT SYMBOL_COUNT TOKEN_COUNT; do
+  printf '%-28s %s\n' "$define" "$(sed -n "s/^#define $define //p" "$PARSER")"
+done
+
+# Parse-table entries with more than one action. The runtime skips
+# SHIFT_REPEAT, so only the other entries can fork a stack version.
+awk '
+  /\.entry = \{\.count = / {
+    split($0, a, ".count = ")
+    if (a[2] + 0 > 1) { n++; if ($0 !~ /SHIFT_REPEAT/) forks++ }
+  }
+  END { printf "%-28s %d (%d can fork)\n", "multi-action entries", n, forks }
+' "$PARSER"
+
+for fn in ts_lex ts_lex_keywords; do
+  awk -v fn="$fn" '
+    $0 ~ "^static bool " fn "\\(" { f = 1 }
+    f { lines++; if ($0 ~ /^    case [0-9]+:/) states++ }
+    f && /^}/ { printf "%-28s %d states, %d lines\n", fn, states, lines; exit }
+  ' "$PARSER"
+done
+
+"$CC" -std=c11 -O2 -I"$(dirname "$PARSER")" -c "$PARSER" -o "$OBJ"
+nm -S "$OBJ" | while read -r _ size _ name; do
+  case "$name" in
+    ts_lex|ts_lex_keywords|ts_lex_modes|ts_parse_table|ts_small_parse_table|ts_small_parse_table_map)
+      printf '%-28s %d bytes\n' "sizeof $name" "$((0x$size))" ;;
+  esac
+done
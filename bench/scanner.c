@@ -0,0 +1,411 @@
+// External scanner microbenchmark.
+//
+//   vjass-scanner-bench [--size 8M] [--repeat 5] [--max-scaling 3]
+//
+// Drives tree_sitter_vjass_external_scanner_scan() through an in-memory
+// TSLexer (the advance/mark_end/eof callbacks of src/tree_sitter/parser.h),
+// without the parser or the tree-sitter runtime, and reports the time per
+// byte and per scanner call for each input shape: whitespace-heavy code,
+// quoted strings, and single multi-megabyte block strings and comments,
+// including content made of nothing but almost-terminators (`]=]`, `**`).
+//
+// The scanner is called the way the parser does: with the start tokens
+// valid at every token boundary (a rejected token is then consumed by the
+// mock), and with content/end valid inside a string or comment.
+//
+// Every case also runs at 1/8 of the size. "scaling" is the ratio of the
+// two ns/byte figures, ~1 for a linear scan; a case above --max-scaling is
+// flagged SUPERLINEAR and the exit status is 1, so a quadratic rescan (say
+// of repeated `]` in scan_block_content) fails the run.
+//
+// Build it with -DTREE_SITTER_VJASS_LIBC_WHITESPACE (the
+// vjass-scanner-bench-libc target) to compare against plain iswspace().
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <tree_sitter/parser.h>
+
+void *tree_sitter_vjass_external_scanner_create(void);
+void tree_sitter_vjass_external_scanner_destroy(void *payload);
+bool tree_sitter_vjass_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols);
+
+// Mirrors enum TokenType in src/scanner.c.
+enum {
+  BLOCK_COMMENT_START,
+  BLOCK_COMMENT_CONTENT,
+  BLOCK_COMMENT_END,
+  STRING_START,
+  STRING_CONTENT,
+  STRING_END,
+  TOKEN_COUNT,
+};
+
+typedef struct {
+  TSLexer lexer;
+  const uint8_t *data;
+  uint32_t length;
+  uint32_t position;  // of the lookahead character
+  uint32_t next;      // position after the lookahead character
+  uint32_t token_start;
+  uint32_t token_end;
+  bool marked;
+} MockLexer;
+
+static void decode(MockLexer *self) {
+  self->position = self->next;
+  if (self->position >= self->length) {
+    self->lexer.lookahead = 0;
+    return;
+  }
+  const uint8_t *c = self->data + self->position;
+  uint32_t left = self->length - self->position;
+  if (c[0] < 0x80 || left < 2) {
+    self->lexer.lookahead = c[0];
+    self->next = self->position + 1;
+  } else if (c[0] < 0xE0 || left < 3) {
+    self->lexer.lookahead = (c[0] & 0x1F) << 6 | (c[1] & 0x3F);
+    self->next = self->position + 2;
+  } else if (c[0] < 0xF0 || left < 4) {
+    self->lexer.lookahead = (c[0] & 0x0F) << 12 | (c[1] & 0x3F) << 6 | (c[2] & 0x3F);
+    self->next = self->position + 3;
+  } else {
+    self->lexer.lookahead = (c[0] & 0x07) << 18 | (c[1] & 0x3F) << 12 | (c[2] & 0x3F) << 6 | (c[3] & 0x3F);
+    self->next = self->position + 4;
+  }
+}
+
+static void mock_advance(TSLexer *lexer, bool skip) {
+  MockLexer *self = (MockLexer *)lexer;
+  if (self->position >= self->length) return;
+  decode(self);
+  if (skip) self->token_start = self->position;
+}
+
+static void mock_mark_end(TSLexer *lexer) {
+  MockLexer *self = (MockLexer *)lexer;
+  self->token_end = self->position;
+  self->marked = true;
+}
+
+static uint32_t mock_get_column(TSLexer *lexer) {
+  MockLexer *self = (MockLexer *)lexer;
+  uint32_t start = self->position;
+  while (start > 0 && self->data[start - 1] != '\n') start--;
+  return self->position - start;
+}
+
+static bool mock_is_at_included_range_start(const TSLexer *lexer) {
+  (void)lexer;
+  return false;
+}
+
+static bool mock_eof(const TSLexer *lexer) {
+  const MockLexer *self = (const MockLexer *)lexer;
+  return self->position >= self->length;
+}
+
+static void mock_log(const TSLexer *lexer, const char *format, ...) {
+  (void)lexer;
+  (void)format;
+}
+
+static void mock_init(MockLexer *self, const char *data, size_t length) {
+  memset(self, 0, sizeof(*self));
+  self->lexer.advance = mock_advance;
+  self->lexer.mark_end = mock_mark_end;
+  self->lexer.get_column = mock_get_column;
+  self->lexer.is_at_included_range_start = mock_is_at_included_range_start;
+  self->lexer.eof = mock_eof;
+  self->lexer.log = mock_log;
+  self->data = (const uint8_t *)data;
+  self->length = (uint32_t)length;
+}
+
+// Positions the lexer at `position` for a new scanner call.
+static void mock_reset(MockLexer *self, uint32_t position) {
+  self->next = position;
+  decode(self);
+  self->token_start = self->token_end = position;
+  self->marked = false;
+}
+
+// The end of the token the last scan returned, as the parser would see it.
+static uint32_t mock_token_end(const MockLexer *self) { return self->marked ? self->token_end : self->position; }
+
+typedef struct {
+  char *data;
+  size_t length;
+  size_t capacity;
+} Buffer;
+
+static void append(Buffer *buffer, const char *s, size_t length) {
+  if (buffer->length + length > buffer->capacity) {
+    buffer->capacity = (buffer->length + length) * 2;
+    buffer->data = realloc(buffer->data, buffer->capacity);
+    if (!buffer->data) {
+      fprintf(stderr, "vjass-scanner-bench: out of memory\n");
+      exit(1);
+    }
+  }
+  memcpy(buffer->data + buffer->length, s, length);
+  buffer->length += length;
+}
+
+static void append_str(Buffer *buffer, const char *s) { append(buffer, s, strlen(s)); }
+
+static void repeat_until(Buffer *buffer, size_t size, const char *s) {
+  size_t length = strlen(s);
+  while (buffer->length < size) append(buffer, s, length);
+}
+
+// Deeply indented statements: mostly whitespace between short tokens.
+static void make_whitespace(Buffer *buffer, size_t size) {
+  repeat_until(buffer, size, "                set   udg_Index   =   udg_Index   +   1  \t \r\n");
+}
+
+// The same with U+3000 IDEOGRAPHIC SPACE mixed in, to time the iswspace()
+// fallback.
+static void make_unicode_whitespace(Buffer *buffer, size_t size) {
+  repeat_until(buffer, size, "        \xE3\x80\x80  set \xE3\x80\x80 x \xE3\x80\x80 =   y\n");
+}
+
+// Many quoted strings with escapes, next to rawcodes.
+static void make_strings(Buffer *buffer, size_t size) {
+  repeat_until(buffer, size,
+               "    call DisplayTextToPlayer(p, 0, 0, \"|cffffcc00Hero|r \\\"\" + name + \"\\\" has reached "
+               "level \\z   \" + I2S(level) + ' ' + \"and learned \" + GetObjectName('A000'))\n");
+}
+
+// Opens with `head`, fills to `size` with `body` and closes with `tail`:
+// one token pair spanning the whole input.
+static void make_single(Buffer *buffer, size_t size, const char *head, const char *body, const char *tail) {
+  append_str(buffer, head);
+  repeat_until(buffer, size - strlen(tail), body);
+  append_str(buffer, tail);
+}
+
+static void make_block_string(Buffer *buffer, size_t size) {
+  make_single(buffer, size, "s = [==[", "text ] more ]] text ]=] and ]===] not yet\n", "]==]\n");
+}
+
+static void make_lua_comment(Buffer *buffer, size_t size) {
+  make_single(buffer, size, "--[==[\n", "    call Disabled(a[i], b[j]) // ]] ]=] --[[ nested? ]]\n", "]==]\n");
+}
+
+static void make_c_comment(Buffer *buffer, size_t size) {
+  make_single(buffer, size, "/*\n", "    call Disabled(a * b, c / d) // * / ** /* no nesting\n", "*/\n");
+}
+
+// Nothing but almost-terminators inside a level-2 comment.
+static void make_brackets(Buffer *buffer, size_t size) {
+  make_single(buffer, size, "--[==[", "]]]=]=]]=]]]===]", "]==]");
+}
+
+static void make_stars(Buffer *buffer, size_t size) {
+  make_single(buffer, size, "/*", "****************************************************************\n", "*/");
+}
+
+typedef struct {
+  uint64_t calls;
+  uint64_t tokens;
+  uint64_t errors;
+} ScanCount;
+
+static bool is_ascii_space(uint8_t c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+// The end of the rawcode ('a', 'A000') at `position`, or 0. The scanner
+// rejects these so the main lexer's rawcode token gets them; the mock steps
+// over them the same way.
+static uint32_t rawcode_end(const Buffer *input, uint32_t position) {
+  const char *data = input->data;
+  if (data[position] != '\'') return 0;
+  position++;
+  for (int length = 0; length <= 4 && position < input->length; length++) {
+    char c = data[position];
+    if (c == '\'') return length == 1 || length == 4 ? position + 1 : 0;
+    if (c == '\\' || c == '\n' || c == '\r') return 0;
+    position++;
+    while (position < input->length && (data[position] & 0xC0) == 0x80) position++;
+  }
+  return 0;
+}
+
+enum Context {
+  OUTSIDE,
+  IN_STRING,
+  AFTER_STRING_CONTENT,
+  IN_COMMENT,
+};
+
+// Calls the scanner with the valid symbols the parser would pass: the start
+// tokens at every token boundary, then content/end until a string or block
+// comment is closed. A rejected token outside is consumed by the mock, up
+// to the next space, or past the closing quote for a rawcode.
+static ScanCount scan_tokens(void **scanner, const Buffer *input) {
+  static const bool valid[][TOKEN_COUNT] = {
+    [OUTSIDE] = {[BLOCK_COMMENT_START] = true, [STRING_START] = true},
+    [IN_STRING] = {[STRING_CONTENT] = true, [STRING_END] = true},
+    [AFTER_STRING_CONTENT] = {[STRING_END] = true},
+    [IN_COMMENT] = {[BLOCK_COMMENT_CONTENT] = true, [BLOCK_COMMENT_END] = true},
+  };
+  MockLexer lexer;
+  mock_init(&lexer, input->data, input->length);
+  ScanCount count = {0, 0, 0};
+  enum Context context = OUTSIDE;
+  uint32_t position = 0;
+  unsigned empty_tokens = 0;
+
+  while (position < input->length) {
+    mock_reset(&lexer, position);
+    count.calls++;
+    if (tree_sitter_vjass_external_scanner_scan(*scanner, &lexer.lexer, valid[context])) {
+      count.tokens++;
+      uint32_t end = mock_token_end(&lexer);
+      empty_tokens = end == position ? empty_tokens + 1 : 0;
+      position = end;
+      switch (lexer.lexer.result_symbol) {
+        case STRING_START: context = IN_STRING; break;
+        case STRING_CONTENT: context = AFTER_STRING_CONTENT; break;
+        case BLOCK_COMMENT_START: context = IN_COMMENT; break;
+        case STRING_END: case BLOCK_COMMENT_END: context = OUTSIDE; break;
+        default: break;
+      }
+      if (empty_tokens < 2) continue;
+    } else if (context == OUTSIDE) {
+      position = lexer.token_start;
+      uint32_t end = rawcode_end(input, position);
+      if (end) {
+        position = end;
+        continue;
+      }
+      while (position < input->length && !is_ascii_space((uint8_t)input->data[position])) {
+        // Step over the token, including multi-byte characters.
+        position++;
+        while (position < input->length && (input->data[position] & 0xC0) == 0x80) position++;
+      }
+      if (position == lexer.token_start) position++;
+      continue;
+    }
+
+    // Rejected inside a string or comment, or stuck on empty tokens: start
+    // over with a fresh scanner one byte further.
+    count.errors++;
+    tree_sitter_vjass_external_scanner_destroy(*scanner);
+    *scanner = tree_sitter_vjass_external_scanner_create();
+    context = OUTSIDE;
+    empty_tokens = 0;
+    position++;
+  }
+  return count;
+}
+
+typedef struct {
+  const char *name;
+  void (*make)(Buffer *buffer, size_t size);
+} Case;
+
+static const Case cases[] = {
+  {"whitespace", make_whitespace},
+  {"unicode-whitespace", make_unicode_whitespace},
+  {"strings", make_strings},
+  {"block-string", make_block_string},
+  {"lua-comment", make_lua_comment},
+  {"c-comment", make_c_comment},
+  {"brackets", make_brackets},
+  {"stars", make_stars},
+};
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static bool parse_size(const char *s, size_t *out) {
+  char *end;
+  unsigned long long value = strtoull(s, &end, 10);
+  if (end == s) return false;
+  switch (*end) {
+    case 'k': case 'K': value <<= 10; end++; break;
+    case 'm': case 'M': value <<= 20; end++; break;
+    default: break;
+  }
+  *out = (size_t)value;
+  return *end == 0 && value > 0 && value <= UINT32_MAX;
+}
+
+typedef struct {
+  size_t bytes;
+  ScanCount count;
+  double seconds;
+} Timing;
+
+static Timing time_case(const Case *c, size_t size, unsigned repeat) {
+  Buffer input = {NULL, 0, 0};
+  c->make(&input, size);
+  Timing timing = {input.length, {0, 0, 0}, 0};
+  void *scanner = tree_sitter_vjass_external_scanner_create();
+  for (unsigned r = 0; r < repeat; r++) {
+    double start = now();
+    timing.count = scan_tokens(&scanner, &input);
+    double elapsed = now() - start;
+    if (r == 0 || elapsed < timing.seconds) timing.seconds = elapsed;
+  }
+  tree_sitter_vjass_external_scanner_destroy(scanner);
+  free(input.data);
+  return timing;
+}
+
+int main(int argc, char **argv) {
+  size_t size = 8 << 20;
+  unsigned repeat = 5;
+  double max_scaling = 3.0;
+  for (int i = 1; i < argc; i++) {
+    const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+    if (strcmp(argv[i], "--size") == 0 && value && parse_size(value, &size) && size >= 1024) {
+      i++;
+    } else if (strcmp(argv[i], "--repeat") == 0 && value && atoi(value) > 0) {
+      repeat = (unsigned)atoi(value);
+      i++;
+    } else if (strcmp(argv[i], "--max-scaling") == 0 && value && atof(value) > 0) {
+      max_scaling = atof(value);
+      i++;
+    } else {
+      fprintf(stderr, "usage: vjass-scanner-bench [--size 8M] [--repeat 5] [--max-scaling 3]\n");
+      return 2;
+    }
+  }
+
+#ifdef TREE_SITTER_VJASS_LIBC_WHITESPACE
+  printf("whitespace: iswspace()\n");
+#else
+  printf("whitespace: ASCII table\n");
+#endif
+  printf("%-20s %12s %10s %10s %8s %10s %10s %8s\n", "case", "bytes", "calls", "tokens", "errors", "ns/byte",
+         "ns/call", "scaling");
+
+  int status = 0;
+  for (size_t c = 0; c < sizeof(cases) / sizeof(*cases); c++) {
+    Timing full = time_case(&cases[c], size, repeat);
+    Timing small = time_case(&cases[c], size / 8, repeat);
+    double ns_per_byte = full.seconds * 1e9 / (double)full.bytes;
+    double scaling = small.seconds > 0 ? ns_per_byte / (small.seconds * 1e9 / (double)small.bytes) : 1.0;
+    bool superlinear = scaling > max_scaling;
+
+    printf("%-20s %12zu %10llu %10llu %8llu %10.3f %10.2f %8.2f%s\n", cases[c].name, full.bytes,
+           (unsigned long long)full.count.calls, (unsigned long long)full.count.tokens,
+           (unsigned long long)full.count.errors, ns_per_byte,
+           full.count.calls ? full.seconds * 1e9 / (double)full.count.calls : 0.0, scaling,
+           superlinear ? "  SUPERLINEAR" : "");
+    fflush(stdout);
+    if (superlinear) status = 1;
+  }
+  return status;
+}
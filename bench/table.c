@@ -0,0 +1,223 @@
+// Tree traversal harness: node API against the flat node table.
+//
+//   vjass-table-bench [--repeat N] FILE...
+//
+// Parses every file once, then visits every node of the tree in preorder
+// in five ways and reports the best of --repeat runs of each:
+//
+//   child(i)     ts_node_child(node, i) for every i, as downstream
+//                analysers do; O(i) per call, so quadratic in the number of
+//                children of a node
+//   cursor       a TSTreeCursor walk
+//   table build  tree_sitter_vjass_node_table_build(), itself a cursor walk
+//   table links  the table through its first_child / next_sibling links
+//   table scan   the table as arrays, index 0 to count
+//
+// Every walk sums the same checksum over symbol, flags and byte range; a
+// walk that disagrees with the cursor walk is reported and fails the run.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#include <tree_sitter/tree-sitter-vjass-table.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+typedef struct {
+  uint64_t nodes;
+  uint64_t checksum;
+} Visit;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static inline void visit_add(Visit *visit, uint16_t symbol, bool named, uint32_t start, uint32_t end) {
+  visit->nodes++;
+  visit->checksum += (uint64_t)symbol * (end - start) + named;
+}
+
+static inline void visit_node(Visit *visit, TSNode node) {
+  visit_add(visit, ts_node_symbol(node), ts_node_is_named(node), ts_node_start_byte(node), ts_node_end_byte(node));
+}
+
+static inline void visit_row(Visit *visit, const TSVjassNodeTable *table, uint32_t i) {
+  visit_add(visit, table->symbol[i], table->flags[i] & TREE_SITTER_VJASS_NODE_NAMED, table->start_byte[i],
+            table->end_byte[i]);
+}
+
+// Grows `*stack` to hold `size` entries of `item` bytes.
+static void *reserve(void *stack, size_t *capacity, size_t size, size_t item) {
+  if (size <= *capacity) return stack;
+  while (*capacity < size) *capacity = *capacity ? *capacity * 2 : 1024;
+  return realloc(stack, *capacity * item);
+}
+
+static Visit walk_children(const TSTree *tree) {
+  Visit visit = {0, 0};
+  size_t capacity = 0, size = 0;
+  TSNode *stack = reserve(NULL, &capacity, 1, sizeof(TSNode));
+  stack[size++] = ts_tree_root_node(tree);
+  while (size > 0) {
+    TSNode node = stack[--size];
+    visit_node(&visit, node);
+    uint32_t count = ts_node_child_count(node);
+    stack = reserve(stack, &capacity, size + count, sizeof(TSNode));
+    for (uint32_t i = count; i-- > 0;) stack[size++] = ts_node_child(node, i);
+  }
+  free(stack);
+  return visit;
+}
+
+static Visit walk_cursor(const TSTree *tree) {
+  Visit visit = {0, 0};
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    visit_node(&visit, ts_tree_cursor_current_node(&cursor));
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return visit;
+      }
+    }
+  }
+}
+
+static Visit walk_links(const TSVjassNodeTable *table) {
+  Visit visit = {0, 0};
+  size_t capacity = 0, size = 0;
+  uint32_t *stack = reserve(NULL, &capacity, 1, sizeof(uint32_t));
+  stack[size++] = 0;
+  while (size > 0) {
+    // Follow the first-child chain, leaving siblings for later.
+    for (uint32_t node = stack[--size]; node != TREE_SITTER_VJASS_NONE; node = table->first_child[node]) {
+      visit_row(&visit, table, node);
+      if (table->next_sibling[node] != TREE_SITTER_VJASS_NONE) {
+        stack = reserve(stack, &capacity, size + 1, sizeof(uint32_t));
+        stack[size++] = table->next_sibling[node];
+      }
+    }
+  }
+  free(stack);
+  return visit;
+}
+
+static Visit walk_scan(const TSVjassNodeTable *table) {
+  Visit visit = {0, 0};
+  for (uint32_t i = 0; i < table->count; i++) visit_row(&visit, table, i);
+  return visit;
+}
+
+typedef enum { WALK_CHILDREN, WALK_CURSOR, WALK_BUILD, WALK_LINKS, WALK_SCAN, WALK_COUNT } Walk;
+
+static const char *const WALK_NAMES[WALK_COUNT] = {"child(i)", "cursor", "table build", "table links", "table scan"};
+
+static Visit run(Walk walk, const TSTree *tree, const TSVjassNodeTable *table) {
+  switch (walk) {
+    case WALK_CHILDREN:
+      return walk_children(tree);
+    case WALK_CURSOR:
+      return walk_cursor(tree);
+    case WALK_BUILD: {
+      TSVjassNodeTable built;
+      Visit visit = {0, 0};
+      if (tree_sitter_vjass_node_table_build(tree, &built)) {
+        visit.nodes = built.count;
+        tree_sitter_vjass_node_table_delete(&built);
+      }
+      return visit;
+    }
+    case WALK_LINKS:
+      return walk_links(table);
+    default:
+      return walk_scan(table);
+  }
+}
+
+static int usage(void) {
+  fprintf(stderr, "usage: vjass-table-bench [--repeat N] FILE...\n");
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  unsigned repeat = 5;
+  int first = 1;
+  for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+    const char *value = first + 1 < argc ? argv[first + 1] : NULL;
+    if (!value) return usage();
+    if (strcmp(argv[first], "--repeat") == 0) {
+      repeat = (unsigned)atoi(value);
+    } else {
+      return usage();
+    }
+    first++;
+  }
+  if (first >= argc || repeat == 0) return usage();
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, tree_sitter_vjass());
+
+  printf("%-32s %-12s %12s %10s %10s %10s %10s %6s\n", "file", "walk", "nodes", "ms", "ns/node", "vs cursor",
+         "table MB", "same");
+
+  int status = 0;
+  for (int i = first; i < argc; i++) {
+    TSVjassMappedFile file;
+    if (!tree_sitter_vjass_map_file(&file, argv[i])) {
+      perror(argv[i]);
+      status = 1;
+      continue;
+    }
+    TSTree *tree = ts_parser_parse_string(parser, NULL, file.data, (uint32_t)file.length);
+    TSVjassNodeTable table;
+    if (!tree || !tree_sitter_vjass_node_table_build(tree, &table)) {
+      fprintf(stderr, "%s: parse failed\n", argv[i]);
+      ts_tree_delete(tree);
+      tree_sitter_vjass_unmap_file(&file);
+      status = 1;
+      continue;
+    }
+    double table_mb = (double)tree_sitter_vjass_node_table_size(table.count) / (1024.0 * 1024.0);
+
+    double times[WALK_COUNT];
+    Visit visits[WALK_COUNT];
+    for (unsigned w = 0; w < WALK_COUNT; w++) {
+      for (unsigned r = 0; r < repeat; r++) {
+        double start = now();
+        Visit visit = run((Walk)w, tree, &table);
+        double elapsed = now() - start;
+        if (r == 0 || elapsed < times[w]) times[w] = elapsed;
+        visits[w] = visit;
+      }
+    }
+
+    const Visit *expected = &visits[WALK_CURSOR];
+    for (unsigned w = 0; w < WALK_COUNT; w++) {
+      // The build walk only counts its nodes.
+      bool same = w == WALK_BUILD ? visits[w].nodes == expected->nodes
+                                  : visits[w].nodes == expected->nodes && visits[w].checksum == expected->checksum;
+      if (!same) status = 1;
+      printf("%-32s %-12s %12llu %10.3f %10.2f %10.2f %10.2f %6s\n", argv[i], WALK_NAMES[w],
+             (unsigned long long)visits[w].nodes, times[w] * 1e3, times[w] * 1e9 / (double)expected->nodes,
+             times[WALK_CURSOR] / times[w], table_mb, same ? "yes" : "NO");
+    }
+    fflush(stdout);
+
+    tree_sitter_vjass_node_table_delete(&table);
+    ts_tree_delete(tree);
+    tree_sitter_vjass_unmap_file(&file);
+  }
+
+  ts_parser_delete(parser);
+  return status;
+}
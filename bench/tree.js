@@ -0,0 +1,170 @@
+// Whole-tree export to JS: typed arrays against an object per node.
+//
+//   node --expose-gc bench/tree.js [--repeat N] FILE...
+//
+// Every file is parsed and every node visited once per approach:
+//
+//   objects      Parser.parse() from the `tree-sitter` package and a walk
+//                over node.children, which creates a JS object per node;
+//                skipped when the package is not installed
+//   materialize  exportTree() turned into one plain object per node
+//                ({ type, startByte, endByte, children }), as a JSON-style
+//                export would hand it over
+//   walkTable    exportTree() and walkTable() over the typed arrays
+//   scan         exportTree() and a plain loop over the arrays
+//
+// Reports the best of --repeat runs (parse included), ns per node, and how
+// much the JS heap grew during the run (with --expose-gc). Every approach
+// must count the same nodes and bytes; a mismatch fails the run.
+
+"use strict";
+
+const fs = require("node:fs");
+const { performance } = require("node:perf_hooks");
+
+function usage() {
+  console.error("usage: node --expose-gc bench/tree.js [--repeat N] FILE...");
+  process.exit(2);
+}
+
+let repeat = 5;
+const files = [];
+for (let i = 2; i < process.argv.length; i++) {
+  const arg = process.argv[i];
+  if (arg === "--repeat") {
+    repeat = Number(process.argv[++i]);
+    if (!Number.isInteger(repeat) || repeat < 1) usage();
+  } else if (arg.startsWith("--")) {
+    usage();
+  } else {
+    files.push(arg);
+  }
+}
+if (files.length === 0) usage();
+
+const vjass = require("..");
+if (!vjass.exportTree) {
+  console.error("bench/tree.js: the addon was built without the runtime sources");
+  process.exit(1);
+}
+let Parser = null;
+try {
+  Parser = require("tree-sitter");
+} catch (_) {}
+
+function objects(parser, source) {
+  const visit = { nodes: 0, bytes: 0 };
+  const walk = (node) => {
+    visit.nodes++;
+    visit.bytes += node.endIndex - node.startIndex;
+    for (const child of node.children) walk(child);
+  };
+  walk(parser.parse(source).rootNode);
+  return visit;
+}
+
+function materialize(source) {
+  const table = vjass.exportTree(source);
+  const { symbolNames } = vjass;
+  const nodes = new Array(table.count);
+  for (let i = 0; i < table.count; i++) {
+    const node = {
+      type: symbolNames[table.symbol[i]],
+      startByte: table.startByte[i],
+      endByte: table.endByte[i],
+      children: [],
+    };
+    nodes[i] = node;
+    if (i > 0) nodes[table.parent[i]].children.push(node);
+  }
+  const visit = { nodes: 0, bytes: 0 };
+  const walk = (node) => {
+    visit.nodes++;
+    visit.bytes += node.endByte - node.startByte;
+    for (const child of node.children) walk(child);
+  };
+  walk(nodes[0]);
+  return visit;
+}
+
+function walkTable(source) {
+  const table = vjass.exportTree(source);
+  const { startByte, endByte } = table;
+  const visit = { nodes: 0, bytes: 0 };
+  vjass.walkTable(table, (i) => {
+    visit.nodes++;
+    visit.bytes += endByte[i] - startByte[i];
+  });
+  return visit;
+}
+
+function scan(source) {
+  const table = vjass.exportTree(source);
+  const { startByte, endByte } = table;
+  const visit = { nodes: table.count, bytes: 0 };
+  for (let i = 0; i < table.count; i++) visit.bytes += endByte[i] - startByte[i];
+  return visit;
+}
+
+function measure(body) {
+  let best;
+  for (let r = 0; r < repeat; r++) {
+    if (global.gc) global.gc();
+    const heap = process.memoryUsage().heapUsed;
+    const start = performance.now();
+    const visit = body();
+    const ms = performance.now() - start;
+    const heapMb = (process.memoryUsage().heapUsed - heap) / (1024 * 1024);
+    if (!best || ms < best.ms) best = { ms, heapMb, visit };
+  }
+  return best;
+}
+
+console.log(
+  [
+    "file".padEnd(32),
+    "approach".padEnd(12),
+    "nodes".padStart(10),
+    "ms".padStart(10),
+    "ns/node".padStart(10),
+    "heap MB".padStart(10),
+    "same".padStart(6),
+  ].join(" "),
+);
+
+let status = 0;
+for (const file of files) {
+  // Strings, since the `tree-sitter` package does not take Buffers.
+  const source = fs.readFileSync(file, "utf8");
+  const approaches = [];
+  if (Parser) {
+    const parser = new Parser();
+    parser.setLanguage(vjass);
+    approaches.push(["objects", () => objects(parser, source)]);
+  }
+  approaches.push(
+    ["materialize", () => materialize(source)],
+    ["walkTable", () => walkTable(source)],
+    ["scan", () => scan(source)],
+  );
+
+  let expected;
+  for (const [name, body] of approaches) {
+    const run = measure(body);
+    expected ||= run.visit;
+    const same = run.visit.nodes === expected.nodes && run.visit.bytes === expected.bytes;
+    if (!same) status = 1;
+    console.log(
+      [
+        file.padEnd(32),
+        name.padEnd(12),
+        String(run.visit.nodes).padStart(10),
+        run.ms.toFixed(2).padStart(10),
+        ((run.ms * 1e6) / run.visit.nodes).toFixed(1).padStart(10),
+        (global.gc ? run.heapMb.toFixed(2) : "-").padStart(10),
+        (same ? "yes" : "NO").padStart(6),
+      ].join(" "),
+    );
+  }
+}
+process.exitCode = status;
@@ -0,0 +1,205 @@
+// C++ visitor harness: tree-sitter-vjass.hpp against a hand-written cursor
+// loop.
+//
+//   vjass-visitor-bench [--repeat N] FILE...
+//
+// Parses every file once through a ParserPool lease, then counts a handful
+// of node kinds over the whole tree in two ways and reports the best of
+// --repeat runs of each:
+//
+//   cursor       a TSTreeCursor loop with a switch on ts_node_symbol()
+//   visitor      tree_sitter::vjass::Visitor with one enter_<kind> hook per
+//                counted kind
+//
+// Both must count the same nodes per kind; a mismatch fails the run.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#include <tree_sitter/tree-sitter-vjass.hpp>
+
+namespace {
+
+enum Kind {
+  KIND_STRUCT,
+  KIND_GLOBALS,
+  KIND_LOOP,
+  KIND_EXPR,
+  KIND_VAR_STMT,
+  KIND_STRING,
+  KIND_SET_STATEMENT,
+  KIND_CALL_STATEMENT,
+  KIND_FUNCTION,
+  KIND_FUNCTION_CALL,
+  KIND_COMMENT,
+  KIND_ID,
+  KIND_OTHER,
+  KIND_COUNT
+};
+
+struct Visit {
+  uint64_t counts[KIND_COUNT] = {};
+
+  bool operator==(const Visit &other) const { return std::memcmp(counts, other.counts, sizeof(counts)) == 0; }
+};
+
+double Now() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Visit WalkCursor(const tree_sitter::vjass::Tree &tree) {
+  Visit visit;
+  TSTreeCursor cursor = ts_tree_cursor_new(tree.root());
+  for (;;) {
+    switch (ts_node_symbol(ts_tree_cursor_current_node(&cursor))) {
+      case TREE_SITTER_VJASS_SYM_STRUCT:
+        visit.counts[KIND_STRUCT]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_GLOBALS:
+        visit.counts[KIND_GLOBALS]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_LOOP:
+        visit.counts[KIND_LOOP]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_EXPR:
+        visit.counts[KIND_EXPR]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_VAR_STMT:
+        visit.counts[KIND_VAR_STMT]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_STRING:
+        visit.counts[KIND_STRING]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_SET_STATEMENT:
+        visit.counts[KIND_SET_STATEMENT]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_CALL_STATEMENT:
+        visit.counts[KIND_CALL_STATEMENT]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_FUNCTION:
+        visit.counts[KIND_FUNCTION]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_FUNCTION_CALL:
+        visit.counts[KIND_FUNCTION_CALL]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_COMMENT:
+        visit.counts[KIND_COMMENT]++;
+        break;
+      case TREE_SITTER_VJASS_SYM_ID:
+        visit.counts[KIND_ID]++;
+        break;
+      default:
+        visit.counts[KIND_OTHER]++;
+        break;
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return visit;
+      }
+    }
+  }
+}
+
+struct Counter : tree_sitter::vjass::Visitor<Counter> {
+  Visit visit;
+
+  bool enter_struct(TSNode) { return Count(KIND_STRUCT); }
+  bool enter_globals(TSNode) { return Count(KIND_GLOBALS); }
+  bool enter_loop(TSNode) { return Count(KIND_LOOP); }
+  bool enter_expr(TSNode) { return Count(KIND_EXPR); }
+  bool enter_var_stmt(TSNode) { return Count(KIND_VAR_STMT); }
+  bool enter_string(TSNode) { return Count(KIND_STRING); }
+  bool enter_set_statement(TSNode) { return Count(KIND_SET_STATEMENT); }
+  bool enter_call_statement(TSNode) { return Count(KIND_CALL_STATEMENT); }
+  bool enter_function(TSNode) { return Count(KIND_FUNCTION); }
+  bool enter_function_call(TSNode) { return Count(KIND_FUNCTION_CALL); }
+  bool enter_comment(TSNode) { return Count(KIND_COMMENT); }
+  bool enter_id(TSNode) { return Count(KIND_ID); }
+  bool enter_node(TSNode) { return Count(KIND_OTHER); }
+
+  bool Count(Kind kind) {
+    visit.counts[kind]++;
+    return true;
+  }
+};
+
+Visit WalkVisitor(const tree_sitter::vjass::Tree &tree) {
+  Counter counter;
+  counter.walk(tree);
+  return counter.visit;
+}
+
+int Usage() {
+  std::fprintf(stderr, "usage: vjass-visitor-bench [--repeat N] FILE...\n");
+  return 2;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  unsigned repeat = 5;
+  int first = 1;
+  for (; first < argc && std::strncmp(argv[first], "--", 2) == 0; first++) {
+    const char *value = first + 1 < argc ? argv[first + 1] : nullptr;
+    if (!value) return Usage();
+    if (std::strcmp(argv[first], "--repeat") == 0) {
+      repeat = static_cast<unsigned>(std::atoi(value));
+    } else {
+      return Usage();
+    }
+    first++;
+  }
+  if (first >= argc || repeat == 0) return Usage();
+
+  tree_sitter::vjass::ParserPool pool(1);
+  std::printf("%-32s %-8s %12s %10s %10s %10s %6s\n", "file", "walk", "nodes", "ms", "ns/node", "vs cursor", "same");
+
+  int status = 0;
+  for (int i = first; i < argc; i++) {
+    TSVjassMappedFile file;
+    if (!tree_sitter_vjass_map_file(&file, argv[i])) {
+      std::perror(argv[i]);
+      status = 1;
+      continue;
+    }
+    tree_sitter::vjass::Tree tree = pool.acquire()->parse({file.data, file.length});
+    tree_sitter_vjass_unmap_file(&file);
+    if (!tree) {
+      std::fprintf(stderr, "%s: parse failed\n", argv[i]);
+      status = 1;
+      continue;
+    }
+    uint32_t nodes = ts_node_descendant_count(tree.root());
+
+    struct Row {
+      const char *name;
+      Visit (*walk)(const tree_sitter::vjass::Tree &);
+      double time;
+      Visit visit;
+    } rows[] = {{"cursor", WalkCursor, 0, {}}, {"visitor", WalkVisitor, 0, {}}};
+    for (Row &row : rows) {
+      for (unsigned r = 0; r < repeat; r++) {
+        double start = Now();
+        row.visit = row.walk(tree);
+        double elapsed = Now() - start;
+        if (r == 0 || elapsed < row.time) row.time = elapsed;
+      }
+    }
+
+    for (const Row &row : rows) {
+      bool same = row.visit == rows[0].visit;
+      if (!same) status = 1;
+      std::printf("%-32s %-8s %12u %10.3f %10.2f %10.2f %6s\n", argv[i], row.name, nodes, row.time * 1e3,
+                  row.time * 1e9 / nodes, rows[0].time / row.time, same ? "yes" : "NO");
+    }
+    std::fflush(stdout);
+  }
+  return status;
+}
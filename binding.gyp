@@ -7,18 +7,27 @@
       ],
       "include_dirs": [
         "src",
+        "bindings/c",
       ],
       "sources": [
         "bindings/node/binding.cc",
         "src/parser.c",
       ],
       "variables": {
-        "has_scanner": "<!(node -p \"fs.existsSync('src/scanner.c')\")"
+        "has_scanner": "<!(node -p \"fs.existsSync('src/scanner.c')\")",
+        # The runtime sources vendored by the `tree-sitter` package, compiled
+        # into this addon when present for the helpers that parse natively.
+        "tree_sitter_lib": "<!(node -p \"try { const lib = path.join(path.dirname(require.resolve('tree-sitter/package.json')), 'vendor', 'tree-sitter', 'lib'); fs.existsSync(path.join(lib, 'src', 'lib.c')) ? lib : '' } catch (_) { '' }\")"
       },
       "conditions": [
         ["has_scanner=='true'", {
           "sources+": ["src/scanner.c"],
         }],
+        ["tree_sitter_lib!=''", {
+          "sources+": ["<(tree_sitter_lib)/src/lib.c"],
+          "include_dirs+": ["<(tree_sitter_lib)/include"],
+          "defines+": ["TREE_SITTER_VJASS_RUNTIME", "_POSIX_C_SOURCE=200112L", "_DEFAULT_SOURCE"],
+        }],
         ["OS!='win'", {
           "cflags_c": [
             "-std=c11",
@@ -0,0 +1,78 @@
+// Tests of tree-sitter-vjass-arena.h. This file defines the arena;
+// test_arena_other.c only includes the header, like any other file of a
+// program that uses it.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <pthread.h>
+
+#define TREE_SITTER_VJASS_ARENA_IMPLEMENTATION
+#include <tree_sitter/tree-sitter-vjass-arena.h>
+
+// In test_arena_other.c.
+TSVjassArenaStats other_file_stats(void);
+void other_file_reset(void);
+
+static int failures = 0;
+
+#define EXPECT(cond)                                                          \
+  do {                                                                        \
+    if (!(cond)) {                                                            \
+      fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__, #cond);     \
+      failures++;                                                             \
+    }                                                                         \
+  } while (0)
+
+static void test_reuse(void) {
+  void *a = tree_sitter_vjass_arena_malloc(100);
+  tree_sitter_vjass_arena_free(a);
+  void *b = tree_sitter_vjass_arena_malloc(120);
+  EXPECT(a == b);
+  EXPECT(tree_sitter_vjass_arena_stats().reused == 1);
+  b = tree_sitter_vjass_arena_realloc(b, 1000);
+  tree_sitter_vjass_arena_free(b);
+  EXPECT(tree_sitter_vjass_arena_stats().cached_bytes == 128 + 1024);
+  tree_sitter_vjass_arena_reset();
+  EXPECT(tree_sitter_vjass_arena_stats().cached_bytes == 0);
+}
+
+// Another file sees, and resets, the same per-thread state.
+static void test_one_definition(void) {
+  tree_sitter_vjass_arena_free(tree_sitter_vjass_arena_malloc(16));
+  EXPECT(other_file_stats().cached_bytes == 16);
+  EXPECT(other_file_stats().system_allocs == tree_sitter_vjass_arena_stats().system_allocs);
+  other_file_reset();
+  EXPECT(tree_sitter_vjass_arena_stats().cached_bytes == 0);
+}
+
+static void *worker(void *result) {
+  void *blocks[64];
+  for (int i = 0; i < 64; i++) blocks[i] = tree_sitter_vjass_arena_malloc((size_t)16 << (i % 8));
+  for (int i = 0; i < 64; i++) tree_sitter_vjass_arena_free(blocks[i]);
+  *(size_t *)result = tree_sitter_vjass_arena_stats().cached_bytes;
+  return NULL; // the thread-exit destructor frees what is cached
+}
+
+// Threads cache blocks of their own and exit with them cached; under a
+// leak checker, none of them may be left over.
+static void test_thread_exit(void) {
+  pthread_t threads[8];
+  size_t cached[8];
+  for (int i = 0; i < 8; i++) EXPECT(pthread_create(&threads[i], NULL, worker, &cached[i]) == 0);
+  for (int i = 0; i < 8; i++) {
+    pthread_join(threads[i], NULL);
+    EXPECT(cached[i] > 0);
+  }
+  EXPECT(tree_sitter_vjass_arena_stats().cached_bytes == 0);
+}
+
+int main(void) {
+  test_reuse();
+  test_one_definition();
+  test_thread_exit();
+  if (failures) fprintf(stderr, "%d failed\n", failures);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,10 @@
+// The second file of test_arena: declarations only.
+
+#include <tree_sitter/tree-sitter-vjass-arena.h>
+
+TSVjassArenaStats other_file_stats(void);
+void other_file_reset(void);
+
+TSVjassArenaStats other_file_stats(void) { return tree_sitter_vjass_arena_stats(); }
+
+void other_file_reset(void) { tree_sitter_vjass_arena_reset(); }
@@ -0,0 +1,67 @@
+// Tests of tree-sitter-vjass.hpp; run by ctest when the tree-sitter
+// runtime and a C++ compiler are around.
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <tree_sitter/tree-sitter-vjass.hpp>
+
+namespace {
+
+int failures = 0;
+
+#define EXPECT(cond)                                                     \
+  do {                                                                   \
+    if (!(cond)) {                                                       \
+      std::fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__, #cond); \
+      failures++;                                                        \
+    }                                                                    \
+  } while (0)
+
+struct Count : tree_sitter::vjass::Visitor<Count> {
+  size_t entered = 0, left = 0, ids = 0;
+  bool enter_id(TSNode node) {
+    ids++;
+    return enter_node(node);
+  }
+  bool enter_node(TSNode) {
+    entered++;
+    return true;
+  }
+  void leave_node(TSNode) { left++; }
+};
+
+void TestEmptyTree() {
+  tree_sitter::vjass::Tree tree;
+  EXPECT(!tree);
+  EXPECT(ts_node_is_null(tree.root()));
+  EXPECT(!tree.has_error());
+  EXPECT(!tree.copy());
+
+  Count count;
+  count.walk(tree);
+  count.walk(TSNode{});
+  EXPECT(count.entered == 0 && count.left == 0);
+}
+
+void TestWalk() {
+  tree_sitter::vjass::Parser parser;
+  tree_sitter::vjass::Tree tree = parser.parse("globals\nendglobals\n");
+  EXPECT(tree);
+  EXPECT(!ts_node_is_null(tree.root()));
+  EXPECT(!tree.has_error());
+
+  Count count;
+  count.walk(tree);
+  EXPECT(count.entered > 0);
+  EXPECT(count.left == count.entered);
+}
+
+} // namespace
+
+int main() {
+  TestEmptyTree();
+  TestWalk();
+  if (failures) std::fprintf(stderr, "%d failed\n", failures);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
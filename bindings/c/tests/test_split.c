@@ -0,0 +1,123 @@
+// Tests of tree_sitter_vjass_split() in tree-sitter-vjass-split.h; the
+// splitter itself needs no runtime.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/tree-sitter-vjass-split.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+// After api.h: the definition of TSLanguage, to build one that cannot load.
+#include <tree_sitter/parser.h>
+
+static int failures = 0;
+
+#define EXPECT(cond)                                                          \
+  do {                                                                        \
+    if (!(cond)) {                                                            \
+      fprintf(stderr, "%s:%d: expected %s\n", __FILE__, __LINE__, #cond);     \
+      failures++;                                                             \
+    }                                                                         \
+  } while (0)
+
+// Splits `source` into up to `max_ranges` chunks and checks that they cover
+// it in order, each starting on a line. Returns the number of chunks.
+static uint32_t split(const char *source, TSRange *ranges, uint32_t max_ranges) {
+  uint32_t length = (uint32_t)strlen(source);
+  uint32_t count = tree_sitter_vjass_split(source, length, ranges, max_ranges);
+  EXPECT(count >= 1 && count <= max_ranges);
+  uint32_t byte = 0, row = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    EXPECT(ranges[i].start_byte == byte);
+    EXPECT(ranges[i].start_point.row == row && ranges[i].start_point.column == 0);
+    EXPECT(byte == 0 || source[byte - 1] == '\n');
+    for (uint32_t j = ranges[i].start_byte; j < ranges[i].end_byte; j++) row += source[j] == '\n';
+    EXPECT(ranges[i].end_point.row == row);
+    byte = ranges[i].end_byte;
+  }
+  EXPECT(byte == length);
+  return count;
+}
+
+// Whether some chunk starts at `text` in `source`.
+static int cut_at(const char *source, const TSRange *ranges, uint32_t count, const char *text) {
+  uint32_t byte = (uint32_t)(strstr(source, text) - source);
+  for (uint32_t i = 0; i < count; i++) {
+    if (ranges[i].start_byte == byte) return 1;
+  }
+  return 0;
+}
+
+static void test_top_level_cuts(void) {
+  const char *source =
+      "globals\n"
+      "    integer a = 1\n"
+      "endglobals\n"
+      "function A takes nothing returns nothing\n"
+      "endfunction\n"
+      "constant function B takes nothing returns nothing\n"
+      "endfunction\n"
+      "struct C\n"
+      "endstruct\n";
+  TSRange ranges[8];
+  uint32_t count = split(source, ranges, 8);
+  EXPECT(count == 4);
+  EXPECT(cut_at(source, ranges, count, "function A"));
+  EXPECT(cut_at(source, ranges, count, "constant function B"));
+  EXPECT(cut_at(source, ranges, count, "struct C"));
+  EXPECT(split(source, ranges, 1) == 1);
+}
+
+// Lines inside block strings and block comments are not declarations,
+// whatever they start with.
+static void test_long_brackets(void) {
+  const char *source =
+      "function A takes nothing returns nothing\n"
+      "    local string s = [==[\n"
+      "function NotOne takes nothing returns nothing\n"
+      "]] ]=] still inside\n"
+      "endfunction\n"
+      "]==]\n"
+      "    set ids[1] = s\n"
+      "endfunction\n"
+      "--[=[\n"
+      "struct NotOne\n"
+      "]=]\n"
+      "function B takes nothing returns nothing\n"
+      "    local string t = [[\n"
+      "globals\n"
+      "]]\n"
+      "endfunction\n"
+      "function C takes nothing returns nothing\n"
+      "endfunction\n";
+  TSRange ranges[16];
+  uint32_t count = split(source, ranges, 16);
+  EXPECT(count == 3);
+  EXPECT(cut_at(source, ranges, count, "function B"));
+  EXPECT(cut_at(source, ranges, count, "function C"));
+  EXPECT(!cut_at(source, ranges, count, "function NotOne"));
+  EXPECT(!cut_at(source, ranges, count, "struct NotOne"));
+}
+
+// A language the runtime cannot load fails before anything is split, and
+// the empty result is safe to query and delete.
+static void test_unloadable_language(void) {
+  TSLanguage language = *tree_sitter_vjass();
+  language.abi_version = 1;
+  const char *source = "function A takes nothing returns nothing\nendfunction\n";
+  TSVjassChunkedTree chunked;
+  EXPECT(!tree_sitter_vjass_parse_chunked(&language, source, (uint32_t)strlen(source), 2, 0, &chunked));
+  EXPECT(chunked.count == 0 && !chunked.trees);
+  EXPECT(tree_sitter_vjass_chunked_child_count(&chunked) == 0);
+  EXPECT(!tree_sitter_vjass_chunked_has_error(&chunked));
+  EXPECT(ts_node_is_null(tree_sitter_vjass_chunked_descendant(&chunked, 0, 1)));
+  tree_sitter_vjass_chunked_tree_delete(&chunked);
+}
+
+int main(void) {
+  test_top_level_cuts();
+  test_long_brackets();
+  test_unloadable_language();
+  if (failures) fprintf(stderr, "%d failed\n", failures);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,289 @@
+#ifndef TREE_SITTER_VJASS_ARENA_H_
+#define TREE_SITTER_VJASS_ARENA_H_
+
+// Per-thread recycling allocator for the tree-sitter runtime.
+//
+// Parsing many small files back to back allocates and frees the same
+// handful of sizes over and over (subtrees, stack nodes, lexer and reduce
+// buffers). With the arena installed every small block is tagged with a
+// size class, and a freed block goes onto the freeing thread's free list
+// for that class instead of back to malloc. The next parse then reuses it
+// without taking the libc allocator lock. Blocks larger than the biggest
+// class go straight to malloc.
+//
+// Install it once, before the first parser is created, and never swap it
+// out again while blocks allocated through it are alive:
+//
+//   tree_sitter_vjass_arena_install();
+//   ... parse, delete trees ...
+//   tree_sitter_vjass_arena_reset();   // drop this thread's cached blocks
+//
+// A thread's cached blocks go back to free() when the thread exits, so
+// short-lived worker threads do not leak them; reset() does the same
+// earlier, on demand.
+//
+// The hooks are process-wide (ts_set_allocator). Build the grammar with
+// TREE_SITTER_REUSE_ALLOCATOR so the external scanner's ts_malloc/ts_free
+// go through them as well.
+//
+// The free lists are one per thread for the whole program, so exactly one
+// C or C++ file must define the arena:
+//
+//   #define TREE_SITTER_VJASS_ARENA_IMPLEMENTATION
+//   #include <tree_sitter/tree-sitter-vjass-arena.h>
+//
+// Every other file includes the header as usual and gets declarations
+// only. Include <tree_sitter/api.h> and link the tree-sitter runtime (and
+// pthreads outside Windows).
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+
+#ifdef TREE_SITTER_VJASS_ARENA_IMPLEMENTATION
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TREE_SITTER_VJASS_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus)
+#define TREE_SITTER_VJASS_THREAD_LOCAL thread_local
+#else
+#define TREE_SITTER_VJASS_THREAD_LOCAL _Thread_local
+#endif
+
+// Size classes are powers of two from 16 bytes to 16 KiB.
+#define TREE_SITTER_VJASS_ARENA_MIN_SHIFT 4
+#define TREE_SITTER_VJASS_ARENA_CLASSES 11
+#define TREE_SITTER_VJASS_ARENA_LARGE TREE_SITTER_VJASS_ARENA_CLASSES
+
+// Cached (free) bytes a thread keeps before handing blocks back to free().
+#ifndef TREE_SITTER_VJASS_ARENA_MAX_CACHED
+#define TREE_SITTER_VJASS_ARENA_MAX_CACHED ((size_t)64 << 20)
+#endif
+
+typedef struct {
+  uint64_t system_allocs; // blocks obtained from malloc
+  uint64_t reused;        // allocations served from a free list
+  size_t cached_bytes;    // bytes sitting on this thread's free lists
+} TSVjassArenaStats;
+
+// Sits in front of every block; padding it to max_align_t keeps the
+// payload aligned for anything malloc would align.
+typedef union TSVjassArenaHeader {
+  struct {
+    uint32_t size_class;
+    union TSVjassArenaHeader *next;
+  } block;
+  max_align_t align;
+} TSVjassArenaHeader;
+
+typedef struct {
+  TSVjassArenaHeader *free_lists[TREE_SITTER_VJASS_ARENA_CLASSES];
+  TSVjassArenaStats stats;
+  int registered; // the thread-exit destructor knows this thread
+  int exiting;    // the destructor ran; cache nothing more
+} TSVjassArena;
+
+static inline uint32_t tree_sitter_vjass_arena_class(size_t size) {
+  uint32_t size_class = 0;
+  size_t capacity = (size_t)1 << TREE_SITTER_VJASS_ARENA_MIN_SHIFT;
+  while (capacity < size && size_class < TREE_SITTER_VJASS_ARENA_LARGE) {
+    capacity <<= 1;
+    size_class++;
+  }
+  return size_class;
+}
+
+static inline size_t tree_sitter_vjass_arena_capacity(uint32_t size_class) {
+  return (size_t)1 << (size_class + TREE_SITTER_VJASS_ARENA_MIN_SHIFT);
+}
+
+// The allocator hooks, for ts_set_allocator() or as the backend of
+// tree-sitter-vjass-stats.h.
+void *tree_sitter_vjass_arena_malloc(size_t size);
+void *tree_sitter_vjass_arena_calloc(size_t count, size_t size);
+void *tree_sitter_vjass_arena_realloc(void *ptr, size_t size);
+void tree_sitter_vjass_arena_free(void *ptr);
+
+// Routes every tree-sitter allocation through the arena.
+void tree_sitter_vjass_arena_install(void);
+
+// Returns every block cached by the calling thread to free(). Blocks that
+// are still in use (live trees, parser buffers) are not affected, so this
+// is safe to call between files.
+void tree_sitter_vjass_arena_reset(void);
+
+// Counters of the calling thread.
+TSVjassArenaStats tree_sitter_vjass_arena_stats(void);
+
+#ifdef TREE_SITTER_VJASS_ARENA_IMPLEMENTATION
+
+static TREE_SITTER_VJASS_THREAD_LOCAL TSVjassArena tree_sitter_vjass_arena;
+
+// Thread exit: a key (POSIX) or fiber-local slot (Windows) whose
+// destructor releases the exiting thread's free lists. A thread registers
+// the first time it caches a block.
+#ifdef _WIN32
+static DWORD tree_sitter_vjass_arena_slot = FLS_OUT_OF_INDEXES;
+static INIT_ONCE tree_sitter_vjass_arena_once = INIT_ONCE_STATIC_INIT;
+#else
+static pthread_key_t tree_sitter_vjass_arena_key;
+static pthread_once_t tree_sitter_vjass_arena_once = PTHREAD_ONCE_INIT;
+static int tree_sitter_vjass_arena_key_ok;
+#endif
+
+static void tree_sitter_vjass_arena_release(TSVjassArena *arena) {
+  for (uint32_t i = 0; i < TREE_SITTER_VJASS_ARENA_CLASSES; i++) {
+    TSVjassArenaHeader *header = arena->free_lists[i];
+    while (header) {
+      TSVjassArenaHeader *next = header->block.next;
+      free(header);
+      header = next;
+    }
+    arena->free_lists[i] = NULL;
+  }
+  arena->stats.cached_bytes = 0;
+}
+
+// Blocks freed after this, by later thread-exit destructors, go straight
+// back to free().
+#ifdef _WIN32
+static void WINAPI tree_sitter_vjass_arena_thread_exit(void *value) {
+#else
+static void tree_sitter_vjass_arena_thread_exit(void *value) {
+#endif
+  TSVjassArena *arena = (TSVjassArena *)value;
+  arena->exiting = 1;
+  tree_sitter_vjass_arena_release(arena);
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK tree_sitter_vjass_arena_init(PINIT_ONCE once, PVOID parameter, PVOID *context) {
+  (void)once, (void)parameter, (void)context;
+  tree_sitter_vjass_arena_slot = FlsAlloc(tree_sitter_vjass_arena_thread_exit);
+  return TRUE;
+}
+
+static void tree_sitter_vjass_arena_register(TSVjassArena *arena) {
+  InitOnceExecuteOnce(&tree_sitter_vjass_arena_once, tree_sitter_vjass_arena_init, NULL, NULL);
+  if (tree_sitter_vjass_arena_slot != FLS_OUT_OF_INDEXES) FlsSetValue(tree_sitter_vjass_arena_slot, arena);
+  arena->registered = 1;
+}
+#else
+static void tree_sitter_vjass_arena_init(void) {
+  tree_sitter_vjass_arena_key_ok =
+      pthread_key_create(&tree_sitter_vjass_arena_key, tree_sitter_vjass_arena_thread_exit) == 0;
+}
+
+static void tree_sitter_vjass_arena_register(TSVjassArena *arena) {
+  pthread_once(&tree_sitter_vjass_arena_once, tree_sitter_vjass_arena_init);
+  if (tree_sitter_vjass_arena_key_ok) pthread_setspecific(tree_sitter_vjass_arena_key, arena);
+  arena->registered = 1;
+}
+#endif
+
+void *tree_sitter_vjass_arena_malloc(size_t size) {
+  TSVjassArena *arena = &tree_sitter_vjass_arena;
+  uint32_t size_class = tree_sitter_vjass_arena_class(size);
+  TSVjassArenaHeader *header;
+
+  if (size_class < TREE_SITTER_VJASS_ARENA_LARGE && arena->free_lists[size_class]) {
+    header = arena->free_lists[size_class];
+    arena->free_lists[size_class] = header->block.next;
+    arena->stats.cached_bytes -= tree_sitter_vjass_arena_capacity(size_class);
+    arena->stats.reused++;
+  } else {
+    size_t capacity = size_class < TREE_SITTER_VJASS_ARENA_LARGE ? tree_sitter_vjass_arena_capacity(size_class) : size;
+    header = (TSVjassArenaHeader *)malloc(sizeof(TSVjassArenaHeader) + capacity);
+    if (!header) {
+      fprintf(stderr, "tree-sitter-vjass: failed to allocate %zu bytes\n", size);
+      abort();
+    }
+    arena->stats.system_allocs++;
+  }
+
+  header->block.size_class = size_class;
+  return header + 1;
+}
+
+void tree_sitter_vjass_arena_free(void *ptr) {
+  if (!ptr) return;
+  TSVjassArena *arena = &tree_sitter_vjass_arena;
+  TSVjassArenaHeader *header = (TSVjassArenaHeader *)ptr - 1;
+  uint32_t size_class = header->block.size_class;
+  size_t capacity = tree_sitter_vjass_arena_capacity(size_class);
+
+  if (size_class >= TREE_SITTER_VJASS_ARENA_LARGE || arena->exiting ||
+      arena->stats.cached_bytes + capacity > TREE_SITTER_VJASS_ARENA_MAX_CACHED) {
+    free(header);
+    return;
+  }
+  if (!arena->registered) tree_sitter_vjass_arena_register(arena);
+  header->block.next = arena->free_lists[size_class];
+  arena->free_lists[size_class] = header;
+  arena->stats.cached_bytes += capacity;
+}
+
+void *tree_sitter_vjass_arena_calloc(size_t count, size_t size) {
+  if (size != 0 && count > SIZE_MAX / size) return NULL;
+  void *ptr = tree_sitter_vjass_arena_malloc(count * size);
+  memset(ptr, 0, count * size);
+  return ptr;
+}
+
+void *tree_sitter_vjass_arena_realloc(void *ptr, size_t size) {
+  if (!ptr) return tree_sitter_vjass_arena_malloc(size);
+  TSVjassArenaHeader *header = (TSVjassArenaHeader *)ptr - 1;
+  uint32_t size_class = header->block.size_class;
+
+  if (size_class >= TREE_SITTER_VJASS_ARENA_LARGE) {
+    // Large blocks stay large (even when shrinking) and go through realloc.
+    header = (TSVjassArenaHeader *)realloc(header, sizeof(TSVjassArenaHeader) + size);
+    if (!header) {
+      fprintf(stderr, "tree-sitter-vjass: failed to reallocate %zu bytes\n", size);
+      abort();
+    }
+    tree_sitter_vjass_arena.stats.system_allocs++;
+    return header + 1;
+  }
+
+  size_t capacity = tree_sitter_vjass_arena_capacity(size_class);
+  if (size <= capacity) return ptr;
+  void *result = tree_sitter_vjass_arena_malloc(size);
+  memcpy(result, ptr, capacity);
+  tree_sitter_vjass_arena_free(ptr);
+  return result;
+}
+
+void tree_sitter_vjass_arena_install(void) {
+  ts_set_allocator(tree_sitter_vjass_arena_malloc, tree_sitter_vjass_arena_calloc,
+                   tree_sitter_vjass_arena_realloc, tree_sitter_vjass_arena_free);
+}
+
+void tree_sitter_vjass_arena_reset(void) { tree_sitter_vjass_arena_release(&tree_sitter_vjass_arena); }
+
+TSVjassArenaStats tree_sitter_vjass_arena_stats(void) { return tree_sitter_vjass_arena.stats; }
+
+#endif // TREE_SITTER_VJASS_ARENA_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VJASS_ARENA_H_
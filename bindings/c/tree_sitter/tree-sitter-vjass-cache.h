@@ -0,0 +1,280 @@
+#ifndef TREE_SITTER_VJASS_CACHE_H_
+#define TREE_SITTER_VJASS_CACHE_H_
+
+// On-disk parse cache keyed by file content.
+//
+// Trees cannot be written to disk, so the cache stores what indexers derive
+// from them: the flat node table of tree-sitter-vjass-table.h. Entries are
+// keyed by a 64-bit hash of the source, seeded with what identifies the
+// grammar: TREE_SITTER_VJASS_GRAMMAR_HASH (a hash of src/parser.c and
+// src/scanner.c that generate-symbols.js writes into
+// tree-sitter-vjass-symbols.h) and the language's name, version, ABI and
+// symbol, field and state counts. Regenerating the parser or changing the
+// scanner therefore starts a fresh set of entries rather than serving stale
+// tables. An entry also records the source length and an XXH64 digest of the
+// source, an independent second hash; a hit needs all three to match:
+//
+//   TSVjassNodeTable table;
+//   bool hit;
+//   if (tree_sitter_vjass_cached_parse(parser, ".vjass-cache", source, length, &table, &hit)) {
+//     ... table.symbol[i], table.start_byte[i], table.parent[i] ...
+//     tree_sitter_vjass_node_table_delete(&table);
+//   }
+//
+// Every entry is one file, <dir>/<key>.vjt, written to a temporary name and
+// renamed into place, so concurrent writers and readers never see a partial
+// entry. Entries are in native byte order; a cache written on a machine of
+// the other endianness is treated as empty. The Rust crate (feature
+// `cache`) reads and writes the same files.
+//
+// Header-only; include <tree_sitter/api.h> and link the tree-sitter runtime.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-symbols.h>
+#include <tree_sitter/tree-sitter-vjass-table.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <process.h>
+#define tree_sitter_vjass_cache_getpid _getpid
+#else
+#include <unistd.h>
+#define tree_sitter_vjass_cache_getpid getpid
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bumped whenever the entry layout changes.
+#define TREE_SITTER_VJASS_CACHE_FORMAT 3
+
+typedef struct {
+  char magic[4]; // "VJTC"
+  uint32_t format;
+  uint32_t byte_order; // 0x01020304 as written
+  uint32_t count;
+  uint64_t key;
+  uint32_t source_length;
+  uint32_t reserved;
+  uint64_t digest; // tree_sitter_vjass_cache_digest() of the source
+} TSVjassCacheHeader;
+
+// MurmurHash64A.
+static inline uint64_t tree_sitter_vjass_cache_hash(const void *data, size_t length, uint64_t seed) {
+  const uint64_t m = UINT64_C(0xc6a4a7935bd1e995);
+  const unsigned r = 47;
+  const unsigned char *bytes = (const unsigned char *)data;
+  uint64_t h = seed ^ ((uint64_t)length * m);
+
+  size_t blocks = length / 8;
+  for (size_t i = 0; i < blocks; i++) {
+    uint64_t k = 0;
+    for (unsigned b = 0; b < 8; b++) k |= (uint64_t)bytes[i * 8 + b] << (8 * b);
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+    h ^= k;
+    h *= m;
+  }
+
+  const unsigned char *tail = bytes + blocks * 8;
+  size_t rest = length & 7;
+  if (rest > 0) {
+    for (size_t b = rest; b-- > 0;) h ^= (uint64_t)tail[b] << (8 * b);
+    h *= m;
+  }
+
+  h ^= h >> r;
+  h *= m;
+  h ^= h >> r;
+  return h;
+}
+
+static inline uint64_t tree_sitter_vjass_cache_rotl(uint64_t x, unsigned r) { return (x << r) | (x >> (64 - r)); }
+
+static inline uint64_t tree_sitter_vjass_cache_read64(const unsigned char *bytes) {
+  uint64_t v = 0;
+  for (unsigned b = 0; b < 8; b++) v |= (uint64_t)bytes[b] << (8 * b);
+  return v;
+}
+
+static inline uint64_t tree_sitter_vjass_cache_xxh_round(uint64_t acc, uint64_t input) {
+  acc += input * UINT64_C(0xc2b2ae3d27d4eb4f);
+  return tree_sitter_vjass_cache_rotl(acc, 31) * UINT64_C(0x9e3779b185ebca87);
+}
+
+// XXH64 with seed 0: the digest that confirms a hit on the MurmurHash64A
+// key. A different construction, so a collision of one is not one of the
+// other.
+static inline uint64_t tree_sitter_vjass_cache_digest(const void *data, size_t length) {
+  const uint64_t p1 = UINT64_C(0x9e3779b185ebca87), p2 = UINT64_C(0xc2b2ae3d27d4eb4f);
+  const uint64_t p3 = UINT64_C(0x165667b19e3779f9), p4 = UINT64_C(0x85ebca77c2b2ae63);
+  const uint64_t p5 = UINT64_C(0x27d4eb2f165667c5);
+  const unsigned char *p = (const unsigned char *)data;
+  const unsigned char *end = p + length;
+  uint64_t h;
+
+  if (length >= 32) {
+    uint64_t v[4] = {p1 + p2, p2, 0, (uint64_t)0 - p1};
+    for (; end - p >= 32; p += 32) {
+      for (unsigned lane = 0; lane < 4; lane++) {
+        v[lane] = tree_sitter_vjass_cache_xxh_round(v[lane], tree_sitter_vjass_cache_read64(p + lane * 8));
+      }
+    }
+    h = tree_sitter_vjass_cache_rotl(v[0], 1) + tree_sitter_vjass_cache_rotl(v[1], 7) +
+        tree_sitter_vjass_cache_rotl(v[2], 12) + tree_sitter_vjass_cache_rotl(v[3], 18);
+    for (unsigned lane = 0; lane < 4; lane++) {
+      h ^= tree_sitter_vjass_cache_xxh_round(0, v[lane]);
+      h = h * p1 + p4;
+    }
+  } else {
+    h = p5;
+  }
+  h += (uint64_t)length;
+
+  for (; end - p >= 8; p += 8) {
+    h ^= tree_sitter_vjass_cache_xxh_round(0, tree_sitter_vjass_cache_read64(p));
+    h = tree_sitter_vjass_cache_rotl(h, 27) * p1 + p4;
+  }
+  if (end - p >= 4) {
+    uint64_t k = (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24;
+    h ^= k * p1;
+    h = tree_sitter_vjass_cache_rotl(h, 23) * p2 + p3;
+    p += 4;
+  }
+  for (; p < end; p++) {
+    h ^= *p * p5;
+    h = tree_sitter_vjass_cache_rotl(h, 11) * p1;
+  }
+
+  h ^= h >> 33;
+  h *= p2;
+  h ^= h >> 29;
+  h *= p3;
+  h ^= h >> 32;
+  return h;
+}
+
+// Hash seed that identifies the grammar: two languages that could produce
+// different tables for the same source never share one. The version is
+// metadata.version of tree-sitter.json, as generated into the language.
+static inline uint64_t tree_sitter_vjass_cache_seed(const TSLanguage *language) {
+  const TSLanguageMetadata *metadata = ts_language_metadata(language);
+  const char *name = ts_language_name(language);
+  char tag[256];
+  int length = snprintf(tag, sizeof(tag), "%s %u.%u.%u abi %u symbols %u fields %u states %u", name ? name : "",
+                        metadata ? metadata->major_version : 0, metadata ? metadata->minor_version : 0,
+                        metadata ? metadata->patch_version : 0, ts_language_abi_version(language),
+                        ts_language_symbol_count(language), ts_language_field_count(language),
+                        ts_language_state_count(language));
+  return tree_sitter_vjass_cache_hash(tag, (size_t)length, TREE_SITTER_VJASS_GRAMMAR_HASH);
+}
+
+static inline uint64_t tree_sitter_vjass_cache_key(uint64_t seed, const char *source, uint32_t length) {
+  return tree_sitter_vjass_cache_hash(source, length, seed);
+}
+
+static inline void tree_sitter_vjass_cache_path(const char *dir, uint64_t key, char *path, size_t size) {
+  snprintf(path, size, "%s/%016llx.vjt", dir, (unsigned long long)key);
+}
+
+// Loads the entry for `key` into `table`. A missing, truncated or foreign
+// entry is a miss, and so is one written for a source of another length or
+// digest.
+static inline bool tree_sitter_vjass_cache_load(const char *dir, uint64_t key, uint32_t source_length,
+                                                uint64_t digest, TSVjassNodeTable *table) {
+  char path[4096];
+  tree_sitter_vjass_cache_path(dir, key, path, sizeof(path));
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+
+  TSVjassCacheHeader header;
+  bool ok = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, "VJTC", 4) == 0 &&
+            header.format == TREE_SITTER_VJASS_CACHE_FORMAT && header.byte_order == 0x01020304 &&
+            header.key == key && header.source_length == source_length && header.digest == digest &&
+            tree_sitter_vjass_node_table_alloc(table, header.count);
+  if (ok) {
+    size_t size = tree_sitter_vjass_node_table_size(header.count);
+    // The trailing read must hit end of file: a longer file is not ours.
+    ok = fread(table->start_byte, 1, size + 1, file) == size;
+    if (!ok) tree_sitter_vjass_node_table_delete(table);
+  }
+  fclose(file);
+  return ok;
+}
+
+static inline bool tree_sitter_vjass_cache_store(const char *dir, uint64_t key, uint32_t source_length,
+                                                 uint64_t digest, const TSVjassNodeTable *table) {
+  char path[4096], temporary[4200];
+  tree_sitter_vjass_cache_path(dir, key, path, sizeof(path));
+  // Unique per process and per caller.
+  snprintf(temporary, sizeof(temporary), "%s.%lu.%llx.tmp", path, (unsigned long)tree_sitter_vjass_cache_getpid(),
+           (unsigned long long)(uintptr_t)table);
+  FILE *file = fopen(temporary, "wb");
+  if (!file) return false;
+
+  TSVjassCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "VJTC", 4);
+  header.format = TREE_SITTER_VJASS_CACHE_FORMAT;
+  header.byte_order = 0x01020304;
+  header.count = table->count;
+  header.key = key;
+  header.source_length = source_length;
+  header.digest = digest;
+
+  // A table that was built in place is one block; one loaded from another
+  // source need not be, so write the arrays one by one.
+  uint32_t n = table->count;
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+            fwrite(table->start_byte, sizeof(uint32_t), n, file) == n &&
+            fwrite(table->end_byte, sizeof(uint32_t), n, file) == n &&
+            fwrite(table->parent, sizeof(uint32_t), n, file) == n &&
+            fwrite(table->first_child, sizeof(uint32_t), n, file) == n &&
+            fwrite(table->next_sibling, sizeof(uint32_t), n, file) == n &&
+            fwrite(table->symbol, sizeof(uint16_t), n, file) == n &&
+            fwrite(table->flags, sizeof(uint16_t), n, file) == n;
+  ok = fclose(file) == 0 && ok;
+#ifdef _WIN32
+  ok = ok && MoveFileExA(temporary, path, MOVEFILE_REPLACE_EXISTING);
+#else
+  ok = ok && rename(temporary, path) == 0;
+#endif
+  if (!ok) remove(temporary);
+  return ok;
+}
+
+// Looks `source` up in the cache in `dir` and, on a miss, parses it with
+// `parser` and stores the table. `*hit` tells which happened. Returns false
+// only if no table could be produced; a failed store is not an error.
+static inline bool tree_sitter_vjass_cached_parse(TSParser *parser, const char *dir, const char *source,
+                                                  uint32_t length, TSVjassNodeTable *table, bool *hit) {
+  uint64_t key = tree_sitter_vjass_cache_key(tree_sitter_vjass_cache_seed(ts_parser_language(parser)), source, length);
+  uint64_t digest = tree_sitter_vjass_cache_digest(source, length);
+  *hit = tree_sitter_vjass_cache_load(dir, key, length, digest, table);
+  if (*hit) return true;
+
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source, length);
+  if (!tree) return false;
+  bool ok = tree_sitter_vjass_node_table_build(tree, table);
+  ts_tree_delete(tree);
+  if (ok) tree_sitter_vjass_cache_store(dir, key, length, digest, table);
+  return ok;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VJASS_CACHE_H_
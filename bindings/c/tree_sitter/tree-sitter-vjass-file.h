@@ -0,0 +1,144 @@
+#ifndef TREE_SITTER_VJASS_FILE_H_
+#define TREE_SITTER_VJASS_FILE_H_
+
+// Parse a file straight from a read-only memory mapping.
+//
+// The source is never copied: the parser pulls it through a TSInput read
+// callback that hands out chunks of the mapping, so peak memory is the
+// tree plus whatever pages of the file the kernel keeps resident.
+//
+// Header-only; include <tree_sitter/api.h> and link the tree-sitter runtime.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TREE_SITTER_VJASS_READ_CHUNK
+#define TREE_SITTER_VJASS_READ_CHUNK (1u << 20)
+#endif
+
+typedef struct {
+  const char *data;
+  size_t length;
+#ifdef _WIN32
+  HANDLE file;
+  HANDLE mapping;
+#endif
+} TSVjassMappedFile;
+
+static inline void tree_sitter_vjass_unmap_file(TSVjassMappedFile *self) {
+#ifdef _WIN32
+  if (self->data) UnmapViewOfFile(self->data);
+  if (self->mapping) CloseHandle(self->mapping);
+  if (self->file && self->file != INVALID_HANDLE_VALUE) CloseHandle(self->file);
+#else
+  if (self->data && self->length > 0) munmap((void *)self->data, self->length);
+#endif
+  memset(self, 0, sizeof(*self));
+}
+
+// Maps `path` read-only. Empty files succeed with `data == NULL`. Files
+// larger than 4 GiB are rejected since tree-sitter offsets are 32-bit.
+static inline bool tree_sitter_vjass_map_file(TSVjassMappedFile *self, const char *path) {
+  memset(self, 0, sizeof(*self));
+#ifdef _WIN32
+  self->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (self->file == INVALID_HANDLE_VALUE) return false;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(self->file, &size) || (uint64_t)size.QuadPart > UINT32_MAX) {
+    tree_sitter_vjass_unmap_file(self);
+    return false;
+  }
+  self->length = (size_t)size.QuadPart;
+  if (self->length == 0) return true;
+  self->mapping = CreateFileMappingA(self->file, NULL, PAGE_READONLY, 0, 0, NULL);
+  self->data = self->mapping ? (const char *)MapViewOfFile(self->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+  if (!self->data) {
+    tree_sitter_vjass_unmap_file(self);
+    return false;
+  }
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (uint64_t)st.st_size > UINT32_MAX) {
+    close(fd);
+    return false;
+  }
+  self->length = (size_t)st.st_size;
+  if (self->length > 0) {
+    void *data = mmap(NULL, self->length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      memset(self, 0, sizeof(*self));
+      return false;
+    }
+#ifdef MADV_SEQUENTIAL
+    madvise(data, self->length, MADV_SEQUENTIAL);
+#endif
+    self->data = (const char *)data;
+  }
+  close(fd);
+#endif
+  return true;
+}
+
+static inline const char *tree_sitter_vjass_read_mapped(void *payload, uint32_t byte_index, TSPoint position,
+                                                        uint32_t *bytes_read) {
+  (void)position;
+  const TSVjassMappedFile *self = (const TSVjassMappedFile *)payload;
+  if (byte_index >= self->length) {
+    *bytes_read = 0;
+    return "";
+  }
+  size_t remaining = self->length - byte_index;
+  *bytes_read = (uint32_t)(remaining < TREE_SITTER_VJASS_READ_CHUNK ? remaining : TREE_SITTER_VJASS_READ_CHUNK);
+  return self->data + byte_index;
+}
+
+static inline TSInput tree_sitter_vjass_mapped_input(TSVjassMappedFile *self) {
+  TSInput input;
+  memset(&input, 0, sizeof(input));
+  input.payload = self;
+  input.read = tree_sitter_vjass_read_mapped;
+  input.encoding = TSInputEncodingUTF8;
+  return input;
+}
+
+// Maps `path`, parses it and unmaps it again. Returns NULL if the file
+// cannot be mapped. Nodes of the returned tree hold offsets only, so the
+// tree stays valid after the mapping is gone; keep a mapping open yourself
+// (tree_sitter_vjass_map_file) if you also need the node text.
+static inline TSTree *tree_sitter_vjass_parse_file(TSParser *parser, const TSTree *old_tree, const char *path) {
+  TSVjassMappedFile file;
+  if (!tree_sitter_vjass_map_file(&file, path)) return NULL;
+  TSTree *tree = ts_parser_parse(parser, old_tree, tree_sitter_vjass_mapped_input(&file));
+  tree_sitter_vjass_unmap_file(&file);
+  return tree;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VJASS_FILE_H_
@@ -0,0 +1,404 @@
+#ifndef TREE_SITTER_VJASS_SPLIT_H_
+#define TREE_SITTER_VJASS_SPLIT_H_
+
+// Parse one large file on several threads.
+//
+// Functions, globals blocks and structs are top-level and independent, so a
+// file can be cut in front of any of them and the pieces parsed separately.
+// tree_sitter_vjass_split() finds such cut points without parsing: it scans
+// the source once, steps over strings and comments the way src/scanner.c
+// does, and only cuts at the start of a line that opens a top-level
+// `function`, `constant function`, `globals` or `struct`.
+//
+// tree_sitter_vjass_parse_chunked() then parses every chunk on its own
+// parser, restricted to the chunk with ts_parser_set_included_ranges(), so
+// all trees share the file's byte offsets and points. The result presents
+// the top-level nodes of all chunks as one list, in source order:
+//
+//   TSVjassChunkedTree chunked;
+//   tree_sitter_vjass_parse_chunked(tree_sitter_vjass(), source, length, 8, 0, &chunked);
+//   for (uint32_t i = 0; i < tree_sitter_vjass_chunked_child_count(&chunked); i++) {
+//     TSNode node = tree_sitter_vjass_chunked_child(&chunked, i);
+//     ...
+//   }
+//   tree_sitter_vjass_chunked_tree_delete(&chunked);
+//
+// Header-only; include <tree_sitter/api.h> and link the tree-sitter runtime
+// (and pthreads outside Windows).
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Top-level declarations a chunk may start with.
+typedef enum {
+  TSVjassSplitNone,
+  TSVjassSplitOpen,  // function, constant function, globals, struct
+  TSVjassSplitClose, // endfunction, endglobals, endstruct
+} TSVjassSplitWord;
+
+static inline bool tree_sitter_vjass_split_is_word(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static inline bool tree_sitter_vjass_split_is_blank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+static inline bool tree_sitter_vjass_split_word_is(const char *word, size_t length, const char *keyword) {
+  return strlen(keyword) == length && memcmp(word, keyword, length) == 0;
+}
+
+// Classifies the line that starts with `word` (its first word), looking at
+// the second word after `constant`.
+static inline TSVjassSplitWord tree_sitter_vjass_split_classify(const char *word, size_t length, const char *end) {
+  if (tree_sitter_vjass_split_word_is(word, length, "constant")) {
+    const char *next = word + length;
+    while (next < end && tree_sitter_vjass_split_is_blank(*next)) next++;
+    size_t next_length = 0;
+    while (next + next_length < end && tree_sitter_vjass_split_is_word(next[next_length])) next_length++;
+    return tree_sitter_vjass_split_word_is(next, next_length, "function") ? TSVjassSplitOpen : TSVjassSplitNone;
+  }
+  if (tree_sitter_vjass_split_word_is(word, length, "function") ||
+      tree_sitter_vjass_split_word_is(word, length, "globals") ||
+      tree_sitter_vjass_split_word_is(word, length, "struct")) {
+    return TSVjassSplitOpen;
+  }
+  if (tree_sitter_vjass_split_word_is(word, length, "endfunction") ||
+      tree_sitter_vjass_split_word_is(word, length, "endglobals") ||
+      tree_sitter_vjass_split_word_is(word, length, "endstruct")) {
+    return TSVjassSplitClose;
+  }
+  return TSVjassSplitNone;
+}
+
+static inline TSRange tree_sitter_vjass_split_range(uint32_t start_row, uint32_t start_byte, TSPoint end_point,
+                                                    uint32_t end_byte) {
+  TSRange range;
+  range.start_point.row = start_row;
+  range.start_point.column = 0;
+  range.end_point = end_point;
+  range.start_byte = start_byte;
+  range.end_byte = end_byte;
+  return range;
+}
+
+// Steps over the long bracket `[==[ ... ]==]` that opens at source[i], as
+// the scanner's scan_block_start/scan_block_content do for block strings
+// and `--[==[` comments, counting the lines it spans. Returns the offset
+// past the closing bracket (or the end of the source), or `i` when no long
+// bracket opens there.
+static inline uint32_t tree_sitter_vjass_split_skip_long_bracket(const char *source, uint32_t length, uint32_t i,
+                                                                 uint32_t *row, uint32_t *line_start) {
+  uint32_t j = i + 1, level = 0;
+  while (j < length && source[j] == '=') j++, level++;
+  if (j >= length || source[j] != '[') return i;
+  j++;
+  for (;;) {
+    while (j < length && source[j] != ']') {
+      if (source[j] == '\n') (*row)++, *line_start = j + 1;
+      j++;
+    }
+    if (j >= length) return length;
+    uint32_t k = j + 1, closing = 0;
+    while (k < length && source[k] == '=') k++, closing++;
+    if (closing == level && k < length && source[k] == ']') return k + 1;
+    j++;
+  }
+}
+
+// Splits `source` into at most `max_ranges` chunks of roughly equal size
+// and stores them in `ranges`, in order and covering the whole source.
+// Returns the number of chunks (at least 1; fewer than asked for when the
+// file has too few top-level declarations).
+static inline uint32_t tree_sitter_vjass_split(const char *source, uint32_t length, TSRange *ranges,
+                                               uint32_t max_ranges) {
+  if (max_ranges == 0) return 0;
+  uint32_t count = 0;
+  uint32_t chunk_start = 0, chunk_row = 0;
+  uint64_t next_target = (uint64_t)length / max_ranges;
+  uint32_t depth = 0;
+  uint32_t row = 0, line_start = 0;
+  bool at_line_start = true;
+
+  const char *end = source + length;
+  uint32_t i = 0;
+  while (i < length) {
+    char c = source[i];
+
+    if (c == '\n') {
+      row++;
+      i++;
+      line_start = i;
+      at_line_start = true;
+      continue;
+    }
+    if (tree_sitter_vjass_split_is_blank(c)) {
+      i++;
+      continue;
+    }
+
+    if (tree_sitter_vjass_split_is_word(c)) {
+      uint32_t word = i;
+      while (i < length && tree_sitter_vjass_split_is_word(source[i])) i++;
+      if (at_line_start) {
+        TSVjassSplitWord kind = tree_sitter_vjass_split_classify(source + word, i - word, end);
+        if (kind == TSVjassSplitOpen) {
+          if (depth == 0 && line_start >= next_target && line_start > chunk_start && count + 1 < max_ranges) {
+            TSPoint cut = {row, 0};
+            ranges[count++] = tree_sitter_vjass_split_range(chunk_row, chunk_start, cut, line_start);
+            chunk_start = line_start;
+            chunk_row = row;
+            next_target = (uint64_t)line_start + (uint64_t)(length - line_start) / (max_ranges - count);
+          }
+          depth++;
+        } else if (kind == TSVjassSplitClose && depth > 0) {
+          depth--;
+        }
+      }
+      at_line_start = false;
+      continue;
+    }
+    at_line_start = false;
+
+    if (c == '"' || c == '\'') {
+      // Strings end at the closing quote or at the end of the line.
+      i++;
+      while (i < length && source[i] != c && source[i] != '\n') {
+        if (source[i] == '\\' && i + 1 < length && source[i + 1] != '\n') i++;
+        i++;
+      }
+      if (i < length && source[i] == c) i++;
+    } else if (c == '/' && i + 1 < length && source[i + 1] == '/') {
+      while (i < length && source[i] != '\n') i++;
+    } else if (c == '/' && i + 1 < length && source[i + 1] == '*') {
+      i += 2;
+      while (i < length && !(source[i] == '*' && i + 1 < length && source[i + 1] == '/')) {
+        if (source[i] == '\n') row++, line_start = i + 1;
+        i++;
+      }
+      if (i < length) i += 2;
+    } else if (c == '-' && i + 2 < length && source[i + 1] == '-' && source[i + 2] == '[') {
+      // `--[==[ ... ]==]`
+      i = tree_sitter_vjass_split_skip_long_bracket(source, length, i + 2, &row, &line_start);
+    } else if (c == '[') {
+      // `[==[ ... ]==]` block strings; any other `[` indexes an array.
+      uint32_t after = tree_sitter_vjass_split_skip_long_bracket(source, length, i, &row, &line_start);
+      i = after != i ? after : i + 1;
+    } else {
+      i++;
+    }
+  }
+
+  TSPoint end_point = {row, length - line_start};
+  ranges[count++] = tree_sitter_vjass_split_range(chunk_row, chunk_start, end_point, length);
+  return count;
+}
+
+typedef struct {
+  uint32_t count;
+  TSRange *ranges;
+  TSTree **trees;
+  uint32_t *child_offsets; // top-level children before chunk i; count + 1 entries
+} TSVjassChunkedTree;
+
+typedef struct {
+  const TSLanguage *language;
+  const char *source;
+  uint32_t length;
+  TSVjassChunkedTree *result;
+  uint32_t first;
+  uint32_t step;
+} TSVjassChunkWorker;
+
+// Leaves the trees NULL if the language does not load, which
+// tree_sitter_vjass_parse_chunked() has already ruled out.
+static inline void tree_sitter_vjass_parse_chunks(TSVjassChunkWorker *worker) {
+  TSParser *parser = ts_parser_new();
+  if (!ts_parser_set_language(parser, worker->language)) {
+    ts_parser_delete(parser);
+    return;
+  }
+  TSVjassChunkedTree *result = worker->result;
+  for (uint32_t i = worker->first; i < result->count; i += worker->step) {
+    ts_parser_set_included_ranges(parser, &result->ranges[i], 1);
+    result->trees[i] = ts_parser_parse_string(parser, NULL, worker->source, worker->length);
+  }
+  ts_parser_delete(parser);
+}
+
+#ifdef _WIN32
+static inline DWORD WINAPI tree_sitter_vjass_chunk_thread(LPVOID payload) {
+  tree_sitter_vjass_parse_chunks((TSVjassChunkWorker *)payload);
+  return 0;
+}
+#else
+static inline void *tree_sitter_vjass_chunk_thread(void *payload) {
+  tree_sitter_vjass_parse_chunks((TSVjassChunkWorker *)payload);
+  return NULL;
+}
+#endif
+
+static inline void tree_sitter_vjass_chunked_tree_delete(TSVjassChunkedTree *self) {
+  for (uint32_t i = 0; self->trees && i < self->count; i++) {
+    if (self->trees[i]) ts_tree_delete(self->trees[i]);
+  }
+  free(self->ranges);
+  free(self->trees);
+  free(self->child_offsets);
+  memset(self, 0, sizeof(*self));
+}
+
+// Splits `source` into `chunks` pieces (`threads` when 0) and parses them
+// on `threads` threads; the calling thread is one of them. Returns false,
+// with `out` empty, if the runtime cannot load `language` (an ABI version
+// it does not support; checked before anything is split) or if memory or
+// a thread could not be obtained.
+static inline bool tree_sitter_vjass_parse_chunked(const TSLanguage *language, const char *source, uint32_t length,
+                                                   uint32_t threads, uint32_t chunks, TSVjassChunkedTree *out) {
+  memset(out, 0, sizeof(*out));
+  TSParser *probe = ts_parser_new();
+  bool loads = ts_parser_set_language(probe, language);
+  ts_parser_delete(probe);
+  if (!loads) return false;
+
+  if (threads == 0) threads = 1;
+  if (chunks == 0) chunks = threads;
+
+  out->ranges = (TSRange *)malloc(sizeof(TSRange) * chunks);
+  if (!out->ranges) return false;
+  out->count = tree_sitter_vjass_split(source, length, out->ranges, chunks);
+  if (threads > out->count) threads = out->count;
+  out->trees = (TSTree **)calloc(out->count, sizeof(TSTree *));
+  out->child_offsets = (uint32_t *)malloc(sizeof(uint32_t) * (out->count + 1));
+  TSVjassChunkWorker *workers = (TSVjassChunkWorker *)malloc(sizeof(TSVjassChunkWorker) * threads);
+#ifdef _WIN32
+  HANDLE *handles = (HANDLE *)calloc(threads, sizeof(HANDLE));
+#else
+  pthread_t *handles = (pthread_t *)calloc(threads, sizeof(pthread_t));
+#endif
+  bool ok = out->trees && out->child_offsets && workers && handles;
+
+  uint32_t started = 1;
+  if (ok) {
+    for (uint32_t t = 0; t < threads; t++) {
+      workers[t].language = language;
+      workers[t].source = source;
+      workers[t].length = length;
+      workers[t].result = out;
+      workers[t].first = t;
+      workers[t].step = threads;
+    }
+    for (; started < threads; started++) {
+#ifdef _WIN32
+      handles[started] = CreateThread(NULL, 0, tree_sitter_vjass_chunk_thread, &workers[started], 0, NULL);
+      if (!handles[started]) break;
+#else
+      if (pthread_create(&handles[started], NULL, tree_sitter_vjass_chunk_thread, &workers[started]) != 0) break;
+#endif
+    }
+    // Chunks of threads that could not be started are parsed here.
+    for (uint32_t t = started; t < threads; t++) tree_sitter_vjass_parse_chunks(&workers[t]);
+    tree_sitter_vjass_parse_chunks(&workers[0]);
+    for (uint32_t t = 1; t < started; t++) {
+#ifdef _WIN32
+      WaitForSingleObject(handles[t], INFINITE);
+      CloseHandle(handles[t]);
+#else
+      pthread_join(handles[t], NULL);
+#endif
+    }
+
+    out->child_offsets[0] = 0;
+    for (uint32_t i = 0; i < out->count; i++) {
+      ok = ok && out->trees[i];
+      uint32_t children = out->trees[i] ? ts_node_child_count(ts_tree_root_node(out->trees[i])) : 0;
+      out->child_offsets[i + 1] = out->child_offsets[i] + children;
+    }
+  }
+
+  free(workers);
+  free(handles);
+  if (!ok) tree_sitter_vjass_chunked_tree_delete(out);
+  return ok;
+}
+
+// Number of top-level nodes over all chunks, as if the file had been parsed
+// as a whole.
+static inline uint32_t tree_sitter_vjass_chunked_child_count(const TSVjassChunkedTree *self) {
+  return self->count ? self->child_offsets[self->count] : 0;
+}
+
+// Index of the chunk that contains `byte`.
+static inline uint32_t tree_sitter_vjass_chunked_chunk_at(const TSVjassChunkedTree *self, uint32_t byte) {
+  uint32_t low = 0, high = self->count;
+  while (high - low > 1) {
+    uint32_t mid = low + (high - low) / 2;
+    if (self->ranges[mid].start_byte <= byte) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+// The `index`th top-level node in source order.
+static inline TSNode tree_sitter_vjass_chunked_child(const TSVjassChunkedTree *self, uint32_t index) {
+  uint32_t low = 0, high = self->count;
+  while (high - low > 1) {
+    uint32_t mid = low + (high - low) / 2;
+    if (self->child_offsets[mid] <= index) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return ts_node_child(ts_tree_root_node(self->trees[low]), index - self->child_offsets[low]);
+}
+
+// The smallest node spanning [start, end), looked up in the chunk that
+// contains `start`. A null node if `self` is empty, as it is after a failed
+// tree_sitter_vjass_parse_chunked().
+static inline TSNode tree_sitter_vjass_chunked_descendant(const TSVjassChunkedTree *self, uint32_t start,
+                                                          uint32_t end) {
+  TSTree *tree = self->count ? self->trees[tree_sitter_vjass_chunked_chunk_at(self, start)] : NULL;
+  if (!tree) {
+    TSNode null_node;
+    memset(&null_node, 0, sizeof(null_node));
+    return null_node;
+  }
+  return ts_node_descendant_for_byte_range(ts_tree_root_node(tree), start, end);
+}
+
+// Whether any chunk has a syntax error. A chunk without a tree counts as
+// one; an empty `self` has none.
+static inline bool tree_sitter_vjass_chunked_has_error(const TSVjassChunkedTree *self) {
+  for (uint32_t i = 0; i < self->count; i++) {
+    if (!self->trees[i] || ts_node_has_error(ts_tree_root_node(self->trees[i]))) return true;
+  }
+  return false;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VJASS_SPLIT_H_
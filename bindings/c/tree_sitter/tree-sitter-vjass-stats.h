@@ -0,0 +1,211 @@
+#ifndef TREE_SITTER_VJASS_STATS_H_
+#define TREE_SITTER_VJASS_STATS_H_
+
+// Allocation accounting for the tree-sitter runtime.
+//
+// With the accounting hooks installed, every allocation made by the runtime
+// (and by the external scanner, when the grammar is built with
+// TREE_SITTER_REUSE_ALLOCATOR) is counted on the calling thread: number of
+// allocations, bytes requested, live and peak live bytes, and a histogram of
+// request sizes. Reset the counters before a parse and read them afterwards
+// to see what that parse cost:
+//
+//   tree_sitter_vjass_stats_install();        // once, before any parser exists
+//   ...
+//   TSVjassAllocStats stats;
+//   TSTree *tree = tree_sitter_vjass_parse_string_with_stats(parser, NULL, source, length, &stats);
+//   printf("%llu allocations, peak %lld bytes\n", stats.allocations, stats.peak_live_bytes);
+//
+// Every block carries a small header with its size, so the hooks have to be
+// installed before the runtime allocates anything and must stay installed
+// while any of those blocks are alive. Counters are per thread; a block
+// freed on another thread than the one that allocated it is subtracted from
+// the freeing thread's live bytes, which can then go negative.
+//
+// The hooks cost a header and a few counter updates per allocation, so
+// install them only where allocations are being measured.
+//
+// The backend and the counters exist once per program, so exactly one C or
+// C++ file must define them:
+//
+//   #define TREE_SITTER_VJASS_STATS_IMPLEMENTATION
+//   #include <tree_sitter/tree-sitter-vjass-stats.h>
+//
+// Every other file includes the header as usual and gets declarations
+// only. Include <tree_sitter/api.h> and link the tree-sitter runtime.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TREE_SITTER_VJASS_STATS_THREAD_LOCAL __declspec(thread)
+#elif defined(__cplusplus)
+#define TREE_SITTER_VJASS_STATS_THREAD_LOCAL thread_local
+#else
+#define TREE_SITTER_VJASS_STATS_THREAD_LOCAL _Thread_local
+#endif
+
+// Bucket i counts requests of at most 16 << i bytes; the last bucket counts
+// everything larger than 256 KiB.
+#define TREE_SITTER_VJASS_STATS_MIN_SHIFT 4
+#define TREE_SITTER_VJASS_STATS_BUCKETS 16
+
+typedef struct {
+  uint64_t allocations;     // malloc, calloc and realloc calls
+  uint64_t frees;
+  uint64_t bytes;           // bytes requested, summed over all allocations
+  int64_t live_bytes;       // allocated minus freed since the last reset
+  int64_t peak_live_bytes;  // maximum of live_bytes since the last reset
+  uint64_t histogram[TREE_SITTER_VJASS_STATS_BUCKETS];
+} TSVjassAllocStats;
+
+typedef union {
+  size_t size;
+  max_align_t align;
+} TSVjassStatsHeader;
+
+typedef struct {
+  void *(*malloc_fn)(size_t);
+  void *(*realloc_fn)(void *, size_t);
+  void (*free_fn)(void *);
+} TSVjassStatsBackend;
+
+// Upper bound (inclusive) of histogram bucket `i`, or 0 for the last one.
+static inline size_t tree_sitter_vjass_stats_bucket_limit(unsigned i) {
+  if (i + 1 >= TREE_SITTER_VJASS_STATS_BUCKETS) return 0;
+  return (size_t)1 << (i + TREE_SITTER_VJASS_STATS_MIN_SHIFT);
+}
+
+static inline unsigned tree_sitter_vjass_stats_bucket(size_t size) {
+  unsigned bucket = 0;
+  size_t limit = (size_t)1 << TREE_SITTER_VJASS_STATS_MIN_SHIFT;
+  while (limit < size && bucket + 1 < TREE_SITTER_VJASS_STATS_BUCKETS) {
+    limit <<= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+// The allocator hooks, for ts_set_allocator().
+void *tree_sitter_vjass_stats_malloc(size_t size);
+void *tree_sitter_vjass_stats_calloc(size_t count, size_t size);
+void *tree_sitter_vjass_stats_realloc(void *ptr, size_t size);
+void tree_sitter_vjass_stats_free(void *ptr);
+
+// Routes every tree-sitter allocation through the accounting hooks, which
+// get their memory from `backend` (libc when NULL). Passing the arena from
+// tree-sitter-vjass-arena.h as the backend measures it as well.
+void tree_sitter_vjass_stats_install_over(const TSVjassStatsBackend *backend);
+void tree_sitter_vjass_stats_install(void);
+
+// Whether the hooks have been installed.
+bool tree_sitter_vjass_stats_installed(void);
+
+// Zeroes the calling thread's counters; live bytes start again from 0.
+void tree_sitter_vjass_stats_reset(void);
+
+// Counters of the calling thread since the last reset.
+TSVjassAllocStats tree_sitter_vjass_stats(void);
+
+// Resets the counters, parses `source` and stores what the parse cost in
+// `stats`. The tree is still alive, so `live_bytes` is its footprint plus
+// whatever the parser kept for the next parse.
+static inline TSTree *tree_sitter_vjass_parse_string_with_stats(TSParser *parser, const TSTree *old_tree,
+                                                                const char *source, uint32_t length,
+                                                                TSVjassAllocStats *stats) {
+  tree_sitter_vjass_stats_reset();
+  TSTree *tree = ts_parser_parse_string(parser, old_tree, source, length);
+  *stats = tree_sitter_vjass_stats();
+  return tree;
+}
+
+#ifdef TREE_SITTER_VJASS_STATS_IMPLEMENTATION
+
+static TSVjassStatsBackend tree_sitter_vjass_stats_backend = {malloc, realloc, free};
+static bool tree_sitter_vjass_stats_is_installed;
+static TREE_SITTER_VJASS_STATS_THREAD_LOCAL TSVjassAllocStats tree_sitter_vjass_stats_counters;
+
+static void tree_sitter_vjass_stats_record(size_t size, size_t old_size) {
+  TSVjassAllocStats *stats = &tree_sitter_vjass_stats_counters;
+  stats->allocations++;
+  stats->bytes += size;
+  stats->histogram[tree_sitter_vjass_stats_bucket(size)]++;
+  stats->live_bytes += (int64_t)size - (int64_t)old_size;
+  if (stats->live_bytes > stats->peak_live_bytes) stats->peak_live_bytes = stats->live_bytes;
+}
+
+void *tree_sitter_vjass_stats_malloc(size_t size) {
+  TSVjassStatsHeader *header =
+      (TSVjassStatsHeader *)tree_sitter_vjass_stats_backend.malloc_fn(sizeof(TSVjassStatsHeader) + size);
+  if (!header) {
+    fprintf(stderr, "tree-sitter-vjass: failed to allocate %zu bytes\n", size);
+    abort();
+  }
+  header->size = size;
+  tree_sitter_vjass_stats_record(size, 0);
+  return header + 1;
+}
+
+void *tree_sitter_vjass_stats_calloc(size_t count, size_t size) {
+  if (size != 0 && count > SIZE_MAX / size) return NULL;
+  void *ptr = tree_sitter_vjass_stats_malloc(count * size);
+  memset(ptr, 0, count * size);
+  return ptr;
+}
+
+void *tree_sitter_vjass_stats_realloc(void *ptr, size_t size) {
+  if (!ptr) return tree_sitter_vjass_stats_malloc(size);
+  TSVjassStatsHeader *header = (TSVjassStatsHeader *)ptr - 1;
+  size_t old_size = header->size;
+  header = (TSVjassStatsHeader *)tree_sitter_vjass_stats_backend.realloc_fn(header, sizeof(TSVjassStatsHeader) + size);
+  if (!header) {
+    fprintf(stderr, "tree-sitter-vjass: failed to reallocate %zu bytes\n", size);
+    abort();
+  }
+  header->size = size;
+  tree_sitter_vjass_stats_record(size, old_size);
+  return header + 1;
+}
+
+void tree_sitter_vjass_stats_free(void *ptr) {
+  if (!ptr) return;
+  TSVjassStatsHeader *header = (TSVjassStatsHeader *)ptr - 1;
+  tree_sitter_vjass_stats_counters.frees++;
+  tree_sitter_vjass_stats_counters.live_bytes -= (int64_t)header->size;
+  tree_sitter_vjass_stats_backend.free_fn(header);
+}
+
+void tree_sitter_vjass_stats_install_over(const TSVjassStatsBackend *backend) {
+  if (backend) tree_sitter_vjass_stats_backend = *backend;
+  ts_set_allocator(tree_sitter_vjass_stats_malloc, tree_sitter_vjass_stats_calloc,
+                   tree_sitter_vjass_stats_realloc, tree_sitter_vjass_stats_free);
+  tree_sitter_vjass_stats_is_installed = true;
+}
+
+void tree_sitter_vjass_stats_install(void) { tree_sitter_vjass_stats_install_over(NULL); }
+
+bool tree_sitter_vjass_stats_installed(void) { return tree_sitter_vjass_stats_is_installed; }
+
+void tree_sitter_vjass_stats_reset(void) {
+  memset(&tree_sitter_vjass_stats_counters, 0, sizeof(tree_sitter_vjass_stats_counters));
+}
+
+TSVjassAllocStats tree_sitter_vjass_stats(void) { return tree_sitter_vjass_stats_counters; }
+
+#endif // TREE_SITTER_VJASS_STATS_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VJASS_STATS_H_
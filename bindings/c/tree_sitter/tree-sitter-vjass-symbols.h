@@ -0,0 +1,132 @@
+#ifndef TREE_SITTER_VJASS_SYMBOLS_H_
+#define TREE_SITTER_VJASS_SYMBOLS_H_
+
+// Generated by generate-symbols.js from src/parser.c; do not edit.
+//
+// Kind ids of the named node types of tree_sitter_vjass(), as returned by
+// ts_node_symbol(), and its field ids, as returned by
+// ts_tree_cursor_current_field_id(). Switch on these instead of comparing
+// ts_node_type() strings. They change whenever src/parser.c is
+// regenerated, so compare them only against trees of the same build. The
+// outline language has ids of its own.
+
+typedef enum {
+  TREE_SITTER_VJASS_SYM_ID = 1,
+  TREE_SITTER_VJASS_SYM_STRUCT_ = 2,
+  TREE_SITTER_VJASS_SYM_ENDSTRUCT_ = 3,
+  TREE_SITTER_VJASS_SYM_GLOBALS_ = 4,
+  TREE_SITTER_VJASS_SYM_ENDGLOBALS_ = 5,
+  TREE_SITTER_VJASS_SYM_LOOP_ = 6,
+  TREE_SITTER_VJASS_SYM_ENDLOOP_ = 7,
+  TREE_SITTER_VJASS_SYM_RAWCODE = 26,
+  TREE_SITTER_VJASS_SYM_NUMBER = 27,
+  TREE_SITTER_VJASS_SYM_FLOAT = 28,
+  TREE_SITTER_VJASS_SYM_LOCAL = 29,
+  TREE_SITTER_VJASS_SYM_CONSTANT = 30,
+  TREE_SITTER_VJASS_SYM_ARRAY = 31,
+  TREE_SITTER_VJASS_SYM_SET_ = 34,
+  TREE_SITTER_VJASS_SYM_CALL_ = 35,
+  TREE_SITTER_VJASS_SYM_RETURN_ = 36,
+  TREE_SITTER_VJASS_SYM_EXITWHEN_ = 37,
+  TREE_SITTER_VJASS_SYM_IF_ = 38,
+  TREE_SITTER_VJASS_SYM_THEN_ = 39,
+  TREE_SITTER_VJASS_SYM_ELSEIF_ = 40,
+  TREE_SITTER_VJASS_SYM_ELSE_ = 41,
+  TREE_SITTER_VJASS_SYM_ENDIF_ = 42,
+  TREE_SITTER_VJASS_SYM_FUNCTION_ = 43,
+  TREE_SITTER_VJASS_SYM_TAKES_ = 44,
+  TREE_SITTER_VJASS_SYM_NOTHING = 45,
+  TREE_SITTER_VJASS_SYM_RETURNS_ = 46,
+  TREE_SITTER_VJASS_SYM_ENDFUNCTION_ = 47,
+  TREE_SITTER_VJASS_SYM_PROGRAM = 56,
+  TREE_SITTER_VJASS_SYM_STRUCT = 59,
+  TREE_SITTER_VJASS_SYM_GLOBALS = 60,
+  TREE_SITTER_VJASS_SYM_LOOP = 61,
+  TREE_SITTER_VJASS_SYM_EXPR = 62,
+  TREE_SITTER_VJASS_SYM_VAR_STMT = 63,
+  TREE_SITTER_VJASS_SYM_VAR_DECL = 64,
+  TREE_SITTER_VJASS_SYM_STRING = 65,
+  TREE_SITTER_VJASS_SYM_SET_STATEMENT = 66,
+  TREE_SITTER_VJASS_SYM_CALL_STATEMENT = 67,
+  TREE_SITTER_VJASS_SYM_RETURN_STATEMENT = 68,
+  TREE_SITTER_VJASS_SYM_EXITWHEN_STATEMENT = 69,
+  TREE_SITTER_VJASS_SYM_IF_STATEMENT = 70,
+  TREE_SITTER_VJASS_SYM_FUNCTION = 71,
+  TREE_SITTER_VJASS_SYM_PARAMETER_LIST = 72,
+  TREE_SITTER_VJASS_SYM_PARAMETER = 73,
+  TREE_SITTER_VJASS_SYM_FUNCTION_CALL = 74,
+  TREE_SITTER_VJASS_SYM_FUNCTION_ARGUMENTS = 75,
+  TREE_SITTER_VJASS_SYM_COMMENT = 76,
+  TREE_SITTER_VJASS_SYM_FUNCTION_CALL_PAREN = 84,
+} TSVjassSymbol;
+
+typedef enum {
+  TREE_SITTER_VJASS_FIELD_ARGS = 1,
+  TREE_SITTER_VJASS_FIELD_CONDITION = 2,
+  TREE_SITTER_VJASS_FIELD_CONTENT = 3,
+  TREE_SITTER_VJASS_FIELD_END = 4,
+  TREE_SITTER_VJASS_FIELD_NAME = 5,
+  TREE_SITTER_VJASS_FIELD_PREFIX = 6,
+  TREE_SITTER_VJASS_FIELD_RETURNS = 7,
+  TREE_SITTER_VJASS_FIELD_START = 8,
+  TREE_SITTER_VJASS_FIELD_TYPE = 9,
+  TREE_SITTER_VJASS_FIELD_VALUE = 10,
+} TSVjassField;
+
+// X(NAME, name) for every symbol above, NAME as in
+// TREE_SITTER_VJASS_SYM_NAME and name its lower-case form; the C++
+// visitor in tree-sitter-vjass.hpp builds its hooks from this.
+#define TREE_SITTER_VJASS_SYMBOL_LIST(X) \
+  X(ID, id) \
+  X(STRUCT_, struct_) \
+  X(ENDSTRUCT_, endstruct_) \
+  X(GLOBALS_, globals_) \
+  X(ENDGLOBALS_, endglobals_) \
+  X(LOOP_, loop_) \
+  X(ENDLOOP_, endloop_) \
+  X(RAWCODE, rawcode) \
+  X(NUMBER, number) \
+  X(FLOAT, float) \
+  X(LOCAL, local) \
+  X(CONSTANT, constant) \
+  X(ARRAY, array) \
+  X(SET_, set_) \
+  X(CALL_, call_) \
+  X(RETURN_, return_) \
+  X(EXITWHEN_, exitwhen_) \
+  X(IF_, if_) \
+  X(THEN_, then_) \
+  X(ELSEIF_, elseif_) \
+  X(ELSE_, else_) \
+  X(ENDIF_, endif_) \
+  X(FUNCTION_, function_) \
+  X(TAKES_, takes_) \
+  X(NOTHING, nothing) \
+  X(RETURNS_, returns_) \
+  X(ENDFUNCTION_, endfunction_) \
+  X(PROGRAM, program) \
+  X(STRUCT, struct) \
+  X(GLOBALS, globals) \
+  X(LOOP, loop) \
+  X(EXPR, expr) \
+  X(VAR_STMT, var_stmt) \
+  X(VAR_DECL, var_decl) \
+  X(STRING, string) \
+  X(SET_STATEMENT, set_statement) \
+  X(CALL_STATEMENT, call_statement) \
+  X(RETURN_STATEMENT, return_statement) \
+  X(EXITWHEN_STATEMENT, exitwhen_statement) \
+  X(IF_STATEMENT, if_statement) \
+  X(FUNCTION, function) \
+  X(PARAMETER_LIST, parameter_list) \
+  X(PARAMETER, parameter) \
+  X(FUNCTION_CALL, function_call) \
+  X(FUNCTION_ARGUMENTS, function_arguments) \
+  X(COMMENT, comment) \
+  X(FUNCTION_CALL_PAREN, function_call_paren)
+
+// Identifies src/parser.c and src/scanner.c; tree-sitter-vjass-cache.h
+// seeds its keys with it.
+#define TREE_SITTER_VJASS_GRAMMAR_HASH 0x1929f035bad0588eull
+
+#endif // TREE_SITTER_VJASS_SYMBOLS_H_
@@ -0,0 +1,151 @@
+#ifndef TREE_SITTER_VJASS_TABLE_H_
+#define TREE_SITTER_VJASS_TABLE_H_
+
+// Flat node table: a whole tree as a structure of arrays.
+//
+// Walking a tree through ts_node_child(node, i) costs O(i) per call, so
+// visiting all children of a node that way is quadratic, and every step
+// goes through the runtime's subtree pointers. The table is built in one
+// TSTreeCursor pass and lists every node in preorder, one array per field;
+// links between nodes are indices into the same arrays:
+//
+//   TSVjassNodeTable table;
+//   tree_sitter_vjass_node_table_build(tree, &table);
+//   for (uint32_t i = 0; i < table.count; i++) {            // every node
+//     if (table.symbol[i] == symbol) ...
+//   }
+//   for (uint32_t c = table.first_child[n]; c != TREE_SITTER_VJASS_NONE; c = table.next_sibling[c]) {
+//     ...                                                     // children of n
+//   }
+//   tree_sitter_vjass_node_table_delete(&table);
+//
+// Preorder means the subtree of node n is the index range
+// [n, n + subtree size), and a node's parent always comes before it. The
+// table holds no pointers into the tree, so it outlives it and can be
+// stored (see tree-sitter-vjass-cache.h).
+//
+// Header-only; include <tree_sitter/api.h> and link the tree-sitter runtime.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// No parent, child or sibling.
+#define TREE_SITTER_VJASS_NONE UINT32_MAX
+
+// TSVjassNodeTable.flags
+#define TREE_SITTER_VJASS_NODE_NAMED 0x1
+#define TREE_SITTER_VJASS_NODE_EXTRA 0x2
+#define TREE_SITTER_VJASS_NODE_ERROR 0x4
+#define TREE_SITTER_VJASS_NODE_MISSING 0x8
+
+// The uint32_t arrays come first and the uint16_t ones last, in this order,
+// in one block that starts at `start_byte`.
+typedef struct {
+  uint32_t count;
+  uint32_t *start_byte;
+  uint32_t *end_byte;
+  uint32_t *parent;       // TREE_SITTER_VJASS_NONE for the root (node 0)
+  uint32_t *first_child;  // TREE_SITTER_VJASS_NONE for leaves
+  uint32_t *next_sibling; // TREE_SITTER_VJASS_NONE for last children
+  uint16_t *symbol;       // ts_node_symbol(), so aliases have their alias symbol
+  uint16_t *flags;        // TREE_SITTER_VJASS_NODE_*
+} TSVjassNodeTable;
+
+#define TREE_SITTER_VJASS_NODE_TABLE_U32_ARRAYS 5
+#define TREE_SITTER_VJASS_NODE_TABLE_U16_ARRAYS 2
+
+// Bytes of the arrays of a table with `count` nodes.
+static inline size_t tree_sitter_vjass_node_table_size(uint32_t count) {
+  return (size_t)count * (TREE_SITTER_VJASS_NODE_TABLE_U32_ARRAYS * sizeof(uint32_t) +
+                          TREE_SITTER_VJASS_NODE_TABLE_U16_ARRAYS * sizeof(uint16_t));
+}
+
+// Allocates the arrays for `count` nodes, uninitialized. One spare byte at
+// the end lets readers detect input that is longer than the table.
+static inline bool tree_sitter_vjass_node_table_alloc(TSVjassNodeTable *self, uint32_t count) {
+  memset(self, 0, sizeof(*self));
+  char *block = (char *)malloc(tree_sitter_vjass_node_table_size(count) + 1);
+  if (!block) return false;
+  self->count = count;
+  self->start_byte = (uint32_t *)block;
+  self->end_byte = self->start_byte + count;
+  self->parent = self->end_byte + count;
+  self->first_child = self->parent + count;
+  self->next_sibling = self->first_child + count;
+  self->symbol = (uint16_t *)(self->next_sibling + count);
+  self->flags = self->symbol + count;
+  return true;
+}
+
+static inline void tree_sitter_vjass_node_table_delete(TSVjassNodeTable *self) {
+  free(self->start_byte);
+  memset(self, 0, sizeof(*self));
+}
+
+// Flattens `tree` in one TSTreeCursor pass.
+static inline bool tree_sitter_vjass_node_table_build(const TSTree *tree, TSVjassNodeTable *self) {
+  TSNode root = ts_tree_root_node(tree);
+  if (!tree_sitter_vjass_node_table_alloc(self, ts_node_descendant_count(root))) return false;
+
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  uint32_t index = 0, parent = TREE_SITTER_VJASS_NONE, previous = TREE_SITTER_VJASS_NONE;
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    self->start_byte[index] = ts_node_start_byte(node);
+    self->end_byte[index] = ts_node_end_byte(node);
+    self->parent[index] = parent;
+    self->first_child[index] = TREE_SITTER_VJASS_NONE;
+    self->next_sibling[index] = TREE_SITTER_VJASS_NONE;
+    self->symbol[index] = ts_node_symbol(node);
+    self->flags[index] = (uint16_t)((ts_node_is_named(node) ? TREE_SITTER_VJASS_NODE_NAMED : 0) |
+                                    (ts_node_is_extra(node) ? TREE_SITTER_VJASS_NODE_EXTRA : 0) |
+                                    (ts_node_is_error(node) ? TREE_SITTER_VJASS_NODE_ERROR : 0) |
+                                    (ts_node_is_missing(node) ? TREE_SITTER_VJASS_NODE_MISSING : 0));
+    if (previous != TREE_SITTER_VJASS_NONE) {
+      self->next_sibling[previous] = index;
+    } else if (parent != TREE_SITTER_VJASS_NONE) {
+      self->first_child[parent] = index;
+    }
+    uint32_t last = index++;
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      parent = last;
+      previous = TREE_SITTER_VJASS_NONE;
+      continue;
+    }
+    // Climb until a sibling is found; `last` follows the cursor up.
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        self->count = index;
+        return true;
+      }
+      last = self->parent[last];
+    }
+    previous = last;
+    parent = self->parent[last];
+  }
+}
+
+// Number of nodes in the subtree of `node`, itself included.
+static inline uint32_t tree_sitter_vjass_node_table_subtree_size(const TSVjassNodeTable *self, uint32_t node) {
+  for (uint32_t n = node; n != TREE_SITTER_VJASS_NONE; n = self->parent[n]) {
+    if (self->next_sibling[n] != TREE_SITTER_VJASS_NONE) return self->next_sibling[n] - node;
+  }
+  return self->count - node;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TREE_SITTER_VJASS_TABLE_H_
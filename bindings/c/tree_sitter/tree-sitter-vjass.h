@@ -9,6 +9,12 @@ extern "C" {
 
 const TSLanguage *tree_sitter_vjass(void);
 
+// Outline language for indexing: globals, structs and function headers
+// parse as with tree_sitter_vjass(), but each function body is a single
+// `function_body` leaf that is never parsed. Generated from the same
+// grammar.js into src/outline (see generate.sh).
+const TSLanguage *tree_sitter_vjass_outline(void);
+
 #ifdef __cplusplus
 }
 #endif
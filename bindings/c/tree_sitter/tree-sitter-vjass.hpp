@@ -0,0 +1,252 @@
+#ifndef TREE_SITTER_VJASS_HPP_
+#define TREE_SITTER_VJASS_HPP_
+
+// C++17 wrapper: owning parser and tree handles, a parser pool for worker
+// threads, and a CRTP visitor.
+//
+//   tree_sitter::vjass::ParserPool pool;
+//
+//   struct Calls : tree_sitter::vjass::Visitor<Calls> {
+//     size_t exprs = 0;
+//     bool enter_expr(TSNode) { exprs++; return true; }
+//   };
+//
+//   auto parser = pool.acquire();                 // on any thread
+//   tree_sitter::vjass::Tree tree = parser->parse(source);
+//   Calls calls;
+//   calls.walk(tree);
+//
+// The visitor has an enter_<kind>(TSNode) and leave_<kind>(TSNode) hook for
+// every named node kind in tree-sitter-vjass-symbols.h. A walk switches on
+// ts_node_symbol() to reach them, so there are no string compares and no
+// virtual calls; a derived class hides the hooks it cares about, and every
+// other node goes to enter_node() / leave_node(). Hooks must be public.
+//
+// Header-only; include <tree_sitter/api.h> and link the tree-sitter runtime.
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-symbols.h>
+#include <tree_sitter/tree-sitter-vjass.h>
+
+namespace tree_sitter::vjass {
+
+// An owned TSTree; empty when a parse was cancelled or timed out.
+class Tree {
+ public:
+  Tree() = default;
+  explicit Tree(TSTree *tree) : tree_(tree) {}
+  Tree(Tree &&other) noexcept : tree_(std::exchange(other.tree_, nullptr)) {}
+  Tree &operator=(Tree &&other) noexcept {
+    std::swap(tree_, other.tree_);
+    return *this;
+  }
+  Tree(const Tree &) = delete;
+  Tree &operator=(const Tree &) = delete;
+  ~Tree() { ts_tree_delete(tree_); }
+
+  explicit operator bool() const { return tree_ != nullptr; }
+  TSTree *get() const { return tree_; }
+  TSTree *release() { return std::exchange(tree_, nullptr); }
+
+  // A null node (ts_node_is_null) when the tree is empty.
+  TSNode root() const { return tree_ ? ts_tree_root_node(tree_) : TSNode{}; }
+  bool has_error() const { return tree_ && ts_node_has_error(root()); }
+  // A cheap copy for another thread; trees are not thread-safe themselves.
+  Tree copy() const { return Tree(tree_ ? ts_tree_copy(tree_) : nullptr); }
+  void edit(const TSInputEdit &edit) {
+    if (tree_) ts_tree_edit(tree_, &edit);
+  }
+
+ private:
+  TSTree *tree_ = nullptr;
+};
+
+// An owned TSParser, set to tree_sitter_vjass() unless told otherwise.
+class Parser {
+ public:
+  explicit Parser(const TSLanguage *language = tree_sitter_vjass()) : parser_(ts_parser_new()) {
+    if (!ts_parser_set_language(parser_, language)) {
+      ts_parser_delete(parser_);
+      throw std::runtime_error("tree-sitter-vjass: incompatible language version");
+    }
+  }
+  Parser(Parser &&other) noexcept : parser_(std::exchange(other.parser_, nullptr)) {}
+  Parser &operator=(Parser &&other) noexcept {
+    std::swap(parser_, other.parser_);
+    return *this;
+  }
+  Parser(const Parser &) = delete;
+  Parser &operator=(const Parser &) = delete;
+  ~Parser() { ts_parser_delete(parser_); }
+
+  TSParser *get() const { return parser_; }
+
+  // Parses `source`, reusing `old` (edited to match) when given. Sources
+  // of 4 GiB and more cannot be parsed.
+  Tree parse(std::string_view source, const Tree *old = nullptr) {
+    return Tree(ts_parser_parse_string(parser_, old ? old->get() : nullptr, source.data(),
+                                       static_cast<uint32_t>(source.size())));
+  }
+  Tree parse(const TSInput &input, const Tree *old = nullptr) {
+    return Tree(ts_parser_parse(parser_, old ? old->get() : nullptr, input));
+  }
+
+  // Drops the state of an interrupted parse.
+  void reset() { ts_parser_reset(parser_); }
+
+ private:
+  TSParser *parser_;
+};
+
+// Parsers for worker threads. acquire() hands out an idle parser, or a new
+// one when none is idle; the lease gives it back when it goes out of scope.
+// A thread that keeps its lease across files keeps its parser, and its
+// warmed-up buffers, to itself. At most `max_idle` parsers are kept; the
+// pool must outlive its leases.
+class ParserPool {
+ public:
+  class Lease {
+   public:
+    Lease(Lease &&other) noexcept : pool_(std::exchange(other.pool_, nullptr)), parser_(std::move(other.parser_)) {}
+    Lease &operator=(Lease &&) = delete;
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    ~Lease() {
+      if (pool_) pool_->release(std::move(parser_));
+    }
+
+    Parser &operator*() { return parser_; }
+    Parser *operator->() { return &parser_; }
+
+   private:
+    friend class ParserPool;
+    Lease(ParserPool *pool, Parser parser) : pool_(pool), parser_(std::move(parser)) {}
+
+    ParserPool *pool_;
+    Parser parser_;
+  };
+
+  explicit ParserPool(size_t max_idle = std::thread::hardware_concurrency(),
+                      const TSLanguage *language = tree_sitter_vjass())
+      : language_(language), max_idle_(max_idle ? max_idle : 1) {}
+  ParserPool(const ParserPool &) = delete;
+  ParserPool &operator=(const ParserPool &) = delete;
+
+  Lease acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_.empty()) {
+        Parser parser = std::move(idle_.back());
+        idle_.pop_back();
+        return Lease(this, std::move(parser));
+      }
+    }
+    return Lease(this, Parser(language_));
+  }
+
+  size_t idle() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_.size();
+  }
+
+ private:
+  void release(Parser parser) {
+    parser.reset();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_.size() < max_idle_) idle_.push_back(std::move(parser));
+  }
+
+  const TSLanguage *language_;
+  size_t max_idle_;
+  mutable std::mutex mutex_;
+  std::vector<Parser> idle_;
+};
+
+// Preorder walk with per-kind hooks; see the top of this file. enter
+// hooks return whether to descend into the node's children; leave hooks
+// run for every entered node, children skipped or not. Walking an empty
+// tree or a null node calls no hook.
+template <class Derived>
+class Visitor {
+ public:
+  void walk(const Tree &tree) { walk(tree.root()); }
+
+  void walk(TSNode root) {
+    if (ts_node_is_null(root)) return;
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    for (;;) {
+      if (enter(ts_tree_cursor_current_node(&cursor)) && ts_tree_cursor_goto_first_child(&cursor)) continue;
+      for (;;) {
+        if constexpr (has_leave_hooks()) leave(ts_tree_cursor_current_node(&cursor));
+        if (ts_tree_cursor_goto_next_sibling(&cursor)) break;
+        if (!ts_tree_cursor_goto_parent(&cursor)) {
+          ts_tree_cursor_delete(&cursor);
+          return;
+        }
+      }
+    }
+  }
+
+  // Every node without a hook of its own: anonymous nodes, errors and the
+  // kinds a derived class leaves alone.
+  bool enter_node(TSNode) { return true; }
+  void leave_node(TSNode) {}
+
+#define TREE_SITTER_VJASS_HOOKS(NAME, name)                             \
+  bool enter_##name(TSNode node) { return derived().enter_node(node); } \
+  void leave_##name(TSNode node) { derived().leave_node(node); }
+  TREE_SITTER_VJASS_SYMBOL_LIST(TREE_SITTER_VJASS_HOOKS)
+#undef TREE_SITTER_VJASS_HOOKS
+
+ private:
+  Derived &derived() { return static_cast<Derived &>(*this); }
+
+  // Whether Derived hides any leave hook; without one, walks skip the
+  // leave dispatch and its ts_node_symbol() call altogether.
+  static constexpr bool has_leave_hooks() {
+    using Hook = void (Visitor::*)(TSNode);
+    return !std::is_same_v<decltype(&Derived::leave_node), Hook>
+#define TREE_SITTER_VJASS_HIDES(NAME, name) || !std::is_same_v<decltype(&Derived::leave_##name), Hook>
+        TREE_SITTER_VJASS_SYMBOL_LIST(TREE_SITTER_VJASS_HIDES)
+#undef TREE_SITTER_VJASS_HIDES
+        ;
+  }
+
+  bool enter(TSNode node) {
+    switch (ts_node_symbol(node)) {
+#define TREE_SITTER_VJASS_ENTER(NAME, name) \
+  case TREE_SITTER_VJASS_SYM_##NAME:        \
+    return derived().enter_##name(node);
+      TREE_SITTER_VJASS_SYMBOL_LIST(TREE_SITTER_VJASS_ENTER)
+#undef TREE_SITTER_VJASS_ENTER
+      default:
+        return derived().enter_node(node);
+    }
+  }
+
+  void leave(TSNode node) {
+    switch (ts_node_symbol(node)) {
+#define TREE_SITTER_VJASS_LEAVE(NAME, name) \
+  case TREE_SITTER_VJASS_SYM_##NAME:        \
+    return derived().leave_##name(node);
+      TREE_SITTER_VJASS_SYMBOL_LIST(TREE_SITTER_VJASS_LEAVE)
+#undef TREE_SITTER_VJASS_LEAVE
+      default:
+        return derived().leave_node(node);
+    }
+  }
+};
+
+} // namespace tree_sitter::vjass
+
+#endif // TREE_SITTER_VJASS_HPP_
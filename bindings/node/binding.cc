@@ -1,5 +1,23 @@
 #include <napi.h>
 
+#ifdef TREE_SITTER_VJASS_RUNTIME
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#define TREE_SITTER_VJASS_STATS_IMPLEMENTATION
+#include <tree_sitter/tree-sitter-vjass-stats.h>
+#include <tree_sitter/tree-sitter-vjass-table.h>
+#endif
+
 typedef struct TSLanguage TSLanguage;
 
 extern "C" TSLanguage *tree_sitter_vjass();
@@ -9,10 +27,427 @@ const napi_type_tag LANGUAGE_TYPE_TAG = {
     0x8AF2E5212AD58ABF, 0xD5006CAD83ABBA16
 };
 
+#ifdef TREE_SITTER_VJASS_RUNTIME
+// Why ts_parser_set_language() fails: the parser was generated for a newer
+// ABI than the runtime from the `tree-sitter` package supports.
+static const char LANGUAGE_VERSION_ERROR[] =
+    "the tree-sitter runtime built into this addon cannot load this grammar's ABI version; "
+    "install tree-sitter >= 0.25 and rebuild";
+
+// The `source: string | Buffer` first argument of the synchronous helpers.
+// A Buffer is used in place; a string is copied into `text`.
+struct SourceArgument {
+    SourceArgument(const Napi::CallbackInfo &info, const char *name) {
+        if (info.Length() > 0 && info[0].IsBuffer()) {
+            auto buffer = info[0].As<Napi::Buffer<char>>();
+            data = buffer.Data();
+            length = buffer.Length();
+        } else if (info.Length() > 0 && info[0].IsString()) {
+            text = info[0].As<Napi::String>().Utf8Value();
+            data = text.data();
+            length = text.size();
+        } else {
+            throw Napi::TypeError::New(info.Env(), std::string(name) + ": expected a string or a Buffer");
+        }
+        if (length > UINT32_MAX) {
+            throw Napi::RangeError::New(info.Env(), std::string(name) + ": source is larger than 4 GiB");
+        }
+    }
+
+    std::string text;
+    const char *data = nullptr;
+    size_t length = 0;
+};
+
+// Whether TREE_SITTER_VJASS_ALLOC_STATS asks for allocation accounting.
+static bool AllocStatsRequested() {
+    const char *value = std::getenv("TREE_SITTER_VJASS_ALLOC_STATS");
+    return value && *value && std::strcmp(value, "0") != 0;
+}
+
+// allocStats(source: string | Buffer): parses `source` with the runtime
+// built into this addon and reports what the parse allocated. Throws
+// unless the addon was loaded with TREE_SITTER_VJASS_ALLOC_STATS=1.
+Napi::Value AllocStats(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (!tree_sitter_vjass_stats_installed()) {
+        throw Napi::Error::New(env, "allocStats: allocation accounting is off; "
+                                    "set TREE_SITTER_VJASS_ALLOC_STATS=1 before loading the addon");
+    }
+    SourceArgument argument(info, "allocStats");
+    const char *source = argument.data;
+    size_t length = argument.length;
+
+    TSParser *parser = ts_parser_new();
+    if (!ts_parser_set_language(parser, tree_sitter_vjass())) {
+        ts_parser_delete(parser);
+        throw Napi::Error::New(env, std::string("allocStats: ") + LANGUAGE_VERSION_ERROR);
+    }
+    TSVjassAllocStats stats;
+    TSTree *tree = tree_sitter_vjass_parse_string_with_stats(parser, NULL, source, (uint32_t)length, &stats);
+    ts_tree_delete(tree);
+    ts_parser_delete(parser);
+
+    auto histogram = Napi::Array::New(env, TREE_SITTER_VJASS_STATS_BUCKETS);
+    for (uint32_t i = 0; i < TREE_SITTER_VJASS_STATS_BUCKETS; i++) {
+        histogram[i] = Napi::Number::New(env, (double)stats.histogram[i]);
+    }
+    auto result = Napi::Object::New(env);
+    result["allocations"] = Napi::Number::New(env, (double)stats.allocations);
+    result["frees"] = Napi::Number::New(env, (double)stats.frees);
+    result["bytes"] = Napi::Number::New(env, (double)stats.bytes);
+    result["liveBytes"] = Napi::Number::New(env, (double)stats.live_bytes);
+    result["peakLiveBytes"] = Napi::Number::New(env, (double)stats.peak_live_bytes);
+    result["histogram"] = histogram;
+    return result;
+}
+
+// The parser of the calling thread: a libuv pool thread, or the main thread
+// for exportTree(). Pool threads live as long as the process, so each one
+// creates its parser once and deletes it on exit. NULL if the runtime built
+// into this addon cannot load the language.
+static TSParser *ThreadParser() {
+    struct Holder {
+        TSParser *parser = nullptr;
+        ~Holder() {
+            if (parser) ts_parser_delete(parser);
+        }
+    };
+    thread_local Holder holder;
+    if (!holder.parser) {
+        holder.parser = ts_parser_new();
+        if (!ts_parser_set_language(holder.parser, tree_sitter_vjass())) {
+            ts_parser_delete(holder.parser);
+            holder.parser = nullptr;
+        }
+    }
+    return holder.parser;
+}
+
+// What an async parse hands back to JS. The tree itself stays native and is
+// deleted on the pool thread; only this summary, and its node table when
+// asked for, crosses over.
+struct ParseResult {
+    std::string path;
+    uint32_t bytes = 0;
+    uint32_t nodes = 0;
+    bool has_error = false;
+    double parse_ms = 0;
+    int error = 0;  // errno of a file that could not be read
+    bool failed = false;
+    TSVjassNodeTable table = {};  // owned until handed to JS
+};
+
+// Fills `result` from `tree`, flattening it into `result.table` if `table`
+// is set, and deletes the tree. Runs on the pool thread.
+static void Summarize(TSTree *tree, double parse_ms, bool table, ParseResult &result) {
+    TSNode root = ts_tree_root_node(tree);
+    result.nodes = ts_node_descendant_count(root);
+    result.has_error = ts_node_has_error(root);
+    result.parse_ms = parse_ms;
+    if (table && !tree_sitter_vjass_node_table_build(tree, &result.table)) result.failed = true;
+    ts_tree_delete(tree);
+}
+
+// Hands `table` over to JS as typed arrays that view its memory in place:
+// one ArrayBuffer over the table's block, freed when the last view is
+// collected. `table` is left empty. Where external buffers are not allowed
+// the block is copied once instead.
+static Napi::Object TableToObject(Napi::Env env, TSVjassNodeTable &table) {
+    uint32_t count = table.count;
+    size_t size = tree_sitter_vjass_node_table_size(count);
+#ifdef NODE_API_NO_EXTERNAL_BUFFERS_ALLOWED
+    auto buffer = Napi::ArrayBuffer::New(env, size);
+    std::memcpy(buffer.Data(), table.start_byte, size);
+    tree_sitter_vjass_node_table_delete(&table);
+#else
+    auto buffer = Napi::ArrayBuffer::New(
+        env, table.start_byte, size,
+        [](Napi::Env finalize_env, void *data, size_t *bytes) {
+            Napi::MemoryManagement::AdjustExternalMemory(finalize_env, -(int64_t)*bytes);
+            free(data);
+            delete bytes;
+        },
+        new size_t(size));
+    Napi::MemoryManagement::AdjustExternalMemory(env, (int64_t)size);
+    table = TSVjassNodeTable();
+#endif
+
+    // Same order as the arrays in the block.
+    size_t u32 = (size_t)count * sizeof(uint32_t), u16 = (size_t)count * sizeof(uint16_t);
+    auto object = Napi::Object::New(env);
+    object["count"] = Napi::Number::New(env, count);
+    object["startByte"] = Napi::Uint32Array::New(env, count, buffer, 0);
+    object["endByte"] = Napi::Uint32Array::New(env, count, buffer, u32);
+    object["parent"] = Napi::Int32Array::New(env, count, buffer, 2 * u32);
+    object["firstChild"] = Napi::Int32Array::New(env, count, buffer, 3 * u32);
+    object["nextSibling"] = Napi::Int32Array::New(env, count, buffer, 4 * u32);
+    object["symbol"] = Napi::Uint16Array::New(env, count, buffer, 5 * u32);
+    object["flags"] = Napi::Uint16Array::New(env, count, buffer, 5 * u32 + u16);
+    return object;
+}
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static Napi::Object ToObject(Napi::Env env, ParseResult &result, bool with_path) {
+    auto object = Napi::Object::New(env);
+    if (with_path) object["path"] = Napi::String::New(env, result.path);
+    if (result.failed) {
+        object["error"] = Napi::String::New(env, result.error ? std::strerror(result.error) : "parse failed");
+        return object;
+    }
+    object["bytes"] = Napi::Number::New(env, result.bytes);
+    object["nodeCount"] = Napi::Number::New(env, result.nodes);
+    object["hasError"] = Napi::Boolean::New(env, result.has_error);
+    object["parseMs"] = Napi::Number::New(env, result.parse_ms);
+    if (result.table.start_byte) object["table"] = TableToObject(env, result.table);
+    return object;
+}
+
+// Reads `table` from the options object of the async functions.
+static bool WantsTable(const Napi::CallbackInfo &info, size_t index) {
+    if (info.Length() <= index || !info[index].IsObject()) return false;
+    Napi::Value value = info[index].As<Napi::Object>().Get("table");
+    return value.IsBoolean() && value.As<Napi::Boolean>().Value();
+}
+
+// parseBuffer(source: string | Buffer, options?: { table?: boolean }):
+// Promise<ParseResult>. A Buffer is parsed in place and kept alive until
+// the parse is done; a string is copied once.
+class ParseBufferWorker : public Napi::AsyncWorker {
+  public:
+    ParseBufferWorker(Napi::Env env, const Napi::Value &source, bool table)
+        : Napi::AsyncWorker(env, "tree-sitter-vjass.parseBuffer"), deferred_(Napi::Promise::Deferred::New(env)),
+          table_(table) {
+        if (source.IsBuffer()) {
+            auto buffer = source.As<Napi::Buffer<char>>();
+            buffer_ = Napi::Persistent(buffer.As<Napi::Object>());
+            data_ = buffer.Data();
+            length_ = buffer.Length();
+        } else {
+            text_ = source.As<Napi::String>().Utf8Value();
+            data_ = text_.data();
+            length_ = text_.size();
+        }
+    }
+
+    ~ParseBufferWorker() override { tree_sitter_vjass_node_table_delete(&result_.table); }
+
+    Napi::Promise Promise() const { return deferred_.Promise(); }
+
+    void Execute() override {
+        TSParser *parser = ThreadParser();
+        if (!parser) {
+            SetError(std::string("parseBuffer: ") + LANGUAGE_VERSION_ERROR);
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, data_, (uint32_t)length_);
+        if (!tree) {
+            SetError("parseBuffer: parse failed");
+            return;
+        }
+        result_.bytes = (uint32_t)length_;
+        Summarize(tree, MillisecondsSince(start), table_, result_);
+        if (result_.failed) SetError("parseBuffer: out of memory");
+    }
+
+    void OnOK() override { deferred_.Resolve(ToObject(Env(), result_, false)); }
+
+    void OnError(const Napi::Error &error) override { deferred_.Reject(error.Value()); }
+
+  private:
+    Napi::Promise::Deferred deferred_;
+    Napi::ObjectReference buffer_;
+    std::string text_;
+    const char *data_ = nullptr;
+    size_t length_ = 0;
+    bool table_;
+    ParseResult result_;
+};
+
+Napi::Value ParseBuffer(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() == 0 || !(info[0].IsBuffer() || info[0].IsString())) {
+        throw Napi::TypeError::New(env, "parseBuffer: expected a string or a Buffer");
+    }
+    if (info[0].IsBuffer() && info[0].As<Napi::Buffer<char>>().Length() > UINT32_MAX) {
+        throw Napi::RangeError::New(env, "parseBuffer: source is larger than 4 GiB");
+    }
+    auto *worker = new ParseBufferWorker(env, info[0], WantsTable(info, 1));
+    worker->Queue();
+    return worker->Promise();
+}
+
+// One parseFiles() call. Its workers take files off `next` until none are
+// left, so a few large files do not hold up the rest; the last worker to
+// finish resolves the promise.
+struct ParseFilesBatch {
+    ParseFilesBatch(Napi::Env env, bool table) : deferred(Napi::Promise::Deferred::New(env)), table(table) {}
+
+    ~ParseFilesBatch() {
+        for (ParseResult &result : results) tree_sitter_vjass_node_table_delete(&result.table);
+    }
+
+    Napi::Promise::Deferred deferred;
+    std::vector<ParseResult> results;
+    std::atomic<size_t> next{0};
+    size_t pending = 0;
+    bool rejected = false;
+    bool table;
+};
+
+class ParseFilesWorker : public Napi::AsyncWorker {
+  public:
+    ParseFilesWorker(Napi::Env env, std::shared_ptr<ParseFilesBatch> batch)
+        : Napi::AsyncWorker(env, "tree-sitter-vjass.parseFiles"), batch_(std::move(batch)) {}
+
+    void Execute() override {
+        TSParser *parser = ThreadParser();
+        if (!parser) {
+            SetError(std::string("parseFiles: ") + LANGUAGE_VERSION_ERROR);
+            return;
+        }
+        for (size_t i; (i = batch_->next.fetch_add(1)) < batch_->results.size();) {
+            ParseResult &result = batch_->results[i];
+            auto start = std::chrono::steady_clock::now();
+            TSVjassMappedFile file;
+            errno = 0;
+            if (!tree_sitter_vjass_map_file(&file, result.path.c_str())) {
+                result.failed = true;
+                result.error = errno ? errno : EIO;
+                continue;
+            }
+            TSTree *tree = ts_parser_parse(parser, NULL, tree_sitter_vjass_mapped_input(&file));
+            result.bytes = (uint32_t)file.length;
+            tree_sitter_vjass_unmap_file(&file);
+            if (!tree) {
+                result.failed = true;
+                continue;
+            }
+            Summarize(tree, MillisecondsSince(start), batch_->table, result);
+        }
+    }
+
+    void OnOK() override {
+        if (--batch_->pending > 0 || batch_->rejected) return;
+        Napi::Env env = Env();
+        auto results = Napi::Array::New(env, batch_->results.size());
+        for (size_t i = 0; i < batch_->results.size(); i++) {
+            results[(uint32_t)i] = ToObject(env, batch_->results[i], true);
+        }
+        batch_->deferred.Resolve(results);
+    }
+
+    // The first worker to fail rejects the promise; the others only count
+    // themselves out.
+    void OnError(const Napi::Error &error) override {
+        --batch_->pending;
+        if (batch_->rejected) return;
+        batch_->rejected = true;
+        batch_->deferred.Reject(error.Value());
+    }
+
+  private:
+    std::shared_ptr<ParseFilesBatch> batch_;
+};
+
+// The libuv pool size, which bounds how many parses run at once.
+static uint32_t ThreadPoolSize() {
+    const char *value = std::getenv("UV_THREADPOOL_SIZE");
+    long size = value ? std::strtol(value, nullptr, 10) : 0;
+    return size > 0 ? (uint32_t)size : 4;
+}
+
+// parseFiles(paths: string[], options?: { concurrency?: number, table?: boolean }):
+// Promise<ParseResult[]>. Files are memory-mapped and parsed on up to
+// `concurrency` pool threads (default: the pool size); results come back in
+// the order of `paths`, with `error` set for files that could not be read.
+Napi::Value ParseFiles(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    if (info.Length() == 0 || !info[0].IsArray()) {
+        throw Napi::TypeError::New(env, "parseFiles: expected an array of paths");
+    }
+    auto paths = info[0].As<Napi::Array>();
+    uint32_t concurrency = ThreadPoolSize();
+    if (info.Length() > 1 && info[1].IsObject()) {
+        Napi::Value value = info[1].As<Napi::Object>().Get("concurrency");
+        if (!value.IsUndefined()) {
+            if (!value.IsNumber() || value.As<Napi::Number>().Int64Value() < 1) {
+                throw Napi::RangeError::New(env, "parseFiles: concurrency must be a positive number");
+            }
+            concurrency = (uint32_t)value.As<Napi::Number>().Int64Value();
+        }
+    }
+
+    auto batch = std::make_shared<ParseFilesBatch>(env, WantsTable(info, 1));
+    batch->results.resize(paths.Length());
+    for (uint32_t i = 0; i < paths.Length(); i++) {
+        Napi::Value path = paths[i];
+        if (!path.IsString()) throw Napi::TypeError::New(env, "parseFiles: every path must be a string");
+        batch->results[i].path = path.As<Napi::String>().Utf8Value();
+    }
+    if (batch->results.empty()) {
+        batch->deferred.Resolve(Napi::Array::New(env));
+        return batch->deferred.Promise();
+    }
+
+    batch->pending = std::min<size_t>(concurrency, batch->results.size());
+    for (size_t i = 0, workers = batch->pending; i < workers; i++) {
+        (new ParseFilesWorker(env, batch))->Queue();
+    }
+    return batch->deferred.Promise();
+}
+
+// exportTree(source: string | Buffer): NodeTable. Parses on the calling
+// thread and returns the whole tree as typed arrays over one native block,
+// without creating an object per node.
+Napi::Value ExportTree(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+    SourceArgument source(info, "exportTree");
+    TSParser *parser = ThreadParser();
+    if (!parser) throw Napi::Error::New(env, std::string("exportTree: ") + LANGUAGE_VERSION_ERROR);
+    TSTree *tree = ts_parser_parse_string(parser, NULL, source.data, (uint32_t)source.length);
+    TSVjassNodeTable table;
+    bool ok = tree && tree_sitter_vjass_node_table_build(tree, &table);
+    ts_tree_delete(tree);
+    if (!ok) throw Napi::Error::New(env, "exportTree: parse failed");
+    return TableToObject(env, table);
+}
+
+// Node type names indexed by NodeTable.symbol.
+static Napi::Array SymbolNames(Napi::Env env) {
+    const TSLanguage *language = tree_sitter_vjass();
+    uint32_t count = ts_language_symbol_count(language);
+    auto names = Napi::Array::New(env, count);
+    for (uint32_t i = 0; i < count; i++) {
+        names[i] = Napi::String::New(env, ts_language_symbol_name(language, (TSSymbol)i));
+    }
+    return names;
+}
+#endif
+
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     auto language = Napi::External<TSLanguage>::New(env, tree_sitter_vjass());
     language.TypeTag(&LANGUAGE_TYPE_TAG);
     exports["language"] = language;
+#ifdef TREE_SITTER_VJASS_RUNTIME
+    // The accounting hooks slow every allocation down, so they are opt-in.
+    // Only this addon's copy of the runtime is affected, and they can only
+    // go in before it has allocated anything: the first Init decides, later
+    // ones (worker threads) keep what it chose.
+    static std::atomic<bool> initialized{false};
+    if (!initialized.exchange(true) && AllocStatsRequested()) {
+        tree_sitter_vjass_stats_install();
+    }
+    exports["allocStats"] = Napi::Function::New(env, AllocStats, "allocStats");
+    exports["parseBuffer"] = Napi::Function::New(env, ParseBuffer, "parseBuffer");
+    exports["parseFiles"] = Napi::Function::New(env, ParseFiles, "parseFiles");
+    exports["exportTree"] = Napi::Function::New(env, ExportTree, "exportTree");
+    exports["symbolNames"] = SymbolNames(env);
+#endif
     return exports;
 }
 
@@ -1,9 +1,86 @@
 const assert = require("node:assert");
 const { test } = require("node:test");
 
+// Allocation accounting is decided when the addon loads.
+process.env.TREE_SITTER_VJASS_ALLOC_STATS = "1";
+
 const Parser = require("tree-sitter");
 
 test("can load grammar", () => {
   const parser = new Parser();
   assert.doesNotThrow(() => parser.setLanguage(require(".")));
 });
+
+test("reports allocation stats", { skip: !require(".").allocStats && "built without the runtime" }, () => {
+  const stats = require(".").allocStats("globals\nendglobals\n");
+  assert.ok(stats.allocations > 0);
+  assert.ok(stats.peakLiveBytes >= stats.liveBytes);
+  assert.strictEqual(stats.histogram.reduce((a, b) => a + b, 0), stats.allocations);
+});
+
+test("parses off the main thread", { skip: !require(".").parseFiles && "built without the runtime" }, async () => {
+  const { parseBuffer, parseFiles } = require(".");
+  const source = "globals\n    integer a = 1\nendglobals\n";
+  const fromString = await parseBuffer(source);
+  const fromBuffer = await parseBuffer(Buffer.from(source));
+  assert.deepStrictEqual({ ...fromString, parseMs: 0 }, { ...fromBuffer, parseMs: 0 });
+  assert.strictEqual(fromString.bytes, source.length);
+  assert.ok(fromString.nodeCount > 1);
+  assert.strictEqual(fromString.hasError, false);
+
+  const results = await parseFiles([__filename, "does-not-exist.j"], { concurrency: 2 });
+  assert.strictEqual(results[0].path, __filename);
+  assert.ok(results[0].nodeCount > 1);
+  assert.strictEqual(typeof results[1].error, "string");
+});
+
+test("exports the tree as typed arrays", { skip: !require(".").exportTree && "built without the runtime" }, () => {
+  const { exportTree, symbolNames, walkTable } = require(".");
+  const source = "globals\n    integer a = 1\nendglobals\nfunction f takes nothing returns nothing\n    call g(a)\nendfunction\n";
+  const table = exportTree(source);
+  assert.ok(table.startByte instanceof Uint32Array);
+  assert.strictEqual(table.startByte.buffer, table.symbol.buffer);
+  assert.strictEqual(table.parent[0], -1);
+
+  const parser = new Parser();
+  parser.setLanguage(require("."));
+  const expected = [];
+  const visit = (node, depth) => {
+    expected.push([node.type, node.startIndex, node.endIndex, depth]);
+    for (const child of node.children) visit(child, depth + 1);
+  };
+  visit(parser.parse(source).rootNode, 0);
+
+  const actual = [];
+  walkTable(table, (i, depth) => {
+    actual.push([symbolNames[table.symbol[i]], table.startByte[i], table.endByte[i], depth]);
+  });
+  assert.strictEqual(table.count, expected.length);
+  assert.deepStrictEqual(actual, expected);
+});
+
+test("symbol and field ids match the parser", () => {
+  const { symbols, fields, symbolNames } = require(".");
+  assert.ok(Object.isFrozen(symbols) && Object.isFrozen(fields));
+  if (symbolNames) {
+    for (const [name, id] of Object.entries(symbols)) assert.strictEqual(symbolNames[id], name);
+  }
+
+  const parser = new Parser();
+  parser.setLanguage(require("."));
+  const tree = parser.parse('globals\n    string s = "a"\nendglobals\nloop\n    set x = y + 1\nendloop\n');
+  assert.ok(!tree.rootNode.hasError);
+  const cursor = tree.walk();
+  let named = 0;
+  for (let more = true; more; ) {
+    const node = cursor.currentNode;
+    if (node.isNamed && !node.isError && !node.isMissing) {
+      assert.strictEqual(symbols[node.type], node.typeId, node.type);
+      named++;
+    }
+    if (cursor.currentFieldName) assert.strictEqual(fields[cursor.currentFieldName], cursor.currentFieldId);
+    if (cursor.gotoFirstChild()) continue;
+    while (!(more = cursor.gotoNextSibling()) && cursor.gotoParent());
+  }
+  assert.ok(named > 1);
+});
@@ -18,9 +18,177 @@ type NodeInfo =
       children: ChildNode[];
     });
 
+type AllocStats = {
+  /** malloc, calloc and realloc calls. */
+  allocations: number;
+  frees: number;
+  /** Bytes requested, summed over all allocations. */
+  bytes: number;
+  /** Bytes still allocated once the parse returned (the tree included). */
+  liveBytes: number;
+  peakLiveBytes: number;
+  /** Request sizes; entry `i` counts requests of at most `16 << i` bytes, the last one everything larger. */
+  histogram: number[];
+};
+
+/**
+ * A whole tree as a structure of arrays, from `exportTree()` or the `table`
+ * option of the async functions. Nodes are in preorder and refer to each
+ * other by index; -1 means none. All arrays view one block of native memory.
+ */
+type NodeTable = {
+  count: number;
+  startByte: Uint32Array;
+  endByte: Uint32Array;
+  /** -1 for the root, node 0. */
+  parent: Int32Array;
+  /** -1 for leaves. */
+  firstChild: Int32Array;
+  /** -1 for last children. */
+  nextSibling: Int32Array;
+  /** Node type id; `symbolNames[symbol]` is its name. */
+  symbol: Uint16Array;
+  /** `nodeFlags` bits. */
+  flags: Uint16Array;
+};
+
+type ParseResult = {
+  /** Source length in bytes. */
+  bytes: number;
+  /** Nodes in the tree, the root included. */
+  nodeCount: number;
+  hasError: boolean;
+  /** Time spent on the pool thread, mapping the file included. */
+  parseMs: number;
+  /** Only with the `table` option. */
+  table?: NodeTable;
+};
+
+type FileParseResult =
+  | (ParseResult & { path: string; error?: undefined })
+  /** The file could not be read or parsed. */
+  | { path: string; error: string };
+
+type ParseFilesOptions = {
+  /**
+   * How many files are parsed at once. Defaults to the libuv thread pool
+   * size (`UV_THREADPOOL_SIZE`, 4 unless set), which also bounds it.
+   */
+  concurrency?: number;
+  /** Also return the node table of every tree. */
+  table?: boolean;
+};
+
+// BEGIN generate-symbols.js
+// Generated by generate-symbols.js from src/parser.c; do not edit.
+type Symbols = {
+  readonly id: 1;
+  readonly struct_: 2;
+  readonly endstruct_: 3;
+  readonly globals_: 4;
+  readonly endglobals_: 5;
+  readonly loop_: 6;
+  readonly endloop_: 7;
+  readonly rawcode: 26;
+  readonly number: 27;
+  readonly float: 28;
+  readonly local: 29;
+  readonly constant: 30;
+  readonly array: 31;
+  readonly set_: 34;
+  readonly call_: 35;
+  readonly return_: 36;
+  readonly exitwhen_: 37;
+  readonly if_: 38;
+  readonly then_: 39;
+  readonly elseif_: 40;
+  readonly else_: 41;
+  readonly endif_: 42;
+  readonly function_: 43;
+  readonly takes_: 44;
+  readonly nothing: 45;
+  readonly returns_: 46;
+  readonly endfunction_: 47;
+  readonly program: 56;
+  readonly struct: 59;
+  readonly globals: 60;
+  readonly loop: 61;
+  readonly expr: 62;
+  readonly var_stmt: 63;
+  readonly var_decl: 64;
+  readonly string: 65;
+  readonly set_statement: 66;
+  readonly call_statement: 67;
+  readonly return_statement: 68;
+  readonly exitwhen_statement: 69;
+  readonly if_statement: 70;
+  readonly function: 71;
+  readonly parameter_list: 72;
+  readonly parameter: 73;
+  readonly function_call: 74;
+  readonly function_arguments: 75;
+  readonly comment: 76;
+  readonly function_call_paren: 84;
+};
+type Fields = {
+  readonly args: 1;
+  readonly condition: 2;
+  readonly content: 3;
+  readonly end: 4;
+  readonly name: 5;
+  readonly prefix: 6;
+  readonly returns: 7;
+  readonly start: 8;
+  readonly type: 9;
+  readonly value: 10;
+};
+// END generate-symbols.js
+
 type Language = {
   language: unknown;
   nodeTypeInfo: NodeInfo[];
+  /** Kind ids of the named node types; they change when the parser is regenerated. */
+  symbols: Symbols;
+  fields: Fields;
+  /**
+   * Parses `source` and reports what the parse allocated. Only present when
+   * the addon was built with the `tree-sitter` runtime sources available, and
+   * throws unless TREE_SITTER_VJASS_ALLOC_STATS=1 was set when it loaded.
+   */
+  allocStats?: (source: string | Buffer) => AllocStats;
+  /**
+   * Parses `source` on the libuv thread pool. A Buffer is parsed in place
+   * and must not be modified until the promise settles. Only present when
+   * the addon was built with the runtime sources; rejects if they come from
+   * a `tree-sitter` older than 0.25, which cannot load this grammar.
+   */
+  parseBuffer?: (source: string | Buffer, options?: { table?: boolean }) => Promise<ParseResult>;
+  /**
+   * Memory-maps and parses every file on the libuv thread pool. Results are
+   * in the order of `paths`; unreadable files have `error` set instead of
+   * rejecting the promise. Only present when the addon was built with the
+   * runtime sources. Like `parseBuffer`, rejects if that runtime is too old
+   * to load this grammar.
+   */
+  parseFiles?: (paths: string[], options?: ParseFilesOptions) => Promise<FileParseResult[]>;
+  /**
+   * Parses `source` on the calling thread and returns the whole tree as a
+   * node table. Only present when the addon was built with the runtime
+   * sources.
+   */
+  exportTree?: (source: string | Buffer) => NodeTable;
+  /** Node type names indexed by `NodeTable.symbol`; present with `exportTree`. */
+  symbolNames?: string[];
+  nodeFlags: Readonly<{ named: 1; extra: 2; error: 4; missing: 8 }>;
+  /**
+   * Visits every node of `table` in preorder. Returning `false` from
+   * `enter` skips the node's children.
+   */
+  walkTable: (
+    table: NodeTable,
+    enter: (index: number, depth: number) => boolean | void,
+    leave?: (index: number, depth: number) => void,
+  ) => void;
 };
 
 declare const language: Language;
@@ -9,3 +9,105 @@ module.exports =
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
 } catch (_) {}
+
+/** Bits of `NodeTable.flags`. */
+module.exports.nodeFlags = Object.freeze({ named: 0x1, extra: 0x2, error: 0x4, missing: 0x8 });
+
+/**
+ * Visits every node of a table from `exportTree()` in preorder, calling
+ * `enter(index, depth)` on the way down and `leave(index, depth)`, if given,
+ * on the way up. Returning `false` from `enter` skips the node's children.
+ * Nodes are plain indices into the table's arrays, so the walk allocates
+ * nothing per node.
+ */
+module.exports.walkTable = function walkTable(table, enter, leave) {
+  const { parent, firstChild, nextSibling } = table;
+  let node = 0;
+  let depth = 0;
+  for (;;) {
+    if (enter(node, depth) !== false && firstChild[node] !== -1) {
+      node = firstChild[node];
+      depth++;
+      continue;
+    }
+    for (;;) {
+      if (leave) leave(node, depth);
+      if (nextSibling[node] !== -1) {
+        node = nextSibling[node];
+        break;
+      }
+      node = parent[node];
+      depth--;
+      if (node === -1) return;
+    }
+  }
+};
+
+// BEGIN generate-symbols.js
+// Generated by generate-symbols.js from src/parser.c; do not edit.
+
+/** Kind ids of the named node types, as in `Node.typeId` and `NodeTable.symbol`. */
+module.exports.symbols = Object.freeze({
+  id: 1,
+  struct_: 2,
+  endstruct_: 3,
+  globals_: 4,
+  endglobals_: 5,
+  loop_: 6,
+  endloop_: 7,
+  rawcode: 26,
+  number: 27,
+  float: 28,
+  local: 29,
+  constant: 30,
+  array: 31,
+  set_: 34,
+  call_: 35,
+  return_: 36,
+  exitwhen_: 37,
+  if_: 38,
+  then_: 39,
+  elseif_: 40,
+  else_: 41,
+  endif_: 42,
+  function_: 43,
+  takes_: 44,
+  nothing: 45,
+  returns_: 46,
+  endfunction_: 47,
+  program: 56,
+  struct: 59,
+  globals: 60,
+  loop: 61,
+  expr: 62,
+  var_stmt: 63,
+  var_decl: 64,
+  string: 65,
+  set_statement: 66,
+  call_statement: 67,
+  return_statement: 68,
+  exitwhen_statement: 69,
+  if_statement: 70,
+  function: 71,
+  parameter_list: 72,
+  parameter: 73,
+  function_call: 74,
+  function_arguments: 75,
+  comment: 76,
+  function_call_paren: 84,
+});
+
+/** Field ids, as in `TreeCursor.currentFieldId`. */
+module.exports.fields = Object.freeze({
+  args: 1,
+  condition: 2,
+  content: 3,
+  end: 4,
+  name: 5,
+  prefix: 6,
+  returns: 7,
+  start: 8,
+  type: 9,
+  value: 10,
+});
+// END generate-symbols.js
@@ -1,3 +1,7 @@
+import os
+import subprocess
+import sys
+import tempfile
 from unittest import TestCase
 
 import tree_sitter
@@ -10,3 +14,62 @@ class TestLanguage(TestCase):
             tree_sitter.Language(tree_sitter_vjass.language())
         except Exception:
             self.fail("Error loading VJASS grammar")
+
+    def test_symbols_match_language(self):
+        language = tree_sitter.Language(tree_sitter_vjass.language())
+        for symbol in tree_sitter_vjass.Symbol:
+            name = language.node_kind_for_id(symbol)
+            self.assertEqual(symbol.name, name.upper())
+            self.assertEqual(language.id_for_node_kind(name, True), symbol)
+        # Every named kind the parser can report has a constant.
+        ids = set(tree_sitter_vjass.Symbol)
+        for id in range(language.node_kind_count):
+            name = language.node_kind_for_id(id)
+            if (language.node_kind_is_named(id) and language.node_kind_is_visible(id)
+                    and language.id_for_node_kind(name, True) == id):
+                self.assertIn(id, ids, name)
+        for field in tree_sitter_vjass.Field:
+            name = language.field_name_for_id(field)
+            self.assertEqual(field.name, name.upper())
+            self.assertEqual(language.field_id_for_name(name), field)
+        self.assertEqual(len(tree_sitter_vjass.Field), language.field_count)
+
+    def test_alloc_stats(self):
+        # Accounting is off unless asked for at import.
+        if not os.environ.get("TREE_SITTER_VJASS_ALLOC_STATS"):
+            with self.assertRaises(RuntimeError):
+                tree_sitter_vjass.alloc_stats(b"")
+        script = (
+            "import tree_sitter_vjass\n"
+            "stats = tree_sitter_vjass.alloc_stats(b'globals\\nendglobals\\n')\n"
+            "assert stats['allocations'] > 0, stats\n"
+            "assert stats['peak_live_bytes'] >= stats['live_bytes'], stats\n"
+            "assert sum(stats['histogram']) == stats['allocations'], stats\n"
+        )
+        env = dict(os.environ, TREE_SITTER_VJASS_ALLOC_STATS="1")
+        subprocess.run([sys.executable, "-c", script], env=env, check=True)
+
+    def test_parse_many(self):
+        parser = tree_sitter.Parser(tree_sitter.Language(tree_sitter_vjass.language()))
+        sources = [b"globals\nendglobals\n", b"function f takes nothing returns nothing\nendfunction\n", b"x"]
+        with tempfile.TemporaryDirectory() as root:
+            paths = []
+            for i, source in enumerate(sources):
+                paths.append(os.path.join(root, f"{i}.j"))
+                with open(paths[-1], "wb") as file:
+                    file.write(source)
+            paths.append(os.path.join(root, "missing.j"))
+            tables = tree_sitter_vjass.parse_many(paths, threads=2)
+
+        self.assertEqual(len(tables), len(paths))
+        self.assertIsInstance(tables[-1], FileNotFoundError)
+        self.assertEqual(tables[-1].filename, paths[-1])
+        for source, table in zip(sources, tables):
+            tree = parser.parse(source)
+            self.assertEqual(len(table), tree.root_node.descendant_count)
+            self.assertEqual(table.symbol[0], tree.root_node.kind_id)
+            self.assertEqual(table.end_byte[0], tree.root_node.end_byte)
+            self.assertEqual(table.parent[0], 0xFFFFFFFF)
+            self.assertEqual(table.has_error, tree.root_node.has_error)
+            self.assertEqual(table.source_length, len(source))
+            self.assertEqual(memoryview(table).nbytes, len(table) * 24)
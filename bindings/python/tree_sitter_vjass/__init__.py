@@ -1,8 +1,80 @@
 """Vjass grammar for tree-sitter"""
 
+from enum import IntEnum
 from importlib.resources import files as _files
 
-from ._binding import language
+from ._binding import NodeTable, alloc_stats, language, parse_many
+
+# BEGIN generate-symbols.js
+# Generated by generate-symbols.js from src/parser.c; do not edit.
+
+
+class Symbol(IntEnum):
+    """Kind ids of the named node types, as in ``Node.kind_id``."""
+
+    ID = 1
+    STRUCT_ = 2
+    ENDSTRUCT_ = 3
+    GLOBALS_ = 4
+    ENDGLOBALS_ = 5
+    LOOP_ = 6
+    ENDLOOP_ = 7
+    RAWCODE = 26
+    NUMBER = 27
+    FLOAT = 28
+    LOCAL = 29
+    CONSTANT = 30
+    ARRAY = 31
+    SET_ = 34
+    CALL_ = 35
+    RETURN_ = 36
+    EXITWHEN_ = 37
+    IF_ = 38
+    THEN_ = 39
+    ELSEIF_ = 40
+    ELSE_ = 41
+    ENDIF_ = 42
+    FUNCTION_ = 43
+    TAKES_ = 44
+    NOTHING = 45
+    RETURNS_ = 46
+    ENDFUNCTION_ = 47
+    PROGRAM = 56
+    STRUCT = 59
+    GLOBALS = 60
+    LOOP = 61
+    EXPR = 62
+    VAR_STMT = 63
+    VAR_DECL = 64
+    STRING = 65
+    SET_STATEMENT = 66
+    CALL_STATEMENT = 67
+    RETURN_STATEMENT = 68
+    EXITWHEN_STATEMENT = 69
+    IF_STATEMENT = 70
+    FUNCTION = 71
+    PARAMETER_LIST = 72
+    PARAMETER = 73
+    FUNCTION_CALL = 74
+    FUNCTION_ARGUMENTS = 75
+    COMMENT = 76
+    FUNCTION_CALL_PAREN = 84
+
+
+class Field(IntEnum):
+    """Field ids, as in ``TreeCursor.field_id``."""
+
+    ARGS = 1
+    CONDITION = 2
+    CONTENT = 3
+    END = 4
+    NAME = 5
+    PREFIX = 6
+    RETURNS = 7
+    START = 8
+    TYPE = 9
+    VALUE = 10
+# END generate-symbols.js
 
 
 def _get_query(name, file):
@@ -28,6 +100,11 @@ def __getattr__(name):
 
 __all__ = [
     "language",
+    "Symbol",
+    "Field",
+    "NodeTable",
+    "alloc_stats",
+    "parse_many",
     # "HIGHLIGHTS_QUERY",
     # "INJECTIONS_QUERY",
     # "LOCALS_QUERY",
@@ -1,4 +1,7 @@
-from typing import Final
+from collections.abc import Sequence
+from enum import IntEnum
+from os import PathLike
+from typing import Final, TypedDict, final
 
 # NOTE: uncomment these to include any queries that this grammar contains:
 
@@ -8,3 +11,113 @@ from typing import Final
 # TAGS_QUERY: Final[str]
 
 def language() -> object: ...
+
+# BEGIN generate-symbols.js
+# Generated by generate-symbols.js from src/parser.c; do not edit.
+
+class Symbol(IntEnum):
+    ID = ...
+    STRUCT_ = ...
+    ENDSTRUCT_ = ...
+    GLOBALS_ = ...
+    ENDGLOBALS_ = ...
+    LOOP_ = ...
+    ENDLOOP_ = ...
+    RAWCODE = ...
+    NUMBER = ...
+    FLOAT = ...
+    LOCAL = ...
+    CONSTANT = ...
+    ARRAY = ...
+    SET_ = ...
+    CALL_ = ...
+    RETURN_ = ...
+    EXITWHEN_ = ...
+    IF_ = ...
+    THEN_ = ...
+    ELSEIF_ = ...
+    ELSE_ = ...
+    ENDIF_ = ...
+    FUNCTION_ = ...
+    TAKES_ = ...
+    NOTHING = ...
+    RETURNS_ = ...
+    ENDFUNCTION_ = ...
+    PROGRAM = ...
+    STRUCT = ...
+    GLOBALS = ...
+    LOOP = ...
+    EXPR = ...
+    VAR_STMT = ...
+    VAR_DECL = ...
+    STRING = ...
+    SET_STATEMENT = ...
+    CALL_STATEMENT = ...
+    RETURN_STATEMENT = ...
+    EXITWHEN_STATEMENT = ...
+    IF_STATEMENT = ...
+    FUNCTION = ...
+    PARAMETER_LIST = ...
+    PARAMETER = ...
+    FUNCTION_CALL = ...
+    FUNCTION_ARGUMENTS = ...
+    COMMENT = ...
+    FUNCTION_CALL_PAREN = ...
+
+class Field(IntEnum):
+    ARGS = ...
+    CONDITION = ...
+    CONTENT = ...
+    END = ...
+    NAME = ...
+    PREFIX = ...
+    RETURNS = ...
+    START = ...
+    TYPE = ...
+    VALUE = ...
+# END generate-symbols.js
+
+class AllocStats(TypedDict):
+    allocations: int
+    frees: int
+    bytes: int
+    live_bytes: int
+    peak_live_bytes: int
+    # entry i counts requests of at most 16 << i bytes, the last one everything larger
+    histogram: list[int]
+
+# Raises RuntimeError unless TREE_SITTER_VJASS_ALLOC_STATS=1 was set at import.
+def alloc_stats(source: bytes, /) -> AllocStats: ...
+
+# Flat node table of one tree, in preorder: node 0 is the root and the
+# children of a node follow it. Columns index by node; 0xFFFFFFFF marks no
+# parent, child or sibling. The object also exports the whole table block
+# through the buffer protocol.
+@final
+class NodeTable:
+    @property
+    def start_byte(self) -> memoryview: ...
+    @property
+    def end_byte(self) -> memoryview: ...
+    @property
+    def parent(self) -> memoryview: ...
+    @property
+    def first_child(self) -> memoryview: ...
+    @property
+    def next_sibling(self) -> memoryview: ...
+    @property
+    def symbol(self) -> memoryview: ...
+    @property
+    def flags(self) -> memoryview: ...
+    @property
+    def has_error(self) -> bool: ...
+    @property
+    def source_length(self) -> int: ...
+    def __len__(self) -> int: ...
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+# Parses the files on `threads` native threads (0: one per CPU) without
+# holding the GIL; a file that cannot be read gives an OSError in its place.
+def parse_many(
+    paths: Sequence[str | bytes | PathLike[str] | PathLike[bytes]], threads: int = 0
+) -> list[NodeTable | OSError]: ...
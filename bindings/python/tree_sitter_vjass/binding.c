@@ -1,5 +1,22 @@
 #include <Python.h>
 
+#ifdef TREE_SITTER_VJASS_RUNTIME
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/tree-sitter-vjass-file.h>
+#define TREE_SITTER_VJASS_STATS_IMPLEMENTATION
+#include <tree_sitter/tree-sitter-vjass-stats.h>
+#include <tree_sitter/tree-sitter-vjass-table.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
 typedef struct TSLanguage TSLanguage;
 
 TSLanguage *tree_sitter_vjass(void);
@@ -8,7 +25,362 @@ static PyObject* _binding_language(PyObject *Py_UNUSED(self), PyObject *Py_UNUSE
     return PyCapsule_New(tree_sitter_vjass(), "tree_sitter.Language", NULL);
 }
 
+#ifdef TREE_SITTER_VJASS_RUNTIME
+// Built when the extension links its own copy of the tree-sitter runtime,
+// as setup.py does (TREE_SITTER_VJASS_RUNTIME and the runtime sources).
+
+// Whether TREE_SITTER_VJASS_ALLOC_STATS asks for allocation accounting.
+static int alloc_stats_requested(void) {
+    const char *value = getenv("TREE_SITTER_VJASS_ALLOC_STATS");
+    return value && *value && strcmp(value, "0") != 0;
+}
+
+static PyObject* _binding_alloc_stats(PyObject *Py_UNUSED(self), PyObject *arg) {
+    if (!tree_sitter_vjass_stats_installed()) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "allocation accounting is off; set TREE_SITTER_VJASS_ALLOC_STATS=1 "
+                        "before importing tree_sitter_vjass");
+        return NULL;
+    }
+    Py_buffer source;
+    if (PyObject_GetBuffer(arg, &source, PyBUF_SIMPLE) < 0) return NULL;
+    if ((size_t)source.len > UINT32_MAX) {
+        PyBuffer_Release(&source);
+        PyErr_SetString(PyExc_ValueError, "source is larger than 4 GiB");
+        return NULL;
+    }
+
+    TSVjassAllocStats stats;
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_vjass());
+    TSTree *tree = tree_sitter_vjass_parse_string_with_stats(parser, NULL, source.buf, (uint32_t)source.len, &stats);
+    ts_tree_delete(tree);
+    ts_parser_delete(parser);
+    PyBuffer_Release(&source);
+
+    PyObject *histogram = PyList_New(TREE_SITTER_VJASS_STATS_BUCKETS);
+    if (!histogram) return NULL;
+    for (Py_ssize_t i = 0; i < TREE_SITTER_VJASS_STATS_BUCKETS; i++) {
+        PyObject *count = PyLong_FromUnsignedLongLong(stats.histogram[i]);
+        if (!count || PyList_SetItem(histogram, i, count) < 0) {
+            Py_DECREF(histogram);
+            return NULL;
+        }
+    }
+    return Py_BuildValue("{s:K,s:K,s:K,s:L,s:L,s:N}",
+                         "allocations", (unsigned long long)stats.allocations,
+                         "frees", (unsigned long long)stats.frees,
+                         "bytes", (unsigned long long)stats.bytes,
+                         "live_bytes", (long long)stats.live_bytes,
+                         "peak_live_bytes", (long long)stats.peak_live_bytes,
+                         "histogram", histogram);
+}
+
+typedef struct {
+    PyObject *node_table_type;
+} ModuleState;
+
+// NodeTable: the flat node table of one tree. The object exports the whole
+// table block through the buffer protocol; each column is a memoryview of
+// one slice of it, cast to its element type. Tables are immutable.
+typedef struct {
+    PyObject_HEAD
+    TSVjassNodeTable table;
+    uint32_t source_length;
+    int has_error;
+} NodeTableObject;
+
+static void node_table_dealloc(PyObject *self) {
+    PyTypeObject *type = Py_TYPE(self);
+    tree_sitter_vjass_node_table_delete(&((NodeTableObject *)self)->table);
+    PyObject_Free(self);
+    Py_DECREF(type);
+}
+
+static int node_table_getbuffer(PyObject *self, Py_buffer *view, int flags) {
+    const TSVjassNodeTable *table = &((NodeTableObject *)self)->table;
+    return PyBuffer_FillInfo(view, self, table->start_byte, (Py_ssize_t)tree_sitter_vjass_node_table_size(table->count),
+                             1, flags);
+}
+
+static Py_ssize_t node_table_length(PyObject *self) { return (Py_ssize_t)((NodeTableObject *)self)->table.count; }
+
+// Column `closure`, in block order: five uint32 columns, then two uint16.
+static PyObject *node_table_column(PyObject *self, void *closure) {
+    uint32_t count = ((NodeTableObject *)self)->table.count;
+    Py_ssize_t column = (Py_ssize_t)(intptr_t)closure;
+    Py_ssize_t u32 = (Py_ssize_t)count * 4, u16 = (Py_ssize_t)count * 2;
+    Py_ssize_t start = column < 5 ? column * u32 : 5 * u32 + (column - 5) * u16;
+    Py_ssize_t stop = start + (column < 5 ? u32 : u16);
+
+    PyObject *view = PyMemoryView_FromObject(self);
+    PyObject *start_index = PyLong_FromSsize_t(start), *stop_index = PyLong_FromSsize_t(stop);
+    PyObject *slice = start_index && stop_index ? PySlice_New(start_index, stop_index, NULL) : NULL;
+    PyObject *part = view && slice ? PyObject_GetItem(view, slice) : NULL;
+    Py_XDECREF(slice);
+    Py_XDECREF(stop_index);
+    Py_XDECREF(start_index);
+    Py_XDECREF(view);
+    if (!part) return NULL;
+    PyObject *result = PyObject_CallMethod(part, "cast", "s", column < 5 ? "I" : "H");
+    Py_DECREF(part);
+    return result;
+}
+
+static PyObject *node_table_has_error(PyObject *self, void *Py_UNUSED(closure)) {
+    return PyBool_FromLong(((NodeTableObject *)self)->has_error);
+}
+
+static PyObject *node_table_source_length(PyObject *self, void *Py_UNUSED(closure)) {
+    return PyLong_FromUnsignedLong(((NodeTableObject *)self)->source_length);
+}
+
+static PyGetSetDef node_table_getset[] = {
+    {"start_byte", node_table_column, NULL, "Start byte of every node (memoryview of uint32).", (void *)0},
+    {"end_byte", node_table_column, NULL, "End byte of every node (memoryview of uint32).", (void *)1},
+    {"parent", node_table_column, NULL, "Parent index, 0xFFFFFFFF for the root (memoryview of uint32).", (void *)2},
+    {"first_child", node_table_column, NULL, "First child index, 0xFFFFFFFF for leaves (memoryview of uint32).",
+     (void *)3},
+    {"next_sibling", node_table_column, NULL,
+     "Next sibling index, 0xFFFFFFFF for last children (memoryview of uint32).", (void *)4},
+    {"symbol", node_table_column, NULL, "Node kind id (memoryview of uint16).", (void *)5},
+    {"flags", node_table_column, NULL, "NODE_* bits (memoryview of uint16).", (void *)6},
+    {"has_error", node_table_has_error, NULL, "Whether the tree has syntax errors.", NULL},
+    {"source_length", node_table_source_length, NULL, "Length of the parsed source in bytes.", NULL},
+    {NULL, NULL, NULL, NULL, NULL}
+};
+
+static PyType_Slot node_table_slots[] = {
+    {Py_tp_doc, "Flat node table of one tree, in preorder. See parse_many()."},
+    {Py_tp_dealloc, node_table_dealloc},
+    {Py_tp_getset, node_table_getset},
+    {Py_sq_length, node_table_length},
+    {Py_bf_getbuffer, node_table_getbuffer},
+    {0, NULL}
+};
+
+static PyType_Spec node_table_spec = {
+    .name = "tree_sitter_vjass._binding.NodeTable",
+    .basicsize = sizeof(NodeTableObject),
+    .flags = Py_TPFLAGS_DEFAULT,
+    .slots = node_table_slots,
+};
+
+// One file of a parse_many() call, filled in by a worker thread.
+typedef struct {
+    const char *path;
+    TSVjassNodeTable table;
+    uint32_t source_length;
+    int has_error;
+    int error; // errno, 0 on success
+} ParseJob;
+
+typedef struct {
+    ParseJob *jobs;
+    size_t count;
+    size_t next;
+#ifdef _WIN32
+    CRITICAL_SECTION lock;
+#else
+    pthread_mutex_t lock;
+#endif
+} ParseQueue;
+
+static size_t parse_queue_take(ParseQueue *queue) {
+#ifdef _WIN32
+    EnterCriticalSection(&queue->lock);
+    size_t index = queue->next++;
+    LeaveCriticalSection(&queue->lock);
+#else
+    pthread_mutex_lock(&queue->lock);
+    size_t index = queue->next++;
+    pthread_mutex_unlock(&queue->lock);
+#endif
+    return index;
+}
+
+// Takes files off the queue until none are left. Touches no Python state.
+static void parse_worker(ParseQueue *queue) {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_vjass());
+    for (size_t i; (i = parse_queue_take(queue)) < queue->count;) {
+        ParseJob *job = &queue->jobs[i];
+        TSVjassMappedFile file;
+        errno = 0;
+        if (!tree_sitter_vjass_map_file(&file, job->path)) {
+            job->error = errno ? errno : EIO;
+            continue;
+        }
+        TSTree *tree = ts_parser_parse(parser, NULL, tree_sitter_vjass_mapped_input(&file));
+        job->source_length = (uint32_t)file.length;
+        tree_sitter_vjass_unmap_file(&file);
+        if (!tree || !tree_sitter_vjass_node_table_build(tree, &job->table)) {
+            job->error = ENOMEM;
+        } else {
+            job->has_error = ts_node_has_error(ts_tree_root_node(tree));
+        }
+        ts_tree_delete(tree);
+    }
+    ts_parser_delete(parser);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI parse_thread(LPVOID queue) {
+    parse_worker((ParseQueue *)queue);
+    return 0;
+}
+#else
+static void *parse_thread(void *queue) {
+    parse_worker((ParseQueue *)queue);
+    return NULL;
+}
+#endif
+
+#define PARSE_MAX_THREADS 256
+
+// Parses every job on `threads` threads, the calling one included.
+static void parse_jobs(ParseJob *jobs, size_t count, unsigned threads) {
+    ParseQueue queue;
+    queue.jobs = jobs;
+    queue.count = count;
+    queue.next = 0;
+#ifdef _WIN32
+    InitializeCriticalSection(&queue.lock);
+    HANDLE handles[PARSE_MAX_THREADS];
+#else
+    pthread_mutex_init(&queue.lock, NULL);
+    pthread_t handles[PARSE_MAX_THREADS];
+#endif
+    unsigned started = 0;
+    for (; started + 1 < threads && started < PARSE_MAX_THREADS; started++) {
+#ifdef _WIN32
+        handles[started] = CreateThread(NULL, 0, parse_thread, &queue, 0, NULL);
+        if (!handles[started]) break;
+#else
+        if (pthread_create(&handles[started], NULL, parse_thread, &queue) != 0) break;
+#endif
+    }
+    parse_worker(&queue);
+    for (unsigned t = 0; t < started; t++) {
+#ifdef _WIN32
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+#else
+        pthread_join(handles[t], NULL);
+#endif
+    }
+#ifdef _WIN32
+    DeleteCriticalSection(&queue.lock);
+#else
+    pthread_mutex_destroy(&queue.lock);
+#endif
+}
+
+static unsigned cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (unsigned)count : 1;
+#endif
+}
+
+// parse_many(paths, threads=0): memory-maps and parses every path on
+// native threads with the GIL released; on free-threaded builds the calling
+// thread simply detaches. Returns one NodeTable per path, or an OSError
+// instance for a file that could not be read.
+static PyObject *_binding_parse_many(PyObject *self, PyObject *args, PyObject *kwargs) {
+    static char *keywords[] = {"paths", "threads", NULL};
+    PyObject *paths;
+    int threads = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|i:parse_many", keywords, &paths, &threads)) return NULL;
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError, "threads must not be negative");
+        return NULL;
+    }
+
+    // File names as bytes, kept alive while the threads read them.
+    PyObject *originals = PySequence_List(paths);
+    if (!originals) return NULL;
+    Py_ssize_t count = PyList_Size(originals);
+    PyObject *names = PyList_New(0);
+    for (Py_ssize_t i = 0; names && i < count; i++) {
+        PyObject *name = NULL;
+        if (!PyUnicode_FSConverter(PyList_GetItem(originals, i), &name) || PyList_Append(names, name) < 0) {
+            Py_CLEAR(names);
+        }
+        Py_XDECREF(name);
+    }
+    ParseJob *jobs = names ? PyMem_Calloc(count ? (size_t)count : 1, sizeof(ParseJob)) : NULL;
+    if (!jobs) {
+        if (names) PyErr_NoMemory();
+        Py_XDECREF(names);
+        Py_DECREF(originals);
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; i < count; i++) jobs[i].path = PyBytes_AsString(PyList_GetItem(names, i));
+
+    size_t thread_count = threads ? (size_t)threads : cpu_count();
+    if (thread_count > (size_t)count) thread_count = count ? (size_t)count : 1;
+    if (thread_count > PARSE_MAX_THREADS) thread_count = PARSE_MAX_THREADS;
+    Py_BEGIN_ALLOW_THREADS
+    parse_jobs(jobs, (size_t)count, (unsigned)thread_count);
+    Py_END_ALLOW_THREADS
+
+    ModuleState *state = PyModule_GetState(self);
+    PyObject *results = PyList_New(count);
+    for (Py_ssize_t i = 0; results && i < count; i++) {
+        ParseJob *job = &jobs[i];
+        PyObject *item;
+        if (job->error) {
+            item = PyObject_CallFunction(PyExc_OSError, "isO", job->error, strerror(job->error),
+                                         PyList_GetItem(originals, i));
+        } else {
+            NodeTableObject *table = PyObject_New(NodeTableObject, (PyTypeObject *)state->node_table_type);
+            if (table) {
+                table->table = job->table;
+                table->source_length = job->source_length;
+                table->has_error = job->has_error;
+                memset(&job->table, 0, sizeof(job->table));
+            }
+            item = (PyObject *)table;
+        }
+        if (!item || PyList_SetItem(results, i, item) < 0) Py_CLEAR(results);
+    }
+    // Tables not handed over because of an error above.
+    for (Py_ssize_t i = 0; i < count; i++) tree_sitter_vjass_node_table_delete(&jobs[i].table);
+    PyMem_Free(jobs);
+    Py_DECREF(names);
+    Py_DECREF(originals);
+    return results;
+}
+
+static int module_exec(PyObject *module) {
+    ModuleState *state = PyModule_GetState(module);
+    state->node_table_type = PyType_FromSpec(&node_table_spec);
+    if (!state->node_table_type) return -1;
+    return PyModule_AddObjectRef(module, "NodeTable", state->node_table_type);
+}
+
+static int module_traverse(PyObject *module, visitproc visit, void *arg) {
+    ModuleState *state = PyModule_GetState(module);
+    Py_VISIT(state->node_table_type);
+    return 0;
+}
+
+static int module_clear(PyObject *module) {
+    ModuleState *state = PyModule_GetState(module);
+    Py_CLEAR(state->node_table_type);
+    return 0;
+}
+#endif
+
 static struct PyModuleDef_Slot slots[] = {
+#ifdef TREE_SITTER_VJASS_RUNTIME
+    {Py_mod_exec, module_exec},
+#endif
 #ifdef Py_GIL_DISABLED
     {Py_mod_gil, Py_MOD_GIL_NOT_USED},
 #endif
@@ -18,6 +390,12 @@ static struct PyModuleDef_Slot slots[] = {
 static PyMethodDef methods[] = {
     {"language", _binding_language, METH_NOARGS,
      "Get the tree-sitter language for this grammar."},
+#ifdef TREE_SITTER_VJASS_RUNTIME
+    {"alloc_stats", _binding_alloc_stats, METH_O,
+     "Parse a bytes-like source and report what the parse allocated."},
+    {"parse_many", (PyCFunction)(void (*)(void))_binding_parse_many, METH_VARARGS | METH_KEYWORDS,
+     "Parse files on native threads without the GIL and return their node tables."},
+#endif
     {NULL, NULL, 0, NULL}
 };
 
@@ -25,11 +403,28 @@ static struct PyModuleDef module = {
     .m_base = PyModuleDef_HEAD_INIT,
     .m_name = "_binding",
     .m_doc = NULL,
+#ifdef TREE_SITTER_VJASS_RUNTIME
+    .m_size = sizeof(ModuleState),
+    .m_traverse = module_traverse,
+    .m_clear = module_clear,
+#else
     .m_size = 0,
+#endif
     .m_methods = methods,
     .m_slots = slots,
 };
 
 PyMODINIT_FUNC PyInit__binding(void) {
+#ifdef TREE_SITTER_VJASS_RUNTIME
+    // The accounting hooks slow every allocation down, so they are opt-in.
+    // Only this extension's copy of the runtime is affected, and the hooks
+    // can only go in before it has allocated anything: the first import
+    // decides, later ones (subinterpreters) keep what it chose.
+    static int initialized = 0;
+    if (!initialized) {
+        initialized = 1;
+        if (alloc_stats_requested()) tree_sitter_vjass_stats_install();
+    }
+#endif
     return PyModuleDef_Init(&module);
 }
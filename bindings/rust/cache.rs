@@ -0,0 +1,352 @@
+//! On-disk parse cache keyed by file content.
+//!
+//! The Rust counterpart of `tree-sitter-vjass-cache.h`; both read and write
+//! the same entries. Trees cannot be written to disk, so an entry is the
+//! flat [`NodeTable`] derived from one, keyed by a hash of the source seeded
+//! with [`GRAMMAR_HASH`](crate::GRAMMAR_HASH) and the language's name,
+//! version and counts, so a regenerated parser or a changed scanner never
+//! reads entries of the old one. A hit also needs the source length and an
+//! independent [`digest`] of the source to match:
+//!
+//! ```ignore
+//! let language: tree_sitter::Language = tree_sitter_vjass::LANGUAGE.into();
+//! let cache = tree_sitter_vjass::cache::Cache::new(".vjass-cache", &language)?;
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(&language).unwrap();
+//! let (table, hit) = cache.parse(&mut parser, source.as_bytes()).unwrap();
+//! ```
+
+use std::fs;
+use std::io::{self, Write};
+use std::path::{Path, PathBuf};
+
+use tree_sitter::{Language, Parser};
+
+use crate::table::NodeTable;
+
+/// Bumped whenever the entry layout changes.
+pub const FORMAT: u32 = 3;
+
+const MAGIC: &[u8; 4] = b"VJTC";
+const BYTE_ORDER: u32 = 0x0102_0304;
+const HEADER: usize = 40;
+// Bytes per node: five u32 and two u16 columns.
+const ENTRY: usize = 5 * 4 + 2 * 2;
+
+/// MurmurHash64A, as in the C header.
+pub fn hash(data: &[u8], seed: u64) -> u64 {
+    const M: u64 = 0xc6a4_a793_5bd1_e995;
+    const R: u32 = 47;
+    let mut h = seed ^ (data.len() as u64).wrapping_mul(M);
+
+    let mut blocks = data.chunks_exact(8);
+    for block in &mut blocks {
+        let mut k = u64::from_le_bytes(block.try_into().unwrap());
+        k = k.wrapping_mul(M);
+        k ^= k >> R;
+        k = k.wrapping_mul(M);
+        h ^= k;
+        h = h.wrapping_mul(M);
+    }
+
+    let tail = blocks.remainder();
+    if !tail.is_empty() {
+        for (i, &byte) in tail.iter().enumerate() {
+            h ^= u64::from(byte) << (8 * i);
+        }
+        h = h.wrapping_mul(M);
+    }
+
+    h ^= h >> R;
+    h = h.wrapping_mul(M);
+    h ^= h >> R;
+    h
+}
+
+const XXH_P1: u64 = 0x9e37_79b1_85eb_ca87;
+const XXH_P2: u64 = 0xc2b2_ae3d_27d4_eb4f;
+const XXH_P3: u64 = 0x1656_67b1_9e37_79f9;
+const XXH_P4: u64 = 0x85eb_ca77_c2b2_ae63;
+const XXH_P5: u64 = 0x27d4_eb2f_1656_67c5;
+
+fn xxh_round(acc: u64, input: u64) -> u64 {
+    acc.wrapping_add(input.wrapping_mul(XXH_P2))
+        .rotate_left(31)
+        .wrapping_mul(XXH_P1)
+}
+
+/// XXH64 with seed 0, as `tree_sitter_vjass_cache_digest()` in C: the
+/// digest that confirms a hit on the [`hash`] key. A different construction,
+/// so a collision of one is not one of the other.
+pub fn digest(data: &[u8]) -> u64 {
+    let read64 = |bytes: &[u8]| u64::from_le_bytes(bytes[..8].try_into().unwrap());
+    let mut rest = data;
+    let mut h = if data.len() >= 32 {
+        let mut v = [
+            XXH_P1.wrapping_add(XXH_P2),
+            XXH_P2,
+            0,
+            0u64.wrapping_sub(XXH_P1),
+        ];
+        let mut stripes = data.chunks_exact(32);
+        for stripe in &mut stripes {
+            for (lane, acc) in v.iter_mut().enumerate() {
+                *acc = xxh_round(*acc, read64(&stripe[lane * 8..]));
+            }
+        }
+        rest = stripes.remainder();
+        let mut h = v[0]
+            .rotate_left(1)
+            .wrapping_add(v[1].rotate_left(7))
+            .wrapping_add(v[2].rotate_left(12))
+            .wrapping_add(v[3].rotate_left(18));
+        for acc in v {
+            h ^= xxh_round(0, acc);
+            h = h.wrapping_mul(XXH_P1).wrapping_add(XXH_P4);
+        }
+        h
+    } else {
+        XXH_P5
+    };
+    h = h.wrapping_add(data.len() as u64);
+
+    let mut words = rest.chunks_exact(8);
+    for word in &mut words {
+        h ^= xxh_round(0, read64(word));
+        h = h.rotate_left(27).wrapping_mul(XXH_P1).wrapping_add(XXH_P4);
+    }
+    let mut rest = words.remainder();
+    if rest.len() >= 4 {
+        let k = u64::from(u32::from_le_bytes(rest[..4].try_into().unwrap()));
+        h ^= k.wrapping_mul(XXH_P1);
+        h = h.rotate_left(23).wrapping_mul(XXH_P2).wrapping_add(XXH_P3);
+        rest = &rest[4..];
+    }
+    for &byte in rest {
+        h ^= u64::from(byte).wrapping_mul(XXH_P5);
+        h = h.rotate_left(11).wrapping_mul(XXH_P1);
+    }
+
+    h ^= h >> 33;
+    h = h.wrapping_mul(XXH_P2);
+    h ^= h >> 29;
+    h = h.wrapping_mul(XXH_P3);
+    h ^= h >> 32;
+    h
+}
+
+/// Hash seed that identifies the grammar, so two languages that could
+/// produce different tables for the same source never share an entry. The
+/// same seed as `tree_sitter_vjass_cache_seed()` in C.
+pub fn seed(language: &Language) -> u64 {
+    let (major, minor, patch) = language.metadata().map_or((0, 0, 0), |m| {
+        (m.major_version, m.minor_version, m.patch_version)
+    });
+    let tag = format!(
+        "{} {major}.{minor}.{patch} abi {} symbols {} fields {} states {}",
+        language.name().unwrap_or(""),
+        language.abi_version(),
+        language.node_kind_count(),
+        language.field_count(),
+        language.parse_state_count()
+    );
+    hash(tag.as_bytes(), crate::GRAMMAR_HASH)
+}
+
+/// A cache directory; every entry is one `<key>.vjt` file in it.
+#[derive(Debug, Clone)]
+pub struct Cache {
+    dir: PathBuf,
+    seed: u64,
+}
+
+impl Cache {
+    /// Opens (and creates) the cache in `dir` for `language`.
+    pub fn new(dir: impl Into<PathBuf>, language: &Language) -> io::Result<Self> {
+        let dir = dir.into();
+        fs::create_dir_all(&dir)?;
+        Ok(Self {
+            dir,
+            seed: seed(language),
+        })
+    }
+
+    pub fn dir(&self) -> &Path {
+        &self.dir
+    }
+
+    pub fn key(&self, source: &[u8]) -> u64 {
+        hash(source, self.seed)
+    }
+
+    pub fn path(&self, key: u64) -> PathBuf {
+        self.dir.join(format!("{key:016x}.vjt"))
+    }
+
+    /// The entry for `key`, or `None` if it is missing, truncated or was
+    /// written for another source length, source [`digest`], format or byte
+    /// order.
+    pub fn load(&self, key: u64, source_len: u32, digest: u64) -> Option<NodeTable> {
+        let data = fs::read(self.path(key)).ok()?;
+        let header = data.get(..HEADER)?;
+        let u32_at =
+            |offset: usize| u32::from_ne_bytes(header[offset..offset + 4].try_into().unwrap());
+        let u64_at =
+            |offset: usize| u64::from_ne_bytes(header[offset..offset + 8].try_into().unwrap());
+        if &header[..4] != MAGIC
+            || u32_at(4) != FORMAT
+            || u32_at(8) != BYTE_ORDER
+            || u64_at(16) != key
+            || u32_at(24) != source_len
+            || u64_at(32) != digest
+        {
+            return None;
+        }
+        let count = u32_at(12) as usize;
+        if data.len() != HEADER + count * ENTRY {
+            return None;
+        }
+
+        let mut rest = &data[HEADER..];
+        let mut take_u32 = || {
+            let (bytes, tail) = rest.split_at(count * 4);
+            rest = tail;
+            bytes
+                .chunks_exact(4)
+                .map(|b| u32::from_ne_bytes(b.try_into().unwrap()))
+                .collect()
+        };
+        let start_byte = take_u32();
+        let end_byte = take_u32();
+        let parent = take_u32();
+        let first_child = take_u32();
+        let next_sibling = take_u32();
+        let (symbol, flags) = rest.split_at(count * 2);
+        let take_u16 = |bytes: &[u8]| {
+            bytes
+                .chunks_exact(2)
+                .map(|b| u16::from_ne_bytes(b.try_into().unwrap()))
+                .collect()
+        };
+        Some(NodeTable {
+            start_byte,
+            end_byte,
+            parent,
+            first_child,
+            next_sibling,
+            symbol: take_u16(symbol),
+            flags: take_u16(flags),
+        })
+    }
+
+    /// Writes `table` as the entry for `key`. The entry is written to a
+    /// temporary file and renamed into place, so readers never see a partial
+    /// one.
+    pub fn store(
+        &self,
+        key: u64,
+        source_len: u32,
+        digest: u64,
+        table: &NodeTable,
+    ) -> io::Result<()> {
+        let count = table.len();
+        let mut data = Vec::with_capacity(HEADER + count * ENTRY);
+        data.extend_from_slice(MAGIC);
+        data.extend_from_slice(&FORMAT.to_ne_bytes());
+        data.extend_from_slice(&BYTE_ORDER.to_ne_bytes());
+        data.extend_from_slice(&(count as u32).to_ne_bytes());
+        data.extend_from_slice(&key.to_ne_bytes());
+        data.extend_from_slice(&source_len.to_ne_bytes());
+        data.extend_from_slice(&0u32.to_ne_bytes());
+        data.extend_from_slice(&digest.to_ne_bytes());
+        for column in [
+            &table.start_byte,
+            &table.end_byte,
+            &table.parent,
+            &table.first_child,
+            &table.next_sibling,
+        ] {
+            column
+                .iter()
+                .for_each(|v| data.extend_from_slice(&v.to_ne_bytes()));
+        }
+        for column in [&table.symbol, &table.flags] {
+            column
+                .iter()
+                .for_each(|v| data.extend_from_slice(&v.to_ne_bytes()));
+        }
+
+        let path = self.path(key);
+        let temporary = path.with_extension(format!(
+            "vjt.{}.{:x}.tmp",
+            std::process::id(),
+            table as *const NodeTable as usize
+        ));
+        let result = fs::File::create(&temporary)
+            .and_then(|mut file| file.write_all(&data))
+            .and_then(|()| fs::rename(&temporary, &path));
+        if result.is_err() {
+            let _ = fs::remove_file(&temporary);
+        }
+        result
+    }
+
+    /// Looks `source` up and, on a miss, parses it with `parser` and stores
+    /// its table. Returns the table and whether it came from the cache, or
+    /// `None` if the parse failed. A failed store is not an error.
+    pub fn parse(&self, parser: &mut Parser, source: &[u8]) -> Option<(NodeTable, bool)> {
+        let key = self.key(source);
+        let len = source.len() as u32;
+        let digest = digest(source);
+        if let Some(table) = self.load(key, len, digest) {
+            return Some((table, true));
+        }
+        let table = NodeTable::from_tree(&parser.parse(source, None)?);
+        let _ = self.store(key, len, digest, &table);
+        Some((table, false))
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn hash_matches_the_c_header() {
+        assert_eq!(hash(b"", 0), 0);
+        assert_eq!(hash(b"hello world", 0), 0xd3ba_2368_a832_afce);
+        assert_eq!(hash(b"0123456789abcdefXYZ", 42), 0xef00_2016_3816_8f10);
+    }
+
+    #[test]
+    fn digest_is_xxh64() {
+        assert_eq!(digest(b""), 0xef46_db37_51d8_e999);
+        assert_eq!(digest(b"abc"), 0x44bc_2cf5_ad77_0999);
+        assert_eq!(
+            digest(b"Nobody inspects the spammish repetition"),
+            0xfbce_a83c_8a37_8bf1
+        );
+    }
+
+    #[test]
+    fn entries_round_trip() {
+        let language: Language = crate::LANGUAGE.into();
+        let dir = std::env::temp_dir().join(format!("vjass-cache-test-{}", std::process::id()));
+        let cache = Cache::new(&dir, &language).unwrap();
+        let source = b"globals\n    integer a = 1\nendglobals\n";
+
+        let mut parser = Parser::new();
+        parser.set_language(&language).unwrap();
+        let (cold, hit) = cache.parse(&mut parser, source).unwrap();
+        assert!(!hit);
+        let (warm, hit) = cache.parse(&mut parser, source).unwrap();
+        assert!(hit);
+        assert_eq!(cold, warm);
+        assert_eq!(cold.parent[0], u32::MAX);
+        let (key, len) = (cache.key(source), source.len() as u32);
+        assert!(cache.load(key, len + 1, digest(source)).is_none());
+        assert!(cache.load(key, len, digest(source) ^ 1).is_none());
+
+        fs::remove_dir_all(&dir).unwrap();
+    }
+}
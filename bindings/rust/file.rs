@@ -0,0 +1,57 @@
+//! Parsing straight from a memory-mapped file.
+
+use std::fs::File;
+use std::io;
+use std::path::Path;
+
+use memmap2::Mmap;
+use tree_sitter::{Parser, Tree};
+
+/// How many bytes the parser is handed per read callback.
+pub const READ_CHUNK: usize = 1 << 20;
+
+/// Memory-maps `path` and parses it without copying the source into memory.
+///
+/// The parser pulls the text through a chunked read callback over the
+/// mapping, so peak memory is the tree plus the pages of the file the OS
+/// keeps resident instead of the tree plus a full copy of the file. The
+/// mapping is dropped before returning; node offsets stay valid, read the
+/// text again if you need it.
+///
+/// The file must not be truncated by another process while it is being
+/// parsed. Files larger than 4 GiB are rejected, since tree-sitter offsets
+/// are 32-bit.
+pub fn parse_file(
+    parser: &mut Parser,
+    path: impl AsRef<Path>,
+    old_tree: Option<&Tree>,
+) -> io::Result<Option<Tree>> {
+    let file = File::open(path)?;
+    let len = file.metadata()?.len();
+    if len > u64::from(u32::MAX) {
+        return Err(io::Error::new(
+            io::ErrorKind::InvalidData,
+            "file is larger than 4 GiB",
+        ));
+    }
+    if len == 0 {
+        return Ok(parser.parse("", old_tree));
+    }
+
+    // SAFETY: the mapping is read-only and private to this call; see the
+    // note on concurrent truncation above.
+    let map = unsafe { Mmap::map(&file)? };
+    #[cfg(unix)]
+    let _ = map.advise(memmap2::Advice::Sequential);
+
+    let source: &[u8] = &map;
+    Ok(parser.parse_with_options(
+        &mut |byte: usize, _| {
+            let start = byte.min(source.len());
+            let end = (start + READ_CHUNK).min(source.len());
+            &source[start..end]
+        },
+        old_tree,
+        None,
+    ))
+}
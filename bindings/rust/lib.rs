@@ -20,7 +20,18 @@
 
 use tree_sitter_language::LanguageFn;
 
-extern "C" {
+#[cfg(feature = "file")]
+mod file;
+#[cfg(feature = "file")]
+pub use file::{READ_CHUNK, parse_file};
+#[cfg(feature = "cache")]
+pub mod cache;
+#[cfg(feature = "stats")]
+pub mod stats;
+#[cfg(feature = "table")]
+pub mod table;
+
+unsafe extern "C" {
     fn tree_sitter_vjass() -> *const ();
 }
 
@@ -34,6 +45,293 @@ pub const LANGUAGE: LanguageFn = unsafe { LanguageFn::from_raw(tree_sitter_vjass
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers/6-static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
+// BEGIN generate-symbols.js
+// Generated by generate-symbols.js from src/parser.c; do not edit.
+
+/// Kind ids of the named node types, as returned by `Node::kind_id()` for
+/// [`LANGUAGE`]. They change whenever `src/parser.c` is regenerated.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
+#[repr(u16)]
+pub enum Symbol {
+    Id = 1,
+    Struct_ = 2,
+    Endstruct_ = 3,
+    Globals_ = 4,
+    Endglobals_ = 5,
+    Loop_ = 6,
+    Endloop_ = 7,
+    Rawcode = 26,
+    Number = 27,
+    Float = 28,
+    Local = 29,
+    Constant = 30,
+    Array = 31,
+    Set_ = 34,
+    Call_ = 35,
+    Return_ = 36,
+    Exitwhen_ = 37,
+    If_ = 38,
+    Then_ = 39,
+    Elseif_ = 40,
+    Else_ = 41,
+    Endif_ = 42,
+    Function_ = 43,
+    Takes_ = 44,
+    Nothing = 45,
+    Returns_ = 46,
+    Endfunction_ = 47,
+    Program = 56,
+    Struct = 59,
+    Globals = 60,
+    Loop = 61,
+    Expr = 62,
+    VarStmt = 63,
+    VarDecl = 64,
+    String = 65,
+    SetStatement = 66,
+    CallStatement = 67,
+    ReturnStatement = 68,
+    ExitwhenStatement = 69,
+    IfStatement = 70,
+    Function = 71,
+    ParameterList = 72,
+    Parameter = 73,
+    FunctionCall = 74,
+    FunctionArguments = 75,
+    Comment = 76,
+    FunctionCallParen = 84,
+}
+
+impl Symbol {
+    /// Every constant, in id order.
+    pub const ALL: &[Symbol] = &[
+        Symbol::Id,
+        Symbol::Struct_,
+        Symbol::Endstruct_,
+        Symbol::Globals_,
+        Symbol::Endglobals_,
+        Symbol::Loop_,
+        Symbol::Endloop_,
+        Symbol::Rawcode,
+        Symbol::Number,
+        Symbol::Float,
+        Symbol::Local,
+        Symbol::Constant,
+        Symbol::Array,
+        Symbol::Set_,
+        Symbol::Call_,
+        Symbol::Return_,
+        Symbol::Exitwhen_,
+        Symbol::If_,
+        Symbol::Then_,
+        Symbol::Elseif_,
+        Symbol::Else_,
+        Symbol::Endif_,
+        Symbol::Function_,
+        Symbol::Takes_,
+        Symbol::Nothing,
+        Symbol::Returns_,
+        Symbol::Endfunction_,
+        Symbol::Program,
+        Symbol::Struct,
+        Symbol::Globals,
+        Symbol::Loop,
+        Symbol::Expr,
+        Symbol::VarStmt,
+        Symbol::VarDecl,
+        Symbol::String,
+        Symbol::SetStatement,
+        Symbol::CallStatement,
+        Symbol::ReturnStatement,
+        Symbol::ExitwhenStatement,
+        Symbol::IfStatement,
+        Symbol::Function,
+        Symbol::ParameterList,
+        Symbol::Parameter,
+        Symbol::FunctionCall,
+        Symbol::FunctionArguments,
+        Symbol::Comment,
+        Symbol::FunctionCallParen,
+    ];
+
+    /// The constant with this id, if it has one.
+    pub const fn from_id(id: u16) -> Option<Self> {
+        match id {
+            1 => Some(Symbol::Id),
+            2 => Some(Symbol::Struct_),
+            3 => Some(Symbol::Endstruct_),
+            4 => Some(Symbol::Globals_),
+            5 => Some(Symbol::Endglobals_),
+            6 => Some(Symbol::Loop_),
+            7 => Some(Symbol::Endloop_),
+            26 => Some(Symbol::Rawcode),
+            27 => Some(Symbol::Number),
+            28 => Some(Symbol::Float),
+            29 => Some(Symbol::Local),
+            30 => Some(Symbol::Constant),
+            31 => Some(Symbol::Array),
+            34 => Some(Symbol::Set_),
+            35 => Some(Symbol::Call_),
+            36 => Some(Symbol::Return_),
+            37 => Some(Symbol::Exitwhen_),
+            38 => Some(Symbol::If_),
+            39 => Some(Symbol::Then_),
+            40 => Some(Symbol::Elseif_),
+            41 => Some(Symbol::Else_),
+            42 => Some(Symbol::Endif_),
+            43 => Some(Symbol::Function_),
+            44 => Some(Symbol::Takes_),
+            45 => Some(Symbol::Nothing),
+            46 => Some(Symbol::Returns_),
+            47 => Some(Symbol::Endfunction_),
+            56 => Some(Symbol::Program),
+            59 => Some(Symbol::Struct),
+            60 => Some(Symbol::Globals),
+            61 => Some(Symbol::Loop),
+            62 => Some(Symbol::Expr),
+            63 => Some(Symbol::VarStmt),
+            64 => Some(Symbol::VarDecl),
+            65 => Some(Symbol::String),
+            66 => Some(Symbol::SetStatement),
+            67 => Some(Symbol::CallStatement),
+            68 => Some(Symbol::ReturnStatement),
+            69 => Some(Symbol::ExitwhenStatement),
+            70 => Some(Symbol::IfStatement),
+            71 => Some(Symbol::Function),
+            72 => Some(Symbol::ParameterList),
+            73 => Some(Symbol::Parameter),
+            74 => Some(Symbol::FunctionCall),
+            75 => Some(Symbol::FunctionArguments),
+            76 => Some(Symbol::Comment),
+            84 => Some(Symbol::FunctionCallParen),
+            _ => None,
+        }
+    }
+
+    /// The name, as in `node-types.json`.
+    pub const fn name(self) -> &'static str {
+        match self {
+            Symbol::Id => "id",
+            Symbol::Struct_ => "struct_",
+            Symbol::Endstruct_ => "endstruct_",
+            Symbol::Globals_ => "globals_",
+            Symbol::Endglobals_ => "endglobals_",
+            Symbol::Loop_ => "loop_",
+            Symbol::Endloop_ => "endloop_",
+            Symbol::Rawcode => "rawcode",
+            Symbol::Number => "number",
+            Symbol::Float => "float",
+            Symbol::Local => "local",
+            Symbol::Constant => "constant",
+            Symbol::Array => "array",
+            Symbol::Set_ => "set_",
+            Symbol::Call_ => "call_",
+            Symbol::Return_ => "return_",
+            Symbol::Exitwhen_ => "exitwhen_",
+            Symbol::If_ => "if_",
+            Symbol::Then_ => "then_",
+            Symbol::Elseif_ => "elseif_",
+            Symbol::Else_ => "else_",
+            Symbol::Endif_ => "endif_",
+            Symbol::Function_ => "function_",
+            Symbol::Takes_ => "takes_",
+            Symbol::Nothing => "nothing",
+            Symbol::Returns_ => "returns_",
+            Symbol::Endfunction_ => "endfunction_",
+            Symbol::Program => "program",
+            Symbol::Struct => "struct",
+            Symbol::Globals => "globals",
+            Symbol::Loop => "loop",
+            Symbol::Expr => "expr",
+            Symbol::VarStmt => "var_stmt",
+            Symbol::VarDecl => "var_decl",
+            Symbol::String => "string",
+            Symbol::SetStatement => "set_statement",
+            Symbol::CallStatement => "call_statement",
+            Symbol::ReturnStatement => "return_statement",
+            Symbol::ExitwhenStatement => "exitwhen_statement",
+            Symbol::IfStatement => "if_statement",
+            Symbol::Function => "function",
+            Symbol::ParameterList => "parameter_list",
+            Symbol::Parameter => "parameter",
+            Symbol::FunctionCall => "function_call",
+            Symbol::FunctionArguments => "function_arguments",
+            Symbol::Comment => "comment",
+            Symbol::FunctionCallParen => "function_call_paren",
+        }
+    }
+}
+
+/// Field ids, as returned by `TreeCursor::field_id()` for [`LANGUAGE`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
+#[repr(u16)]
+pub enum Field {
+    Args = 1,
+    Condition = 2,
+    Content = 3,
+    End = 4,
+    Name = 5,
+    Prefix = 6,
+    Returns = 7,
+    Start = 8,
+    Type = 9,
+    Value = 10,
+}
+
+impl Field {
+    /// Every constant, in id order.
+    pub const ALL: &[Field] = &[
+        Field::Args,
+        Field::Condition,
+        Field::Content,
+        Field::End,
+        Field::Name,
+        Field::Prefix,
+        Field::Returns,
+        Field::Start,
+        Field::Type,
+        Field::Value,
+    ];
+
+    /// The constant with this id, if it has one.
+    pub const fn from_id(id: u16) -> Option<Self> {
+        match id {
+            1 => Some(Field::Args),
+            2 => Some(Field::Condition),
+            3 => Some(Field::Content),
+            4 => Some(Field::End),
+            5 => Some(Field::Name),
+            6 => Some(Field::Prefix),
+            7 => Some(Field::Returns),
+            8 => Some(Field::Start),
+            9 => Some(Field::Type),
+            10 => Some(Field::Value),
+            _ => None,
+        }
+    }
+
+    /// The name, as in `node-types.json`.
+    pub const fn name(self) -> &'static str {
+        match self {
+            Field::Args => "args",
+            Field::Condition => "condition",
+            Field::Content => "content",
+            Field::End => "end",
+            Field::Name => "name",
+            Field::Prefix => "prefix",
+            Field::Returns => "returns",
+            Field::Start => "start",
+            Field::Type => "type",
+            Field::Value => "value",
+        }
+    }
+}
+
+/// Identifies `src/parser.c` and `src/scanner.c`; the parse cache seeds its
+/// keys with it.
+pub const GRAMMAR_HASH: u64 = 0x1929_f035_bad0_588e;
+// END generate-symbols.js
+
 // NOTE: uncomment these to include any queries that this grammar contains:
 
 // pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
@@ -50,4 +348,94 @@ mod tests {
             .set_language(&super::LANGUAGE.into())
             .expect("Error loading Vjass parser");
     }
+
+    #[test]
+    fn test_symbols_match_language() {
+        use super::{Field, Symbol};
+
+        let language: tree_sitter::Language = super::LANGUAGE.into();
+        for &symbol in Symbol::ALL {
+            assert_eq!(
+                language.id_for_node_kind(symbol.name(), true),
+                symbol as u16,
+                "{symbol:?}"
+            );
+            assert_eq!(Symbol::from_id(symbol as u16), Some(symbol));
+        }
+        // Every named kind the parser can report has a constant.
+        for id in 0..language.node_kind_count() as u16 {
+            let Some(name) = language.node_kind_for_id(id) else {
+                continue;
+            };
+            if language.node_kind_is_named(id)
+                && language.node_kind_is_visible(id)
+                && language.id_for_node_kind(name, true) == id
+            {
+                assert_eq!(Symbol::from_id(id).map(Symbol::name), Some(name));
+            }
+        }
+        for &field in Field::ALL {
+            assert_eq!(
+                language.field_id_for_name(field.name()).map(|id| id.get()),
+                Some(field as u16)
+            );
+        }
+        assert_eq!(Field::ALL.len(), language.field_count());
+    }
+
+    #[test]
+    fn test_parsers_on_many_threads_agree() {
+        const THREADS: usize = 8;
+        const ROUNDS: usize = 50;
+
+        let sources: Vec<String> = (0..THREADS)
+            .map(|i| {
+                format!(
+                    "globals\n\
+                     \x20   constant string A = \"str {i} ]] 'q'\"\n\
+                     \x20   integer array ids\n\
+                     endglobals\n\
+                     /* block {i}\n\
+                     \x20  call F{i}(1) */\n\
+                     --[==[ block {i} ]] ]=] ]==]\n\
+                     function F{i} takes integer n returns integer\n\
+                     \x20   local string s = [=[ long {i} ]] ]=]\n\
+                     \x20   loop\n\
+                     \x20       exitwhen n > {i}\n\
+                     \x20       set ids[n] = 'A00{i}' + d.e\n\
+                     \x20       set n = n + 1\n\
+                     \x20   endloop\n\
+                     \x20   return n\n\
+                     endfunction\n"
+                )
+            })
+            .collect();
+
+        // The reference trees, parsed on this thread one at a time.
+        let expected: Vec<String> = sources
+            .iter()
+            .map(|source| {
+                let mut parser = tree_sitter::Parser::new();
+                parser.set_language(&super::LANGUAGE.into()).unwrap();
+                let tree = parser.parse(source, None).unwrap();
+                let sexp = tree.root_node().to_sexp();
+                assert!(!tree.root_node().has_error(), "{sexp}");
+                sexp
+            })
+            .collect();
+
+        std::thread::scope(|scope| {
+            for (source, expected) in sources.iter().zip(&expected) {
+                scope.spawn(move || {
+                    let mut parser = tree_sitter::Parser::new();
+                    parser.set_language(&super::LANGUAGE.into()).unwrap();
+                    for _ in 0..ROUNDS {
+                        let tree = parser.parse(source, None).unwrap();
+                        assert!(!tree.root_node().has_error());
+                        assert_eq!(&tree.root_node().to_sexp(), expected);
+                    }
+                });
+            }
+        });
+    }
 }
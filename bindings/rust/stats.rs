@@ -0,0 +1,177 @@
+//! Allocation accounting for the tree-sitter runtime.
+//!
+//! The Rust counterpart of `tree-sitter-vjass-stats.h`: once [`install`] has
+//! routed the runtime allocator through these hooks, every allocation the
+//! parser makes is counted on the calling thread, so a parse can be measured
+//! with [`measure`]:
+//!
+//! ```ignore
+//! unsafe { tree_sitter_vjass::stats::install() };
+//! let mut parser = tree_sitter::Parser::new();
+//! parser.set_language(&tree_sitter_vjass::LANGUAGE.into()).unwrap();
+//! let (tree, stats) = tree_sitter_vjass::stats::measure(|| parser.parse(source, None));
+//! println!("{} allocations, peak {} bytes", stats.allocations, stats.peak_live_bytes);
+//! ```
+
+use std::alloc::{self, Layout};
+use std::cell::RefCell;
+use std::ffi::c_void;
+use std::ptr;
+
+/// Number of histogram buckets; see [`bucket_limit`].
+pub const BUCKETS: usize = 16;
+
+const MIN_SHIFT: u32 = 4;
+
+/// Every block is prefixed with its size; 16 bytes keeps the payload aligned
+/// like malloc's.
+const HEADER: usize = 16;
+const ALIGN: usize = 16;
+
+/// What the runtime allocated on one thread since the last [`reset`].
+#[derive(Debug, Default, Clone, Copy, PartialEq, Eq)]
+pub struct AllocStats {
+    /// malloc, calloc and realloc calls.
+    pub allocations: u64,
+    pub frees: u64,
+    /// Bytes requested, summed over all allocations.
+    pub bytes: u64,
+    /// Allocated minus freed bytes. Negative when blocks allocated before
+    /// the reset (or on another thread) were freed.
+    pub live_bytes: i64,
+    /// Maximum of `live_bytes`.
+    pub peak_live_bytes: i64,
+    /// Request sizes; bucket `i` counts requests of at most
+    /// [`bucket_limit(i)`](bucket_limit) bytes.
+    pub histogram: [u64; BUCKETS],
+}
+
+thread_local! {
+    static STATS: RefCell<AllocStats> = const { RefCell::new(AllocStats {
+        allocations: 0,
+        frees: 0,
+        bytes: 0,
+        live_bytes: 0,
+        peak_live_bytes: 0,
+        histogram: [0; BUCKETS],
+    }) };
+}
+
+/// Upper bound (inclusive) of histogram bucket `i`, or `None` for the last
+/// bucket, which counts everything larger than 256 KiB.
+pub fn bucket_limit(i: usize) -> Option<usize> {
+    (i + 1 < BUCKETS).then(|| 1 << (i as u32 + MIN_SHIFT))
+}
+
+fn bucket(size: usize) -> usize {
+    (0..BUCKETS - 1)
+        .find(|&i| size <= 1 << (i as u32 + MIN_SHIFT))
+        .unwrap_or(BUCKETS - 1)
+}
+
+fn record(size: usize, old_size: usize) {
+    // Ignored while the thread-local is being torn down.
+    let _ = STATS.try_with(|stats| {
+        let mut stats = stats.borrow_mut();
+        stats.allocations += 1;
+        stats.bytes += size as u64;
+        stats.histogram[bucket(size)] += 1;
+        stats.live_bytes += size as i64 - old_size as i64;
+        stats.peak_live_bytes = stats.peak_live_bytes.max(stats.live_bytes);
+    });
+}
+
+fn layout(size: usize) -> Layout {
+    Layout::from_size_align(HEADER + size, ALIGN).expect("tree-sitter-vjass: allocation too large")
+}
+
+unsafe fn finish(block: *mut u8, size: usize) -> *mut c_void {
+    if block.is_null() {
+        alloc::handle_alloc_error(layout(size));
+    }
+    unsafe {
+        block.cast::<usize>().write(size);
+        block.add(HEADER).cast()
+    }
+}
+
+unsafe extern "C" fn stats_malloc(size: usize) -> *mut c_void {
+    record(size, 0);
+    unsafe { finish(alloc::alloc(layout(size)), size) }
+}
+
+unsafe extern "C" fn stats_calloc(count: usize, size: usize) -> *mut c_void {
+    let Some(size) = count.checked_mul(size) else {
+        return ptr::null_mut();
+    };
+    record(size, 0);
+    unsafe { finish(alloc::alloc_zeroed(layout(size)), size) }
+}
+
+unsafe extern "C" fn stats_realloc(payload: *mut c_void, size: usize) -> *mut c_void {
+    if payload.is_null() {
+        return unsafe { stats_malloc(size) };
+    }
+    unsafe {
+        let block = payload.cast::<u8>().sub(HEADER);
+        let old_size = block.cast::<usize>().read();
+        record(size, old_size);
+        finish(alloc::realloc(block, layout(old_size), HEADER + size), size)
+    }
+}
+
+unsafe extern "C" fn stats_free(payload: *mut c_void) {
+    if payload.is_null() {
+        return;
+    }
+    unsafe {
+        let block = payload.cast::<u8>().sub(HEADER);
+        let size = block.cast::<usize>().read();
+        let _ = STATS.try_with(|stats| {
+            let mut stats = stats.borrow_mut();
+            stats.frees += 1;
+            stats.live_bytes -= size as i64;
+        });
+        alloc::dealloc(block, layout(size));
+    }
+}
+
+/// Routes every allocation of the tree-sitter runtime through the
+/// accounting hooks.
+///
+/// # Safety
+///
+/// Must be called before the runtime allocates anything (before the first
+/// [`Parser`](tree_sitter::Parser) is created, on any thread), and the hooks
+/// must stay in place for as long as any tree-sitter object is alive: blocks
+/// carry a header that the default `free` does not know about.
+pub unsafe fn install() {
+    unsafe {
+        tree_sitter::set_allocator(
+            Some(stats_malloc),
+            Some(stats_calloc),
+            Some(stats_realloc),
+            Some(stats_free),
+        );
+    }
+}
+
+/// Zeroes the calling thread's counters.
+pub fn reset() {
+    STATS.with_borrow_mut(|stats| *stats = AllocStats::default());
+}
+
+/// The calling thread's counters since the last [`reset`].
+pub fn current() -> AllocStats {
+    STATS.with_borrow(|stats| *stats)
+}
+
+/// Resets the counters, runs `f` (typically one parse) and returns its
+/// result together with what it allocated on this thread.
+///
+/// Only meaningful after [`install`]; otherwise all counters stay 0.
+pub fn measure<T>(f: impl FnOnce() -> T) -> (T, AllocStats) {
+    reset();
+    let result = f();
+    (result, current())
+}
@@ -0,0 +1,189 @@
+//! Flat node table: a whole tree as a structure of arrays.
+//!
+//! The Rust counterpart of `tree-sitter-vjass-table.h`. Walking a tree with
+//! [`Node::child`](tree_sitter::Node::child) costs O(i) per call, so visiting
+//! every child that way is quadratic. [`NodeTable::from_tree`] flattens the
+//! tree in one [`TreeCursor`](tree_sitter::TreeCursor) pass instead; nodes
+//! are in preorder and refer to each other by index:
+//!
+//! ```ignore
+//! let table = tree_sitter_vjass::table::NodeTable::from_tree(&tree);
+//! let functions = table.symbol.iter().filter(|&&s| s == function).count();
+//! for child in table.children(0) {
+//!     println!("{} {}..{}", table.symbol[child], table.start_byte[child], table.end_byte[child]);
+//! }
+//! ```
+
+use tree_sitter::Tree;
+
+/// No parent, child or sibling.
+pub const NONE: u32 = u32::MAX;
+
+/// [`NodeTable::flags`] bits.
+pub const NODE_NAMED: u16 = 0x1;
+pub const NODE_EXTRA: u16 = 0x2;
+pub const NODE_ERROR: u16 = 0x4;
+pub const NODE_MISSING: u16 = 0x8;
+
+/// All nodes of a tree in preorder, one vector per field. The root is node
+/// 0; the subtree of node `n` is `n..n + subtree_len(n)`.
+#[derive(Debug, Default, Clone, PartialEq, Eq)]
+pub struct NodeTable {
+    pub start_byte: Vec<u32>,
+    pub end_byte: Vec<u32>,
+    /// [`NONE`] for the root.
+    pub parent: Vec<u32>,
+    /// [`NONE`] for leaves.
+    pub first_child: Vec<u32>,
+    /// [`NONE`] for last children.
+    pub next_sibling: Vec<u32>,
+    /// `Node::kind_id`, so aliases have their alias symbol.
+    pub symbol: Vec<u16>,
+    /// `NODE_*` bits.
+    pub flags: Vec<u16>,
+}
+
+impl NodeTable {
+    /// Flattens `tree` in one [`TreeCursor`](tree_sitter::TreeCursor) pass.
+    pub fn from_tree(tree: &Tree) -> Self {
+        let count = tree.root_node().descendant_count();
+        let mut table = Self {
+            start_byte: Vec::with_capacity(count),
+            end_byte: Vec::with_capacity(count),
+            parent: Vec::with_capacity(count),
+            first_child: Vec::with_capacity(count),
+            next_sibling: Vec::with_capacity(count),
+            symbol: Vec::with_capacity(count),
+            flags: Vec::with_capacity(count),
+        };
+
+        let mut cursor = tree.walk();
+        let mut parent = NONE;
+        let mut previous = NONE;
+        loop {
+            let node = cursor.node();
+            let index = table.symbol.len() as u32;
+            table.start_byte.push(node.start_byte() as u32);
+            table.end_byte.push(node.end_byte() as u32);
+            table.parent.push(parent);
+            table.first_child.push(NONE);
+            table.next_sibling.push(NONE);
+            table.symbol.push(node.kind_id());
+            table.flags.push(
+                if node.is_named() { NODE_NAMED } else { 0 }
+                    | if node.is_extra() { NODE_EXTRA } else { 0 }
+                    | if node.is_error() { NODE_ERROR } else { 0 }
+                    | if node.is_missing() { NODE_MISSING } else { 0 },
+            );
+            if previous != NONE {
+                table.next_sibling[previous as usize] = index;
+            } else if parent != NONE {
+                table.first_child[parent as usize] = index;
+            }
+
+            if cursor.goto_first_child() {
+                parent = index;
+                previous = NONE;
+                continue;
+            }
+            // Climb until a sibling is found; `last` follows the cursor up.
+            let mut last = index;
+            while !cursor.goto_next_sibling() {
+                if !cursor.goto_parent() {
+                    return table;
+                }
+                last = table.parent[last as usize];
+            }
+            previous = last;
+            parent = table.parent[last as usize];
+        }
+    }
+
+    pub fn len(&self) -> usize {
+        self.symbol.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.symbol.is_empty()
+    }
+
+    /// The children of `node`, in order.
+    pub fn children(&self, node: u32) -> Children<'_> {
+        Children {
+            table: self,
+            next: self.first_child[node as usize],
+        }
+    }
+
+    /// Number of nodes in the subtree of `node`, itself included.
+    pub fn subtree_len(&self, node: u32) -> usize {
+        let mut n = node;
+        while n != NONE {
+            let sibling = self.next_sibling[n as usize];
+            if sibling != NONE {
+                return (sibling - node) as usize;
+            }
+            n = self.parent[n as usize];
+        }
+        self.len() - node as usize
+    }
+}
+
+/// Iterator over the children of a node; see [`NodeTable::children`].
+#[derive(Debug, Clone)]
+pub struct Children<'a> {
+    table: &'a NodeTable,
+    next: u32,
+}
+
+impl Iterator for Children<'_> {
+    type Item = u32;
+
+    fn next(&mut self) -> Option<u32> {
+        if self.next == NONE {
+            return None;
+        }
+        let node = self.next;
+        self.next = self.table.next_sibling[node as usize];
+        Some(node)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use tree_sitter::{Node, Parser};
+
+    // Checks `index` and its subtree against `node`; returns the next index.
+    fn check(table: &NodeTable, node: Node, index: u32) -> u32 {
+        let i = index as usize;
+        assert_eq!(table.symbol[i], node.kind_id());
+        assert_eq!(table.start_byte[i] as usize, node.start_byte());
+        assert_eq!(table.end_byte[i] as usize, node.end_byte());
+        assert_eq!(table.subtree_len(index), node.descendant_count());
+
+        let mut next = index + 1;
+        let mut cursor = node.walk();
+        let children: Vec<u32> = table.children(index).collect();
+        assert_eq!(children.len(), node.child_count());
+        for (child, &expected) in node.children(&mut cursor).zip(&children) {
+            assert_eq!(expected, next);
+            assert_eq!(table.parent[next as usize], index);
+            next = check(table, child, next);
+        }
+        next
+    }
+
+    #[test]
+    fn table_matches_the_tree() {
+        let mut parser = Parser::new();
+        parser.set_language(&crate::LANGUAGE.into()).unwrap();
+        let source = "globals\n    integer a = 1 // one\nendglobals\nfunction f takes nothing returns nothing\n    call g(a, 'hfoo')\nendfunction\n";
+        let tree = parser.parse(source, None).unwrap();
+
+        let table = NodeTable::from_tree(&tree);
+        assert_eq!(table.len(), tree.root_node().descendant_count());
+        assert_eq!(table.parent[0], NONE);
+        assert_eq!(check(&table, tree.root_node(), 0) as usize, table.len());
+    }
+}
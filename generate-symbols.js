@@ -0,0 +1,405 @@
+// Public node kind and field ids for every binding.
+//
+//   node generate-symbols.js [--check]
+//
+// tree-sitter keeps the symbol and field enums of src/parser.c private, so
+// this reads them from there and writes them out as:
+//
+//   bindings/c/tree_sitter/tree-sitter-vjass-symbols.h   TSVjassSymbol, TSVjassField,
+//                                                         TREE_SITTER_VJASS_SYMBOL_LIST,
+//                                                         TREE_SITTER_VJASS_GRAMMAR_HASH
+//   bindings/rust/lib.rs                                  Symbol, Field (#[repr(u16)]),
+//                                                         GRAMMAR_HASH
+//   bindings/node/index.js, index.d.ts                    symbols, fields (frozen)
+//   bindings/python/tree_sitter_vjass/__init__.py, .pyi   Symbol, Field (IntEnum)
+//
+// Only named, visible kinds get a constant, with the id that
+// ts_language_symbol_for_name() returns for them, which is the one
+// ts_node_symbol() reports. Every named type and field in
+// src/node-types.json must be among them. In the files that are not
+// generated whole, only the lines between the BEGIN/END markers are
+// replaced.
+//
+// The grammar hash covers src/parser.c and src/scanner.c; the parse caches
+// seed their keys with it, so entries written by another build of the
+// tables or the scanner are never read back.
+//
+// Run by generate.sh after `tree-sitter generate`. With --check nothing is
+// written; the run fails if any output is out of date. --check also runs
+// `tree-sitter generate` on grammar.js into a temporary directory and fails
+// if src/ or src/outline differ from it, so ids read from stale tables do
+// not pass; it needs the CLI on PATH and fails without it.
+
+"use strict";
+
+const { spawnSync } = require("node:child_process");
+const crypto = require("node:crypto");
+const fs = require("node:fs");
+const os = require("node:os");
+const path = require("node:path");
+
+const ROOT = __dirname;
+const BEGIN = "BEGIN generate-symbols.js";
+const END = "END generate-symbols.js";
+const NOTICE = "Generated by generate-symbols.js from src/parser.c; do not edit.";
+
+function fail(message) {
+  console.error(`generate-symbols.js: ${message}`);
+  process.exit(1);
+}
+
+function block(source, start) {
+  const begin = source.indexOf(start);
+  if (begin < 0) fail(`src/parser.c has no \`${start}\``);
+  return source.slice(begin, source.indexOf("\n};", begin));
+}
+
+// ident -> value of a C enum.
+function enumValues(source, name) {
+  const values = new Map();
+  for (const [, ident, value] of block(source, `enum ${name} {`).matchAll(/^\s+(\w+) = (\d+),$/gm)) {
+    values.set(ident, Number(value));
+  }
+  return values;
+}
+
+// [ident] = "string" entries of a name table.
+function names(source, start, ids) {
+  const result = new Map();
+  for (const [, ident, name] of block(source, start).matchAll(/^\s+\[(\w+)\] = ("(?:[^"\\]|\\.)*"),$/gm)) {
+    result.set(ids(ident), JSON.parse(name));
+  }
+  return result;
+}
+
+function readParser() {
+  const file = path.join(ROOT, "src", "parser.c");
+  if (!fs.existsSync(file)) fail("src/parser.c is missing; run `tree-sitter generate` first");
+  const source = fs.readFileSync(file, "utf8");
+  const symbolIds = enumValues(source, "ts_symbol_identifiers");
+  symbolIds.set("ts_builtin_sym_end", 0);
+  const symbolId = (ident) => {
+    if (!symbolIds.has(ident)) fail(`unknown symbol ${ident} in src/parser.c`);
+    return symbolIds.get(ident);
+  };
+
+  const symbolNames = names(source, "static const char * const ts_symbol_names[]", symbolId);
+  const publicSymbol = new Map();
+  for (const [, ident, target] of block(source, "static const TSSymbol ts_symbol_map[]").matchAll(
+    /^\s+\[(\w+)\] = (\w+),$/gm,
+  )) {
+    publicSymbol.set(symbolId(ident), symbolId(target));
+  }
+  const metadata = new Map();
+  for (const [, ident, body] of block(source, "static const TSSymbolMetadata ts_symbol_metadata[]").matchAll(
+    /^\s+\[(\w+)\] = \{([^}]*)\}/gm,
+  )) {
+    metadata.set(symbolId(ident), { visible: /\.visible = true/.test(body), named: /\.named = true/.test(body) });
+  }
+
+  // What ts_language_symbol_for_name(name, true) finds: the first visible,
+  // named symbol of that name, mapped to its public symbol.
+  const symbols = new Map();
+  for (const id of [...symbolNames.keys()].sort((a, b) => a - b)) {
+    const name = symbolNames.get(id);
+    const { visible, named } = metadata.get(id) || {};
+    if (visible && named && !symbols.has(name)) symbols.set(name, publicSymbol.get(id) ?? id);
+  }
+
+  const fields = new Map();
+  if (source.includes("enum ts_field_identifiers {")) {
+    const fieldIds = enumValues(source, "ts_field_identifiers");
+    for (const [id, name] of names(source, "static const char * const ts_field_names[]", (ident) => fieldIds.get(ident))) {
+      if (id !== undefined) fields.set(name, id);
+    }
+  }
+
+  const byId = (map) => [...map].sort((a, b) => a[1] - b[1] || (a[0] < b[0] ? -1 : 1));
+  return { symbols: byId(symbols), fields: byId(fields), hash: grammarHash() };
+}
+
+// The first 64 bits of the SHA-256 of the tables and the scanner, as 16 hex
+// digits; line endings do not count.
+function grammarHash() {
+  const hash = crypto.createHash("sha256");
+  for (const file of ["src/parser.c", "src/scanner.c"]) {
+    hash.update(fs.readFileSync(path.join(ROOT, file), "utf8").replace(/\r\n/g, "\n"));
+  }
+  return hash.digest("hex").slice(0, 16);
+}
+
+// Fails unless every named type and field of node-types.json has an id.
+function checkNodeTypes({ symbols, fields }) {
+  const symbolNames = new Set(symbols.map(([name]) => name));
+  const fieldNames = new Set(fields.map(([name]) => name));
+  const missing = [];
+  const type = ({ type, named }) => {
+    if (named && !type.startsWith("_") && !symbolNames.has(type)) missing.push(`node type ${type}`);
+  };
+  for (const info of JSON.parse(fs.readFileSync(path.join(ROOT, "src", "node-types.json"), "utf8"))) {
+    type(info);
+    for (const subtype of info.subtypes || []) type(subtype);
+    for (const child of info.children ? info.children.types : []) type(child);
+    for (const [name, field] of Object.entries(info.fields || {})) {
+      if (!fieldNames.has(name)) missing.push(`field ${name}`);
+      for (const child of field.types) type(child);
+    }
+  }
+  if (missing.length > 0) {
+    fail(`src/node-types.json and src/parser.c disagree; no id for ${[...new Set(missing)].join(", ")}`);
+  }
+}
+
+// The constant names of one binding; two kinds must never share one.
+function identifiers(entries, convert, what) {
+  const seen = new Map();
+  return entries.map(([name, id]) => {
+    const ident = convert(name);
+    if (seen.has(ident)) fail(`${what}: ${seen.get(ident)} and ${name} both become ${ident}`);
+    seen.set(ident, name);
+    return [ident, name, id];
+  });
+}
+
+// `struct` and the keyword `struct_` stay apart by their trailing underscores.
+const upper = (name) => name.toUpperCase().replace(/[^A-Z0-9_]/g, "_");
+const camel = (name) => {
+  const trailing = name.match(/_*$/)[0];
+  return (
+    name
+      .slice(0, name.length - trailing.length)
+      .split(/[^A-Za-z0-9]+/)
+      .filter(Boolean)
+      .map((part) => part[0].toUpperCase() + part.slice(1))
+      .join("") + trailing
+  );
+};
+const jsKey = (name) => (/^[A-Za-z_$][\w$]*$/.test(name) ? name : JSON.stringify(name));
+
+function cHeader({ symbols, fields, hash }) {
+  const lines = [
+    "#ifndef TREE_SITTER_VJASS_SYMBOLS_H_",
+    "#define TREE_SITTER_VJASS_SYMBOLS_H_",
+    "",
+    `// ${NOTICE}`,
+    "//",
+    "// Kind ids of the named node types of tree_sitter_vjass(), as returned by",
+    "// ts_node_symbol(), and its field ids, as returned by",
+    "// ts_tree_cursor_current_field_id(). Switch on these instead of comparing",
+    "// ts_node_type() strings. They change whenever src/parser.c is",
+    "// regenerated, so compare them only against trees of the same build. The",
+    "// outline language has ids of its own.",
+    "",
+    "typedef enum {",
+    ...identifiers(symbols, (name) => `TREE_SITTER_VJASS_SYM_${upper(name)}`, "C symbols").map(
+      ([ident, , id]) => `  ${ident} = ${id},`,
+    ),
+    "} TSVjassSymbol;",
+    "",
+    "typedef enum {",
+    ...identifiers(fields, (name) => `TREE_SITTER_VJASS_FIELD_${upper(name)}`, "C fields").map(
+      ([ident, , id]) => `  ${ident} = ${id},`,
+    ),
+    "} TSVjassField;",
+    "",
+    "// X(NAME, name) for every symbol above, NAME as in",
+    "// TREE_SITTER_VJASS_SYM_NAME and name its lower-case form; the C++",
+    "// visitor in tree-sitter-vjass.hpp builds its hooks from this.",
+    "#define TREE_SITTER_VJASS_SYMBOL_LIST(X) \\",
+    ...symbols.map(([name], i) => `  X(${upper(name)}, ${upper(name).toLowerCase()})${i + 1 < symbols.length ? " \\" : ""}`),
+    "",
+    "// Identifies src/parser.c and src/scanner.c; tree-sitter-vjass-cache.h",
+    "// seeds its keys with it.",
+    `#define TREE_SITTER_VJASS_GRAMMAR_HASH 0x${hash}ull`,
+    "",
+    "#endif // TREE_SITTER_VJASS_SYMBOLS_H_",
+    "",
+  ];
+  return lines.join("\n");
+}
+
+// `ALL` the way rustfmt lays it out: on one line while the array is short.
+function all(type, variants) {
+  const items = variants.map(([ident]) => `${type}::${ident}`);
+  const array = `&[${items.join(", ")}]`;
+  if (array.length <= 60) return [`    pub const ALL: &[${type}] = ${array};`];
+  return [`    pub const ALL: &[${type}] = &[`, ...items.map((item) => `        ${item},`), "    ];"];
+}
+
+function rustEnum(entries, type, doc) {
+  const variants = identifiers(entries, camel, `Rust ${type}`);
+  return [
+    ...doc.map((line) => `/// ${line}`),
+    "#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]",
+    "#[repr(u16)]",
+    `pub enum ${type} {`,
+    ...variants.map(([ident, , id]) => `    ${ident} = ${id},`),
+    "}",
+    "",
+    `impl ${type} {`,
+    "    /// Every constant, in id order.",
+    ...all(type, variants),
+    "",
+    "    /// The constant with this id, if it has one.",
+    "    pub const fn from_id(id: u16) -> Option<Self> {",
+    "        match id {",
+    ...variants.map(([ident, , id]) => `            ${id} => Some(${type}::${ident}),`),
+    "            _ => None,",
+    "        }",
+    "    }",
+    "",
+    "    /// The name, as in `node-types.json`.",
+    "    pub const fn name(self) -> &'static str {",
+    "        match self {",
+    ...variants.map(([ident, name]) => `            ${type}::${ident} => ${JSON.stringify(name)},`),
+    "        }",
+    "    }",
+    "}",
+  ];
+}
+
+function rust(tables) {
+  return [
+    `// ${NOTICE}`,
+    "",
+    ...rustEnum(tables.symbols, "Symbol", [
+      "Kind ids of the named node types, as returned by `Node::kind_id()` for",
+      "[`LANGUAGE`]. They change whenever `src/parser.c` is regenerated.",
+    ]),
+    "",
+    ...rustEnum(tables.fields, "Field", ["Field ids, as returned by `TreeCursor::field_id()` for [`LANGUAGE`]."]),
+    "",
+    "/// Identifies `src/parser.c` and `src/scanner.c`; the parse cache seeds its",
+    "/// keys with it.",
+    `pub const GRAMMAR_HASH: u64 = 0x${tables.hash.match(/.{4}/g).join("_")};`,
+  ];
+}
+
+function javascript({ symbols, fields }) {
+  const object = (entries) => entries.map(([name, id]) => `  ${jsKey(name)}: ${id},`);
+  return [
+    `// ${NOTICE}`,
+    "",
+    "/** Kind ids of the named node types, as in `Node.typeId` and `NodeTable.symbol`. */",
+    "module.exports.symbols = Object.freeze({",
+    ...object(symbols),
+    "});",
+    "",
+    "/** Field ids, as in `TreeCursor.currentFieldId`. */",
+    "module.exports.fields = Object.freeze({",
+    ...object(fields),
+    "});",
+  ];
+}
+
+function typescript({ symbols, fields }) {
+  const object = (entries) => entries.map(([name, id]) => `  readonly ${jsKey(name)}: ${id};`);
+  return [
+    `// ${NOTICE}`,
+    "type Symbols = {",
+    ...object(symbols),
+    "};",
+    "type Fields = {",
+    ...object(fields),
+    "};",
+  ];
+}
+
+function python({ symbols, fields }, stub) {
+  const members = (entries, type) =>
+    identifiers(entries, upper, `Python ${type}`).map(([ident, , id]) => `    ${ident} = ${stub ? "..." : id}`);
+  // Stubs separate definitions by one blank line, modules by two.
+  const gap = stub ? [""] : ["", ""];
+  return [
+    `# ${NOTICE}`,
+    ...gap,
+    "class Symbol(IntEnum):",
+    ...(stub ? [] : ['    """Kind ids of the named node types, as in ``Node.kind_id``."""', ""]),
+    ...members(symbols, "Symbol"),
+    ...gap,
+    "class Field(IntEnum):",
+    ...(stub ? [] : ['    """Field ids, as in ``TreeCursor.field_id``."""', ""]),
+    ...members(fields, "Field"),
+  ];
+}
+
+// Number of generated files in src/ and src/outline that differ from what
+// `tree-sitter generate` makes of grammar.js now.
+function checkGenerated() {
+  const languages = [
+    ["src", ""],
+    ["src/outline", "1"],
+  ];
+  const temp = fs.mkdtempSync(path.join(os.tmpdir(), "vjass-generate-"));
+  try {
+    let stale = 0;
+    for (const [dir, outline] of languages) {
+      const output = path.join(temp, dir);
+      const result = spawnSync("tree-sitter", ["generate", "grammar.js", "-o", output], {
+        cwd: ROOT,
+        env: { ...process.env, TREE_SITTER_VJASS_OUTLINE: outline },
+        stdio: ["ignore", "ignore", "inherit"],
+      });
+      if (result.error && result.error.code === "ENOENT") {
+        fail("--check needs the tree-sitter CLI (0.25 or later) on PATH to compare src/ with a fresh generate");
+      }
+      if (result.status !== 0) fail(`tree-sitter generate failed for ${dir}`);
+      for (const file of ["parser.c", "grammar.json", "node-types.json"]) {
+        const read = (root) => fs.readFileSync(path.join(root, file), "utf8").replace(/\r\n/g, "\n");
+        if (read(path.join(ROOT, dir)) !== read(output)) {
+          console.error(`generate-symbols.js: ${dir}/${file} is out of date; run generate.sh`);
+          stale++;
+        }
+      }
+    }
+    return stale;
+  } finally {
+    fs.rmSync(temp, { recursive: true, force: true });
+  }
+}
+
+// Replaces the lines between the markers of `file` with `lines`.
+function splice(file, lines) {
+  const source = fs.readFileSync(path.join(ROOT, file), "utf8");
+  const begin = source.indexOf(BEGIN);
+  const end = source.indexOf(END, begin);
+  if (begin < 0 || end < 0) fail(`${file} has no ${BEGIN} / ${END} markers`);
+  const from = source.indexOf("\n", begin) + 1;
+  const to = source.lastIndexOf("\n", end) + 1;
+  return source.slice(0, from) + lines.map((line) => `${line}\n`).join("") + source.slice(to);
+}
+
+function main() {
+  const check = process.argv[2] === "--check";
+  if (process.argv.length > (check ? 3 : 2)) {
+    console.error("usage: node generate-symbols.js [--check]");
+    process.exit(2);
+  }
+
+  const tables = readParser();
+  checkNodeTypes(tables);
+  const outputs = [
+    ["bindings/c/tree_sitter/tree-sitter-vjass-symbols.h", cHeader(tables)],
+    ["bindings/rust/lib.rs", splice("bindings/rust/lib.rs", rust(tables))],
+    ["bindings/node/index.js", splice("bindings/node/index.js", javascript(tables))],
+    ["bindings/node/index.d.ts", splice("bindings/node/index.d.ts", typescript(tables))],
+    ["bindings/python/tree_sitter_vjass/__init__.py", splice("bindings/python/tree_sitter_vjass/__init__.py", python(tables, false))],
+    ["bindings/python/tree_sitter_vjass/__init__.pyi", splice("bindings/python/tree_sitter_vjass/__init__.pyi", python(tables, true))],
+  ];
+
+  let stale = check ? checkGenerated() : 0;
+  for (const [file, content] of outputs) {
+    const target = path.join(ROOT, file);
+    const current = fs.existsSync(target) ? fs.readFileSync(target, "utf8") : null;
+    if (current === content) continue;
+    if (check) {
+      console.error(`generate-symbols.js: ${file} is out of date; run node generate-symbols.js`);
+      stale++;
+    } else {
+      fs.writeFileSync(target, content);
+    }
+  }
+  if (stale > 0) process.exit(1);
+}
+
+main();
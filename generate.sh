@@ -1,9 +1,20 @@
+# The tables in src/ and src/outline come only from here, with the
+# tree-sitter CLI 0.25 (ABI 15) on PATH.
+set -e
+
 tree-sitter generate
+# Public symbol and field ids for the bindings, from the generated src/parser.c
+node generate-symbols.js
+# The outline language (tree_sitter_vjass_outline) from the same grammar.js
+TREE_SITTER_VJASS_OUTLINE=1 tree-sitter generate grammar.js -o src/outline
 
 #tree-sitter playground
 
 # https://tree-sitter.github.io/tree-sitter/creating-parsers/5-writing-tests.html
-#tree-sitter test
+tree-sitter test
+test/outline.sh
+# Fails if src/, src/outline or the ids differ from a fresh generate
+node generate-symbols.js --check
 #tree-sitter parse vjass/test.vjass
 
 tree-sitter build --wasm
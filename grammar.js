@@ -1,25 +1,31 @@
 const PREC = {
-    COMMA: -1,
-    FUNCTION: 1,
     DEFAULT: 1,
     PRIORITY: 2,
 
-    BIT_OR: 6, // => |
-    BIT_NOT: 7, // => ~
-    BIT_AND: 8, // => &
-    SHIFT: 9, // => << >>
-    CONCAT: 10, // => ..
-    PLUS: 11, // => + -
-    MULTI: 12, // => * /             // %
-    UNARY: 13, // => not # - ~
-    POWER: 14, // => ^
-
-    STATEMENT: 15,
-    PROGRAM: 16,
+    // JASS operator precedence, loosest first
+    OR: 3, // => or
+    AND: 4, // => and
+    NOT: 5, // => not
+    COMPARE: 6, // => == != < > <= >=
+    PLUS: 7, // => + -
+    MULTI: 8, // => * /
+    UNARY: 9, // => - +
+    CALL: 10, // => f() a[] a.b
 }
 
+// `a, b, c` as siblings of one node. tree-sitter keeps the hidden repeat
+// nodes balanced, so a list of n entries is O(log n) deep instead of the
+// O(n) chain a binary `x ',' x` rule produces.
+const commaSep1 = rule => seq(rule, repeat(seq(',', rule)))
+
+// With TREE_SITTER_VJASS_OUTLINE=1 this file describes the outline language
+// (tree_sitter_vjass_outline, generated into src/outline; see generate.sh):
+// the same tree for declarations, but every function body is a single
+// opaque `function_body` token that the scanner skips up to `endfunction`.
+const OUTLINE = process.env.TREE_SITTER_VJASS_OUTLINE === '1'
+
 module.exports = grammar({
-    name: 'vjass',
+    name: OUTLINE ? 'vjass_outline' : 'vjass',
 
     externals: $ => [
         $._block_comment_start,
@@ -29,50 +35,62 @@ module.exports = grammar({
         $._string_start,
         $._string_content,
         $._string_end,
+
+        ...OUTLINE ? [$._function_body] : [],
     ],
     extras: $ => [/\n/, /\s/, $.comment],
 
     inline: $ => [
-        //$.expr,
-        //$.field_separator,
-        //$.prefix_exp,
-        //$.function_impl,
         $.comment,
     ],
 
-    conflicts: $ => [
-        [$.id, $.keywords]
-    ],
+    // Identifiers are lexed once; keywords are then recognized from the
+    // identifier text by the separate keyword lexer.
+    word: $ => $.id,
 
     rules: {
         program: $ => repeat($._block),
 
-        id: _ => token(prec(-1, /[a-zA-Z_][a-zA-Z0-9_]*/)),
-        keywords: _ => choice('struct', 'endstruct', 'globals', 'endglobals', 'loop', 'endloop'),
+        id: _ => /[a-zA-Z_][a-zA-Z0-9_]*/,
 
+        // Every statement starts with a keyword or with `type name`, so the
+        // parser always knows which one it is in after at most two tokens.
+        // Expressions never stand alone: they only follow `set`, `call`,
+        // `return`, `exitwhen`, `if`, `=` or `(`.
         _block: $ => choice(
             $.globals,
             $.struct,
+            $.function,
+            $._statement,
+        ),
+
+        _statement: $ => choice(
+            $.var_stmt,
+            $.set_statement,
+            $.call_statement,
+            $.return_statement,
+            $.exitwhen_statement,
+            $.if_statement,
             $.loop,
-            $.expr,
         ),
 
         struct: $ => seq(
-            alias(token('struct'), $.struct_),
+            alias('struct', $.struct_),
+            field('name', $.id),
             repeat($._block),
-            alias(token('endstruct'), $.endstruct_)
+            alias('endstruct', $.endstruct_)
         ),
 
         globals: $ => seq(
-            alias(token('globals'), $.globals_),
+            alias('globals', $.globals_),
             repeat($._block),
-            alias(token('endglobals'), $.endglobals_)
+            alias('endglobals', $.endglobals_)
         ),
 
         loop: $ => seq(
-            alias(token('loop'), $.loop_),
+            alias('loop', $.loop_),
             repeat($._block),
-            alias(token('endloop'), $.endloop_)
+            alias('endloop', $.endloop_)
         ),
 
         expr: $ => choice(
@@ -80,98 +98,42 @@ module.exports = grammar({
             $.number,
             $.float,
             $.string,
+            $.rawcode,
+            $.function_call,
+
+            seq('(', $.expr, ')'),
+
+            prec.left(PREC.CALL, seq($.expr, '.', $.id)), // member
+            prec.left(PREC.CALL, seq($.expr, '[', $.expr, ']')), // array index
+
+            prec(PREC.UNARY, seq('-', $.expr)),
+            prec(PREC.UNARY, seq('+', $.expr)),
 
-            // https://learn.microsoft.com/en-us/cpp/cpp/cpp-built-in-operators-precedence-and-associativity?view=msvc-170
-            // Group 1 precedence, no associativity
-            // Scope resolution	::
-
-            // Group 2 precedence, left to right associativity
-            prec.left(2, seq($.expr, '.', $.expr)), // Member selection (object or pointer)	. or ->
-            prec.left(2, seq('[', $.expr, ']')), // Array subscript	[]
-            prec.left(2, seq('(', repeat($.expr), ')')), // Function call	()
-            prec.left(2, seq($.expr, '++')), // Postfix increment	++
-            prec.left(2, seq($.expr, '++')), // Postfix decrement	--
-            // Type name	typeid
-            // Constant type conversion	const_cast
-            // Dynamic type conversion	dynamic_cast
-            // Reinterpreted type conversion	reinterpret_cast
-            // Static type conversion	static_cast
-
-            // Group 3 precedence, right to left associativity
-            // Size of object or type	sizeof
-            prec.right(3, seq('++', $.expr)), // Prefix increment	++
-            prec.right(3, seq('--', $.expr)),  // Prefix decrement	--
-            // One's complement	~	compl
-            prec.right(3, seq('not', $.expr)), // Logical not	!	not
-            prec.right(3, seq('-', $.expr)),  // Unary negation	-
-            prec.right(3, seq('+', $.expr)), // Unary plus	+
-            // Address-of	&
-            // Indirection	*
-            // Create object	new
-            // Destroy object	delete
-            // Cast	()
-
-            // Group 4 precedence, left to right associativity
-            // Pointer-to-member (objects or pointers)	.* or ->*
-
-            // Group 5 precedence, left to right associativity
-            prec.left(5, seq($.expr, '*', $.expr)), // Multiplication	*
-            prec.left(5, seq($.expr, '/', $.expr)), // Division	/
-            // Modulus	%
-
-            // Group 6 precedence, left to right associativity
-            prec.left(6, seq($.expr, '+', $.expr)), // Addition	+
-            prec.left(6, seq($.expr, '-', $.expr)), // Subtraction	-
-
-            // Group 7 precedence, left to right associativity
-            // Left shift	<<
-            // Right shift	>>
-
-            // Group 8 precedence, left to right associativity
-            prec.left(8, seq($.expr, '<', $.expr)), // Less than	<
-            prec.left(8, seq($.expr, '>', $.expr)), // Greater than	>
-            prec.left(8, seq($.expr, '<=', $.expr)), // Less than or equal to	<=
-            prec.left(8, seq($.expr, '>=', $.expr)), // Greater than or equal to	>=
-
-            // Group 9 precedence, left to right associativity
-            prec.left(9, seq($.expr, '==', $.expr)), // Equality	==
-            prec.left(9, seq($.expr, '!=', $.expr)), // Inequality	!=	not_eq
-
-            // Group 10 precedence left to right associativity
-            // Bitwise AND	&	bitand
-
-            // Group 11 precedence, left to right associativity
-            // Bitwise exclusive OR	^	xor
-
-            // Group 12 precedence, left to right associativity
-            // Bitwise inclusive OR	|	bitor
-
-            // Group 13 precedence, left to right associativity
-            prec.left(14 /* in JASS */, seq($.expr, 'and', $.expr)), // Logical AND	&&	and
-
-            // Group 14 precedence, left to right associativity
-            prec.left(13 /* in JASS */, seq($.expr, 'or', $.expr)), // Logical OR	||	or
-
-            // Group 15 precedence, right to left associativity
-            // Conditional	? :
-            prec.right(15, seq($.expr, '=', $.expr)), // Assignment	=
-            // Multiplication assignment	*=
-            // Division assignment	/=
-            // Modulus assignment	%=
-            // Addition assignment	+=
-            // Subtraction assignment	-=
-            // Left-shift assignment	<<=
-            // Right-shift assignment	>>=
-            // Bitwise AND assignment	&=	and_eq
-            // Bitwise inclusive OR assignment	|=	or_eq
-            // Bitwise exclusive OR assignment	^=	xor_eq
-            // throw expression	throw
-
-            // Group 16 precedence, left to right associativity
-            prec.left(16, seq($.expr, ',', $.expr)), // Comma
+            prec.left(PREC.MULTI, seq($.expr, '*', $.expr)),
+            prec.left(PREC.MULTI, seq($.expr, '/', $.expr)),
 
+            prec.left(PREC.PLUS, seq($.expr, '+', $.expr)),
+            prec.left(PREC.PLUS, seq($.expr, '-', $.expr)),
+
+            prec.left(PREC.COMPARE, seq($.expr, '==', $.expr)),
+            prec.left(PREC.COMPARE, seq($.expr, '!=', $.expr)),
+            prec.left(PREC.COMPARE, seq($.expr, '<', $.expr)),
+            prec.left(PREC.COMPARE, seq($.expr, '>', $.expr)),
+            prec.left(PREC.COMPARE, seq($.expr, '<=', $.expr)),
+            prec.left(PREC.COMPARE, seq($.expr, '>=', $.expr)),
+
+            // `not a == b` is `not (a == b)` in JASS
+            prec(PREC.NOT, seq('not', $.expr)),
+
+            prec.left(PREC.AND, seq($.expr, 'and', $.expr)),
+            prec.left(PREC.OR, seq($.expr, 'or', $.expr)),
         ),
 
+        // Object ids such as 'A000' or 'hfoo', and single characters like 'a':
+        // one leaf from the main lexer instead of a start/content/end string.
+        // The external scanner declines a `'` that opens one of these.
+        rawcode: _ => token(choice(/'[^'\\\r\n]'/, /'[^'\\\r\n]{4}'/)),
+
         number: _ => {
             const separator = '_'
             const decimal = /[0-9]+/
@@ -206,6 +168,7 @@ module.exports = grammar({
             ))
         },
 
+
         var_stmt: $ =>
             prec.right(
                 PREC.DEFAULT,
@@ -214,33 +177,19 @@ module.exports = grammar({
                         choice(
                             alias('local', $.local),
                             alias('constant', $.constant),
-                            alias('array', $.array),
                         )
                     ),
                     field('type', $.id),
-                    $.var_decl,
-                    repeat(seq(',', $.var_decl))
+                    optional(alias('array', $.array)),
+                    commaSep1($.var_decl)
                 )
             ),
 
         var_decl: $ => seq(
             field('name', $.id),
-            optional(seq('=', $.expr)
-            )
+            optional(seq('=', field('value', $.expr)))
         ),
 
-        _var: $ =>
-            prec(
-                PREC.PRIORITY,
-                choice(
-                    $.id,
-                    seq($.prefix_exp, '[', $.expr, ']'),
-                    seq($.prefix_exp, '.', $.id)
-                )
-            ),
-
-        var_list: $ => seq($._var, repeat(seq(',', $._var))),
-
         string: $ =>
             seq(
                 field('start', alias($._string_start, 'string_start')),
@@ -248,156 +197,81 @@ module.exports = grammar({
                 field('end', alias($._string_end, 'string_end'))
             ),
 
-        _statement: $ =>
-            prec.right(
-                PREC.STATEMENT,
-                seq(
-                    choice(
-                        $.var_stmt,
-                        $.function_call,
-                        $.do_statement,
-                        $.while_statement,
-                        $.repeat_statement,
-                        $.if_statement,
-                        $.function_statement
-                        // $.comment
-                    ),
-                )
-            ),
-
-        // Primitives {{{
-        function_name: $ => seq($.id),
-
-        function: $ => seq($.function_start, $.function_impl),
-
-        function_impl: $ =>
-            seq(
-                alias('(', $.function_body_paren),
-                optional($.parameter_list),
-                alias(')', $.function_body_paren),
-                alias(optional($._block), $.function_body),
-                alias('end', $.function_end)
-            ),
-
-        parameter_list: $ =>
-            choice(
-                seq(
-                    prec.left(PREC.COMMA, seq($.id, repeat(seq(/,\s*/, $.id)))),
-                ),
-            ),
-        // }}}
-
-        unary_operation: $ =>
-            prec.left(PREC.UNARY, seq(choice('not', '#', '-', '~'), $.expr)),
+        // Statements {{{
+        set_statement: $ => seq(
+            alias('set', $.set_),
+            field('name', $.expr),
+            '=',
+            field('value', $.expr)
+        ),
 
-        _id_list: $ =>
-            prec.right(PREC.COMMA, seq($.id, repeat(seq(/,\s*/, $.id)))),
+        call_statement: $ => seq(
+            alias('call', $.call_),
+            $.function_call
+        ),
 
+        // `return` followed by an identifier on the next line is read as
+        // `return <expr>`; a bare `return` is only ever the last statement.
         return_statement: $ =>
-            prec(PREC.PRIORITY, seq('return', optional(seq($.expr, repeat(seq(',', $.expr)))))),
-
-        break_statement: _ => 'break',
-
-        // Blocks {{{
-        do_statement: $ =>
-            seq(alias('do', $.do_start), optional($._block), alias('end', $.do_end)),
-
-        while_statement: $ =>
-            seq(
-                alias('while', $.while_start),
-                $.expr,
-                alias('do', $.while_do),
-                optional($._block),
-                alias('end', $.while_end)
-            ),
+            prec.right(seq(alias('return', $.return_), optional($.expr))),
 
-        repeat_statement: $ =>
-            seq(
-                alias('repeat', $.repeat_start),
-                optional($._block),
-                alias('until', $.repeat_until),
-                $.expr
-            ),
+        exitwhen_statement: $ => seq(
+            alias('exitwhen', $.exitwhen_),
+            $.expr
+        ),
 
         if_statement: $ =>
             seq(
-                alias('if', $.if_start),
-                $.expr,
-                alias('then', $.if_then),
-                optional($._block),
+                alias('if', $.if_),
+                field('condition', $.expr),
+                alias('then', $.then_),
+                repeat($._block),
                 repeat(
                     seq(
-                        alias('elseif', $.if_elseif),
-                        $.expr,
-                        alias('then', $.if_then),
-                        optional($._block)
+                        alias('elseif', $.elseif_),
+                        field('condition', $.expr),
+                        alias('then', $.then_),
+                        repeat($._block)
                     )
                 ),
-                optional(seq(alias('else', $.if_else), optional($._block))),
-                alias('end', $.if_end)
+                optional(seq(alias('else', $.else_), repeat($._block))),
+                alias('endif', $.endif_)
             ),
-
-        function_start: () => 'function',
-
-        function_statement: $ =>
-            prec.right(
-                PREC.DEFAULT,
-                seq(
-                    choice(
-                        seq(
-                            alias('local', $.local),
-                            $.function_start,
-                            field('name', $.id)
-                        ),
-                        seq($.function_start, /\s*/, field('name', $.function_name))
-                    ),
-                    $.function_impl
-                )
-            ),
-
         // }}}
 
         // Function {{{
-        _prefix_exp: $ =>
-            choice(
-                $._var,
-                $.function_call,
-                seq('(', $.expr, ')')
-            ),
-
-        prefix_exp: $ => $._prefix_exp,
+        function: $ => seq(
+            optional(alias('constant', $.constant)),
+            alias('function', $.function_),
+            field('name', $.id),
+            alias('takes', $.takes_),
+            choice(alias('nothing', $.nothing), $.parameter_list),
+            alias('returns', $.returns_),
+            field('returns', choice(alias('nothing', $.nothing), $.id)),
+            OUTLINE
+                ? optional(field('body', alias($._function_body, $.function_body)))
+                : repeat($._block),
+            alias('endfunction', $.endfunction_)
+        ),
 
-        function_call: $ =>
-            prec.right(
-                PREC.FUNCTION,
-                seq(field('prefix', $.prefix_exp), choice($._args, $._self_call))
-            ),
+        parameter_list: $ => commaSep1($.parameter),
 
-        _args: $ => choice($._parentheses_call, $._string_call),
+        parameter: $ => seq(field('type', $.id), field('name', $.id)),
 
-        _parentheses_call: $ =>
-            seq(
-                alias('(', $.function_call_paren),
-                field('args', optional($.function_arguments)),
-                alias(')', $.function_call_paren)
-            ),
-
-        _string_call: $ =>
-            field(
-                'args',
-                //  Decide if this is really the name we want to use.
-                alias($.string, $.string_argument)
+        function_call: $ =>
+            prec(
+                PREC.CALL,
+                seq(
+                    field('prefix', $.expr),
+                    alias('(', $.function_call_paren),
+                    field('args', optional($.function_arguments)),
+                    alias(')', $.function_call_paren)
+                )
             ),
 
-        _self_call: $ =>
-            seq(alias(':', $.self_call_colon), $.id, $._args),
-
-        function_arguments: $ =>
-            seq($.expr, optional(repeat(seq(',', $.expr)))),
-
+        function_arguments: $ => commaSep1($.expr),
         // }}}
 
-
         // Comments {{{
         // comment: ($) => choice(seq("--", /[^-].*\r?\n/), $._multi_comment),
         comment: $ =>
@@ -406,12 +280,11 @@ module.exports = grammar({
                     field('start', alias('//', 'comment_start')),
                     field('content', alias(/[^\r\n]*/, 'comment_content'))
                 ),
+                // `--[[ ]]` and `/* */`; the scanner returns `/* */` content
+                // one line at a time.
                 seq(
                     field('start', alias($._block_comment_start, 'comment_start')),
-                    field(
-                        'content',
-                        optional(alias($._block_comment_content, 'comment_content'))
-                    ),
+                    repeat(field('content', alias($._block_comment_content, 'comment_content'))),
                     field('end', alias($._block_comment_end, 'comment_end'))
                 )
             ),
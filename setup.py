@@ -0,0 +1,126 @@
+from os import getenv, path
+from platform import system
+from sysconfig import get_config_var
+
+from setuptools import Extension, find_packages, setup
+from setuptools.command.build import build
+from setuptools.command.egg_info import egg_info
+from setuptools.command.sdist import sdist
+
+# Where an sdist carries its copy of the runtime sources.
+VENDORED_LIB = path.join("vendor", "tree-sitter", "lib")
+
+
+def runtime_lib():
+    """The `lib` directory of the tree-sitter runtime sources.
+
+    TREE_SITTER_LIB names it explicitly; an sdist has the copy it was built
+    with in vendor/; in a checkout the copy vendored by the npm `tree-sitter`
+    package (the one binding.gyp uses) is taken.
+    """
+    candidates = [
+        getenv("TREE_SITTER_LIB"),
+        VENDORED_LIB,
+        path.join("node_modules", "tree-sitter", "vendor", "tree-sitter", "lib"),
+    ]
+    for lib in candidates:
+        if lib and path.isfile(path.join(lib, "src", "lib.c")):
+            return lib
+    raise SystemExit(
+        "tree-sitter-vjass: the tree-sitter runtime sources were not found; "
+        "set TREE_SITTER_LIB to the lib directory of a tree-sitter checkout "
+        "or run `npm install` first"
+    )
+
+
+# The extension links its own copy of the runtime for alloc_stats(),
+# parse_many() and NodeTable.
+lib = runtime_lib()
+
+sources = [
+    "bindings/python/tree_sitter_vjass/binding.c",
+    "src/parser.c",
+    path.join(lib, "src", "lib.c"),
+]
+if path.exists("src/scanner.c"):
+    sources.append("src/scanner.c")
+
+macros: list[tuple[str, str | None]] = [
+    ("PY_SSIZE_T_CLEAN", None),
+    ("TREE_SITTER_HIDE_SYMBOLS", None),
+    ("TREE_SITTER_VJASS_RUNTIME", None),
+    ("_POSIX_C_SOURCE", "200809L"),
+    ("_DEFAULT_SOURCE", None),
+]
+
+# Free-threaded builds (Py_GIL_DISABLED) have no limited API; everywhere else
+# the extension targets 3.11, the first limited API with Py_buffer.
+if limited_api := not get_config_var("Py_GIL_DISABLED"):
+    macros.append(("Py_LIMITED_API", "0x030B0000"))
+
+if system() != "Windows":
+    cflags = ["-std=c11", "-fvisibility=hidden"]
+else:
+    cflags = ["/std:c11", "/utf-8"]
+
+
+class Build(build):
+    def run(self):
+        if path.isdir("queries"):
+            dest = path.join(self.build_lib, "tree_sitter_vjass", "queries")
+            self.copy_tree("queries", dest)
+        super().run()
+
+
+class EggInfo(egg_info):
+    def find_sources(self):
+        super().find_sources()
+        self.filelist.recursive_include("queries", "*.scm")
+        self.filelist.include("src/tree_sitter/*.h")
+        self.filelist.include("bindings/c/tree_sitter/*.h")
+
+
+class Sdist(sdist):
+    def make_release_tree(self, base_dir, files):
+        # The runtime is not part of this repository; ship the sources the
+        # sdist was built with so installing it needs neither npm nor
+        # TREE_SITTER_LIB.
+        super().make_release_tree(base_dir, files)
+        for part in ("include", "src"):
+            self.copy_tree(path.join(lib, part), path.join(base_dir, VENDORED_LIB, part))
+        license = path.join(lib, "..", "LICENSE")
+        if path.isfile(license):
+            self.copy_file(license, path.join(base_dir, VENDORED_LIB, "LICENSE"))
+
+
+setup(
+    packages=find_packages("bindings/python", exclude=["tests"]),
+    package_dir={"": "bindings/python"},
+    package_data={
+        "tree_sitter_vjass": ["*.pyi", "py.typed"],
+        "tree_sitter_vjass.queries": ["*.scm"],
+    },
+    ext_package="tree_sitter_vjass",
+    ext_modules=[
+        Extension(
+            name="_binding",
+            sources=sources,
+            extra_compile_args=cflags,
+            define_macros=macros,
+            include_dirs=[
+                "src",
+                "bindings/c",
+                path.join(lib, "include"),
+                path.join(lib, "src"),
+            ],
+            py_limited_api=limited_api,
+        )
+    ],
+    cmdclass={
+        "build": Build,
+        "egg_info": EggInfo,
+        "sdist": Sdist,
+    },
+    options={"bdist_wheel": {"py_limited_api": "cp311"}} if limited_api else {},
+    zip_safe=False,
+)
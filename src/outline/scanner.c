@@ -0,0 +1,12 @@
+// External scanner of the outline language: the full scanner plus the
+// opaque FUNCTION_BODY token, exported under tree_sitter_vjass_outline_*.
+
+#define TREE_SITTER_VJASS_OUTLINE
+
+#define tree_sitter_vjass_external_scanner_create tree_sitter_vjass_outline_external_scanner_create
+#define tree_sitter_vjass_external_scanner_destroy tree_sitter_vjass_outline_external_scanner_destroy
+#define tree_sitter_vjass_external_scanner_serialize tree_sitter_vjass_outline_external_scanner_serialize
+#define tree_sitter_vjass_external_scanner_deserialize tree_sitter_vjass_outline_external_scanner_deserialize
+#define tree_sitter_vjass_external_scanner_scan tree_sitter_vjass_outline_external_scanner_scan
+
+#include "../scanner.c"
@@ -1,10379 +0,0 @@
-/* Automatically generated by tree-sitter v0.25.3 */
-
-#include "tree_sitter/parser.h"
-
-#if defined(__GNUC__) || defined(__clang__)
-#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
-#endif
-
-#define LANGUAGE_VERSION 15
-#define STATE_COUNT 262
-#define LARGE_STATE_COUNT 82
-#define SYMBOL_COUNT 50
-#define ALIAS_COUNT 0
-#define TOKEN_COUNT 40
-#define EXTERNAL_TOKEN_COUNT 6
-#define FIELD_COUNT 3
-#define MAX_ALIAS_SEQUENCE_LENGTH 3
-#define MAX_RESERVED_WORD_SET_SIZE 0
-#define PRODUCTION_ID_COUNT 4
-#define SUPERTYPE_COUNT 0
-
-enum ts_symbol_identifiers {
-  sym_id = 1,
-  anon_sym_struct = 2,
-  anon_sym_endstruct = 3,
-  anon_sym_globals = 4,
-  anon_sym_endglobals = 5,
-  anon_sym_loop = 6,
-  anon_sym_endloop = 7,
-  anon_sym_DOT = 8,
-  anon_sym_LBRACK = 9,
-  anon_sym_RBRACK = 10,
-  anon_sym_LPAREN = 11,
-  anon_sym_RPAREN = 12,
-  anon_sym_PLUS_PLUS = 13,
-  anon_sym_DASH_DASH = 14,
-  anon_sym_not = 15,
-  anon_sym_DASH = 16,
-  anon_sym_PLUS = 17,
-  anon_sym_STAR = 18,
-  anon_sym_SLASH = 19,
-  anon_sym_LT = 20,
-  anon_sym_GT = 21,
-  anon_sym_LT_EQ = 22,
-  anon_sym_GT_EQ = 23,
-  anon_sym_EQ_EQ = 24,
-  anon_sym_BANG_EQ = 25,
-  anon_sym_and = 26,
-  anon_sym_or = 27,
-  anon_sym_EQ = 28,
-  anon_sym_COMMA = 29,
-  sym_number = 30,
-  sym_float = 31,
-  anon_sym_SLASH_SLASH = 32,
-  aux_sym_comment_token1 = 33,
-  sym__block_comment_start = 34,
-  sym__block_comment_content = 35,
-  sym__block_comment_end = 36,
-  sym__string_start = 37,
-  sym__string_content = 38,
-  sym__string_end = 39,
-  sym_program = 40,
-  sym__block = 41,
-  sym_struct = 42,
-  sym_globals = 43,
-  sym_loop = 44,
-  sym_expr = 45,
-  sym_string = 46,
-  sym_comment = 47,
-  aux_sym_program_repeat1 = 48,
-  aux_sym_expr_repeat1 = 49,
-};
-
-static const char * const ts_symbol_names[] = {
-  [ts_builtin_sym_end] = "end",
-  [sym_id] = "id",
-  [anon_sym_struct] = "struct_",
-  [anon_sym_endstruct] = "endstruct_",
-  [anon_sym_globals] = "globals_",
-  [anon_sym_endglobals] = "endglobals_",
-  [anon_sym_loop] = "loop_",
-  [anon_sym_endloop] = "endloop_",
-  [anon_sym_DOT] = ".",
-  [anon_sym_LBRACK] = "[",
-  [anon_sym_RBRACK] = "]",
-  [anon_sym_LPAREN] = "(",
-  [anon_sym_RPAREN] = ")",
-  [anon_sym_PLUS_PLUS] = "++",
-  [anon_sym_DASH_DASH] = "--",
-  [anon_sym_not] = "not",
-  [anon_sym_DASH] = "-",
-  [anon_sym_PLUS] = "+",
-  [anon_sym_STAR] = "*",
-  [anon_sym_SLASH] = "/",
-  [anon_sym_LT] = "<",
-  [anon_sym_GT] = ">",
-  [anon_sym_LT_EQ] = "<=",
-  [anon_sym_GT_EQ] = ">=",
-  [anon_sym_EQ_EQ] = "==",
-  [anon_sym_BANG_EQ] = "!=",
-  [anon_sym_and] = "and",
-  [anon_sym_or] = "or",
-  [anon_sym_EQ] = "=",
-  [anon_sym_COMMA] = ",",
-  [sym_number] = "number",
-  [sym_float] = "float",
-  [anon_sym_SLASH_SLASH] = "comment_start",
-  [aux_sym_comment_token1] = "comment_content",
-  [sym__block_comment_start] = "comment_start",
-  [sym__block_comment_content] = "comment_content",
-  [sym__block_comment_end] = "comment_end",
-  [sym__string_start] = "string_start",
-  [sym__string_content] = "string_content",
-  [sym__string_end] = "string_end",
-  [sym_program] = "program",
-  [sym__block] = "_block",
-  [sym_struct] = "struct",
-  [sym_globals] = "globals",
-  [sym_loop] = "loop",
-  [sym_expr] = "expr",
-  [sym_string] = "string",
-  [sym_comment] = "comment",
-  [aux_sym_program_repeat1] = "program_repeat1",
-  [aux_sym_expr_repeat1] = "expr_repeat1",
-};
-
-static const TSSymbol ts_symbol_map[] = {
-  [ts_builtin_sym_end] = ts_builtin_sym_end,
-  [sym_id] = sym_id,
-  [anon_sym_struct] = anon_sym_struct,
-  [anon_sym_endstruct] = anon_sym_endstruct,
-  [anon_sym_globals] = anon_sym_globals,
-  [anon_sym_endglobals] = anon_sym_endglobals,
-  [anon_sym_loop] = anon_sym_loop,
-  [anon_sym_endloop] = anon_sym_endloop,
-  [anon_sym_DOT] = anon_sym_DOT,
-  [anon_sym_LBRACK] = anon_sym_LBRACK,
-  [anon_sym_RBRACK] = anon_sym_RBRACK,
-  [anon_sym_LPAREN] = anon_sym_LPAREN,
-  [anon_sym_RPAREN] = anon_sym_RPAREN,
-  [anon_sym_PLUS_PLUS] = anon_sym_PLUS_PLUS,
-  [anon_sym_DASH_DASH] = anon_sym_DASH_DASH,
-  [anon_sym_not] = anon_sym_not,
-  [anon_sym_DASH] = anon_sym_DASH,
-  [anon_sym_PLUS] = anon_sym_PLUS,
-  [anon_sym_STAR] = anon_sym_STAR,
-  [anon_sym_SLASH] = anon_sym_SLASH,
-  [anon_sym_LT] = anon_sym_LT,
-  [anon_sym_GT] = anon_sym_GT,
-  [anon_sym_LT_EQ] = anon_sym_LT_EQ,
-  [anon_sym_GT_EQ] = anon_sym_GT_EQ,
-  [anon_sym_EQ_EQ] = anon_sym_EQ_EQ,
-  [anon_sym_BANG_EQ] = anon_sym_BANG_EQ,
-  [anon_sym_and] = anon_sym_and,
-  [anon_sym_or] = anon_sym_or,
-  [anon_sym_EQ] = anon_sym_EQ,
-  [anon_sym_COMMA] = anon_sym_COMMA,
-  [sym_number] = sym_number,
-  [sym_float] = sym_float,
-  [anon_sym_SLASH_SLASH] = sym__block_comment_start,
-  [aux_sym_comment_token1] = sym__block_comment_content,
-  [sym__block_comment_start] = sym__block_comment_start,
-  [sym__block_comment_content] = sym__block_comment_content,
-  [sym__block_comment_end] = sym__block_comment_end,
-  [sym__string_start] = sym__string_start,
-  [sym__string_content] = sym__string_content,
-  [sym__string_end] = sym__string_end,
-  [sym_program] = sym_program,
-  [sym__block] = sym__block,
-  [sym_struct] = sym_struct,
-  [sym_globals] = sym_globals,
-  [sym_loop] = sym_loop,
-  [sym_expr] = sym_expr,
-  [sym_string] = sym_string,
-  [sym_comment] = sym_comment,
-  [aux_sym_program_repeat1] = aux_sym_program_repeat1,
-  [aux_sym_expr_repeat1] = aux_sym_expr_repeat1,
-};
-
-static const TSSymbolMetadata ts_symbol_metadata[] = {
-  [ts_builtin_sym_end] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym_id] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_struct] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_endstruct] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_globals] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_endglobals] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_loop] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_endloop] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_DOT] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_LBRACK] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_RBRACK] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_LPAREN] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_RPAREN] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_PLUS_PLUS] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_DASH_DASH] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_not] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_DASH] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_PLUS] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_STAR] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_SLASH] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_LT] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_GT] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_LT_EQ] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_GT_EQ] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_EQ_EQ] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_BANG_EQ] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_and] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_or] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_EQ] = {
-    .visible = true,
-    .named = false,
-  },
-  [anon_sym_COMMA] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym_number] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_float] = {
-    .visible = true,
-    .named = true,
-  },
-  [anon_sym_SLASH_SLASH] = {
-    .visible = true,
-    .named = false,
-  },
-  [aux_sym_comment_token1] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym__block_comment_start] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym__block_comment_content] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym__block_comment_end] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym__string_start] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym__string_content] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym__string_end] = {
-    .visible = true,
-    .named = false,
-  },
-  [sym_program] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym__block] = {
-    .visible = false,
-    .named = true,
-  },
-  [sym_struct] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_globals] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_loop] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_expr] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_string] = {
-    .visible = true,
-    .named = true,
-  },
-  [sym_comment] = {
-    .visible = true,
-    .named = true,
-  },
-  [aux_sym_program_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-  [aux_sym_expr_repeat1] = {
-    .visible = false,
-    .named = false,
-  },
-};
-
-enum ts_field_identifiers {
-  field_content = 1,
-  field_end = 2,
-  field_start = 3,
-};
-
-static const char * const ts_field_names[] = {
-  [0] = NULL,
-  [field_content] = "content",
-  [field_end] = "end",
-  [field_start] = "start",
-};
-
-static const TSMapSlice ts_field_map_slices[PRODUCTION_ID_COUNT] = {
-  [1] = {.index = 0, .length = 2},
-  [2] = {.index = 2, .length = 2},
-  [3] = {.index = 4, .length = 3},
-};
-
-static const TSFieldMapEntry ts_field_map_entries[] = {
-  [0] =
-    {field_end, 1},
-    {field_start, 0},
-  [2] =
-    {field_content, 1},
-    {field_start, 0},
-  [4] =
-    {field_content, 1},
-    {field_end, 2},
-    {field_start, 0},
-};
-
-static const TSSymbol ts_alias_sequences[PRODUCTION_ID_COUNT][MAX_ALIAS_SEQUENCE_LENGTH] = {
-  [0] = {0},
-};
-
-static const uint16_t ts_non_terminal_alias_map[] = {
-  0,
-};
-
-static const TSStateId ts_primary_state_ids[STATE_COUNT] = {
-  [0] = 0,
-  [1] = 1,
-  [2] = 2,
-  [3] = 3,
-  [4] = 4,
-  [5] = 5,
-  [6] = 6,
-  [7] = 7,
-  [8] = 8,
-  [9] = 9,
-  [10] = 10,
-  [11] = 11,
-  [12] = 12,
-  [13] = 13,
-  [14] = 14,
-  [15] = 15,
-  [16] = 16,
-  [17] = 5,
-  [18] = 18,
-  [19] = 3,
-  [20] = 4,
-  [21] = 2,
-  [22] = 6,
-  [23] = 7,
-  [24] = 8,
-  [25] = 9,
-  [26] = 10,
-  [27] = 11,
-  [28] = 12,
-  [29] = 13,
-  [30] = 14,
-  [31] = 15,
-  [32] = 16,
-  [33] = 5,
-  [34] = 18,
-  [35] = 3,
-  [36] = 4,
-  [37] = 2,
-  [38] = 6,
-  [39] = 7,
-  [40] = 8,
-  [41] = 9,
-  [42] = 10,
-  [43] = 11,
-  [44] = 12,
-  [45] = 13,
-  [46] = 14,
-  [47] = 15,
-  [48] = 16,
-  [49] = 5,
-  [50] = 18,
-  [51] = 3,
-  [52] = 4,
-  [53] = 2,
-  [54] = 6,
-  [55] = 7,
-  [56] = 8,
-  [57] = 9,
-  [58] = 10,
-  [59] = 11,
-  [60] = 12,
-  [61] = 13,
-  [62] = 14,
-  [63] = 15,
-  [64] = 16,
-  [65] = 18,
-  [66] = 66,
-  [67] = 5,
-  [68] = 3,
-  [69] = 4,
-  [70] = 2,
-  [71] = 6,
-  [72] = 7,
-  [73] = 8,
-  [74] = 9,
-  [75] = 10,
-  [76] = 11,
-  [77] = 12,
-  [78] = 13,
-  [79] = 14,
-  [80] = 15,
-  [81] = 16,
-  [82] = 82,
-  [83] = 83,
-  [84] = 83,
-  [85] = 85,
-  [86] = 86,
-  [87] = 87,
-  [88] = 88,
-  [89] = 88,
-  [90] = 88,
-  [91] = 91,
-  [92] = 88,
-  [93] = 93,
-  [94] = 85,
-  [95] = 86,
-  [96] = 87,
-  [97] = 91,
-  [98] = 93,
-  [99] = 83,
-  [100] = 85,
-  [101] = 86,
-  [102] = 87,
-  [103] = 91,
-  [104] = 93,
-  [105] = 83,
-  [106] = 85,
-  [107] = 86,
-  [108] = 87,
-  [109] = 91,
-  [110] = 93,
-  [111] = 7,
-  [112] = 112,
-  [113] = 112,
-  [114] = 5,
-  [115] = 3,
-  [116] = 4,
-  [117] = 2,
-  [118] = 6,
-  [119] = 8,
-  [120] = 9,
-  [121] = 10,
-  [122] = 11,
-  [123] = 12,
-  [124] = 13,
-  [125] = 14,
-  [126] = 15,
-  [127] = 16,
-  [128] = 112,
-  [129] = 112,
-  [130] = 112,
-  [131] = 112,
-  [132] = 132,
-  [133] = 133,
-  [134] = 134,
-  [135] = 134,
-  [136] = 136,
-  [137] = 137,
-  [138] = 138,
-  [139] = 139,
-  [140] = 140,
-  [141] = 140,
-  [142] = 138,
-  [143] = 139,
-  [144] = 139,
-  [145] = 132,
-  [146] = 146,
-  [147] = 147,
-  [148] = 147,
-  [149] = 133,
-  [150] = 133,
-  [151] = 134,
-  [152] = 152,
-  [153] = 136,
-  [154] = 140,
-  [155] = 138,
-  [156] = 147,
-  [157] = 133,
-  [158] = 132,
-  [159] = 134,
-  [160] = 137,
-  [161] = 152,
-  [162] = 136,
-  [163] = 137,
-  [164] = 132,
-  [165] = 140,
-  [166] = 152,
-  [167] = 137,
-  [168] = 132,
-  [169] = 138,
-  [170] = 152,
-  [171] = 152,
-  [172] = 139,
-  [173] = 152,
-  [174] = 132,
-  [175] = 147,
-  [176] = 136,
-  [177] = 177,
-  [178] = 178,
-  [179] = 179,
-  [180] = 180,
-  [181] = 181,
-  [182] = 182,
-  [183] = 181,
-  [184] = 184,
-  [185] = 185,
-  [186] = 184,
-  [187] = 182,
-  [188] = 185,
-  [189] = 182,
-  [190] = 185,
-  [191] = 191,
-  [192] = 177,
-  [193] = 193,
-  [194] = 178,
-  [195] = 179,
-  [196] = 180,
-  [197] = 181,
-  [198] = 191,
-  [199] = 177,
-  [200] = 193,
-  [201] = 178,
-  [202] = 179,
-  [203] = 180,
-  [204] = 181,
-  [205] = 191,
-  [206] = 177,
-  [207] = 184,
-  [208] = 184,
-  [209] = 181,
-  [210] = 193,
-  [211] = 178,
-  [212] = 184,
-  [213] = 182,
-  [214] = 184,
-  [215] = 179,
-  [216] = 185,
-  [217] = 180,
-  [218] = 182,
-  [219] = 185,
-  [220] = 191,
-  [221] = 177,
-  [222] = 191,
-  [223] = 182,
-  [224] = 193,
-  [225] = 185,
-  [226] = 178,
-  [227] = 179,
-  [228] = 180,
-  [229] = 191,
-  [230] = 177,
-  [231] = 193,
-  [232] = 178,
-  [233] = 179,
-  [234] = 180,
-  [235] = 181,
-  [236] = 193,
-  [237] = 237,
-  [238] = 237,
-  [239] = 237,
-  [240] = 237,
-  [241] = 237,
-  [242] = 237,
-  [243] = 243,
-  [244] = 244,
-  [245] = 243,
-  [246] = 243,
-  [247] = 243,
-  [248] = 243,
-  [249] = 243,
-  [250] = 250,
-  [251] = 251,
-  [252] = 251,
-  [253] = 251,
-  [254] = 251,
-  [255] = 251,
-  [256] = 256,
-  [257] = 257,
-  [258] = 251,
-  [259] = 259,
-  [260] = 260,
-  [261] = 261,
-};
-
-static bool ts_lex(TSLexer *lexer, TSStateId state) {
-  START_LEXER();
-  eof = lexer->eof(lexer);
-  switch (state) {
-    case 0:
-      if (eof) ADVANCE(23);
-      ADVANCE_MAP(
-        '!', 11,
-        '(', 80,
-        ')', 81,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 86,
-        '.', 77,
-        '/', 89,
-        '0', 101,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        '[', 78,
-        ']', 79,
-        'a', 42,
-        'e', 43,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        'o', 56,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(0);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 1:
-      ADVANCE_MAP(
-        '!', 11,
-        '(', 80,
-        ')', 81,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 86,
-        '.', 77,
-        '/', 89,
-        '0', 101,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        '[', 78,
-        'a', 42,
-        'n', 49,
-        'o', 56,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(1);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 2:
-      ADVANCE_MAP(
-        '!', 11,
-        '(', 80,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 86,
-        '.', 77,
-        '/', 89,
-        '0', 101,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        '[', 78,
-        'a', 42,
-        'e', 44,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        'o', 56,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(2);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 3:
-      ADVANCE_MAP(
-        '!', 11,
-        '(', 80,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 86,
-        '.', 77,
-        '/', 89,
-        '0', 101,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        '[', 78,
-        'a', 42,
-        'e', 45,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        'o', 56,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(3);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 4:
-      ADVANCE_MAP(
-        '!', 11,
-        '(', 80,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 86,
-        '.', 77,
-        '/', 89,
-        '0', 101,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        '[', 78,
-        'a', 42,
-        'e', 46,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        'o', 56,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(4);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 5:
-      ADVANCE_MAP(
-        '!', 11,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 85,
-        '.', 76,
-        '/', 89,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        ']', 79,
-        'a', 13,
-        'o', 14,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(5);
-      END_STATE();
-    case 6:
-      ADVANCE_MAP(
-        '(', 80,
-        ')', 81,
-        '+', 87,
-        '-', 86,
-        '.', 18,
-        '/', 10,
-        '0', 101,
-        '[', 78,
-        'n', 49,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(6);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 7:
-      ADVANCE_MAP(
-        '(', 80,
-        '+', 87,
-        '-', 86,
-        '.', 18,
-        '/', 10,
-        '0', 101,
-        '[', 78,
-        'e', 44,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(7);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 8:
-      ADVANCE_MAP(
-        '(', 80,
-        '+', 87,
-        '-', 86,
-        '.', 18,
-        '/', 10,
-        '0', 101,
-        '[', 78,
-        'e', 45,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(8);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 9:
-      ADVANCE_MAP(
-        '(', 80,
-        '+', 87,
-        '-', 86,
-        '.', 18,
-        '/', 10,
-        '0', 101,
-        '[', 78,
-        'e', 46,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(9);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 10:
-      if (lookahead == '/') ADVANCE(109);
-      END_STATE();
-    case 11:
-      if (lookahead == '=') ADVANCE(95);
-      END_STATE();
-    case 12:
-      if (lookahead == 'd') ADVANCE(96);
-      END_STATE();
-    case 13:
-      if (lookahead == 'n') ADVANCE(12);
-      END_STATE();
-    case 14:
-      if (lookahead == 'r') ADVANCE(97);
-      END_STATE();
-    case 15:
-      if (lookahead == '+' ||
-          lookahead == '-') ADVANCE(19);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(108);
-      END_STATE();
-    case 16:
-      if (lookahead == '0' ||
-          lookahead == '1') ADVANCE(103);
-      END_STATE();
-    case 17:
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      END_STATE();
-    case 18:
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(107);
-      END_STATE();
-    case 19:
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(108);
-      END_STATE();
-    case 20:
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(104);
-      END_STATE();
-    case 21:
-      if (eof) ADVANCE(23);
-      ADVANCE_MAP(
-        '!', 11,
-        '(', 80,
-        '*', 88,
-        '+', 87,
-        ',', 99,
-        '-', 86,
-        '.', 77,
-        '/', 89,
-        '0', 101,
-        '<', 90,
-        '=', 98,
-        '>', 91,
-        '[', 78,
-        'a', 42,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        'o', 56,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(21);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 22:
-      if (eof) ADVANCE(23);
-      ADVANCE_MAP(
-        '(', 80,
-        '+', 87,
-        '-', 86,
-        '.', 18,
-        '/', 10,
-        '0', 101,
-        '[', 78,
-        'g', 39,
-        'l', 51,
-        'n', 49,
-        's', 65,
-      );
-      if (('\t' <= lookahead && lookahead <= '\r') ||
-          lookahead == ' ') SKIP(22);
-      if (('1' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      if (('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 23:
-      ACCEPT_TOKEN(ts_builtin_sym_end);
-      END_STATE();
-    case 24:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'a') ADVANCE(37);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 25:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'a') ADVANCE(38);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('b' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 26:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'b') ADVANCE(24);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 27:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'b') ADVANCE(25);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 28:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'c') ADVANCE(63);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 29:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'c') ADVANCE(64);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 30:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'd') ADVANCE(96);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 31:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'd') ADVANCE(35);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 32:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'd') ADVANCE(36);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 33:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'd') ADVANCE(61);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 34:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'd') ADVANCE(40);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 35:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'g') ADVANCE(41);
-      if (lookahead == 'l') ADVANCE(52);
-      if (lookahead == 's') ADVANCE(66);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 36:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'g') ADVANCE(41);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 37:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'l') ADVANCE(59);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 38:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'l') ADVANCE(60);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 39:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'l') ADVANCE(47);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 40:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'l') ADVANCE(52);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 41:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'l') ADVANCE(53);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 42:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'n') ADVANCE(30);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 43:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'n') ADVANCE(31);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 44:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'n') ADVANCE(33);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 45:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'n') ADVANCE(32);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 46:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'n') ADVANCE(34);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 47:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(26);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 48:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(54);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 49:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(62);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 50:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(55);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 51:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(48);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 52:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(50);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 53:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'o') ADVANCE(27);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 54:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'p') ADVANCE(74);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 55:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'p') ADVANCE(75);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 56:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'r') ADVANCE(97);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 57:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'r') ADVANCE(67);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 58:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'r') ADVANCE(68);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 59:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 's') ADVANCE(72);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 60:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 's') ADVANCE(73);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 61:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 's') ADVANCE(66);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 62:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 't') ADVANCE(84);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 63:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 't') ADVANCE(70);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 64:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 't') ADVANCE(71);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 65:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 't') ADVANCE(57);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 66:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 't') ADVANCE(58);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 67:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'u') ADVANCE(28);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 68:
-      ACCEPT_TOKEN(sym_id);
-      if (lookahead == 'u') ADVANCE(29);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 69:
-      ACCEPT_TOKEN(sym_id);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'Z') ||
-          lookahead == '_' ||
-          ('a' <= lookahead && lookahead <= 'z')) ADVANCE(69);
-      END_STATE();
-    case 70:
-      ACCEPT_TOKEN(anon_sym_struct);
-      END_STATE();
-    case 71:
-      ACCEPT_TOKEN(anon_sym_endstruct);
-      END_STATE();
-    case 72:
-      ACCEPT_TOKEN(anon_sym_globals);
-      END_STATE();
-    case 73:
-      ACCEPT_TOKEN(anon_sym_endglobals);
-      END_STATE();
-    case 74:
-      ACCEPT_TOKEN(anon_sym_loop);
-      END_STATE();
-    case 75:
-      ACCEPT_TOKEN(anon_sym_endloop);
-      END_STATE();
-    case 76:
-      ACCEPT_TOKEN(anon_sym_DOT);
-      END_STATE();
-    case 77:
-      ACCEPT_TOKEN(anon_sym_DOT);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(107);
-      END_STATE();
-    case 78:
-      ACCEPT_TOKEN(anon_sym_LBRACK);
-      END_STATE();
-    case 79:
-      ACCEPT_TOKEN(anon_sym_RBRACK);
-      END_STATE();
-    case 80:
-      ACCEPT_TOKEN(anon_sym_LPAREN);
-      END_STATE();
-    case 81:
-      ACCEPT_TOKEN(anon_sym_RPAREN);
-      END_STATE();
-    case 82:
-      ACCEPT_TOKEN(anon_sym_PLUS_PLUS);
-      END_STATE();
-    case 83:
-      ACCEPT_TOKEN(anon_sym_DASH_DASH);
-      END_STATE();
-    case 84:
-      ACCEPT_TOKEN(anon_sym_not);
-      END_STATE();
-    case 85:
-      ACCEPT_TOKEN(anon_sym_DASH);
-      END_STATE();
-    case 86:
-      ACCEPT_TOKEN(anon_sym_DASH);
-      if (lookahead == '-') ADVANCE(83);
-      END_STATE();
-    case 87:
-      ACCEPT_TOKEN(anon_sym_PLUS);
-      if (lookahead == '+') ADVANCE(82);
-      END_STATE();
-    case 88:
-      ACCEPT_TOKEN(anon_sym_STAR);
-      END_STATE();
-    case 89:
-      ACCEPT_TOKEN(anon_sym_SLASH);
-      if (lookahead == '/') ADVANCE(109);
-      END_STATE();
-    case 90:
-      ACCEPT_TOKEN(anon_sym_LT);
-      if (lookahead == '=') ADVANCE(92);
-      END_STATE();
-    case 91:
-      ACCEPT_TOKEN(anon_sym_GT);
-      if (lookahead == '=') ADVANCE(93);
-      END_STATE();
-    case 92:
-      ACCEPT_TOKEN(anon_sym_LT_EQ);
-      END_STATE();
-    case 93:
-      ACCEPT_TOKEN(anon_sym_GT_EQ);
-      END_STATE();
-    case 94:
-      ACCEPT_TOKEN(anon_sym_EQ_EQ);
-      END_STATE();
-    case 95:
-      ACCEPT_TOKEN(anon_sym_BANG_EQ);
-      END_STATE();
-    case 96:
-      ACCEPT_TOKEN(anon_sym_and);
-      END_STATE();
-    case 97:
-      ACCEPT_TOKEN(anon_sym_or);
-      END_STATE();
-    case 98:
-      ACCEPT_TOKEN(anon_sym_EQ);
-      if (lookahead == '=') ADVANCE(94);
-      END_STATE();
-    case 99:
-      ACCEPT_TOKEN(anon_sym_COMMA);
-      END_STATE();
-    case 100:
-      ACCEPT_TOKEN(sym_number);
-      END_STATE();
-    case 101:
-      ACCEPT_TOKEN(sym_number);
-      ADVANCE_MAP(
-        '.', 18,
-        '_', 17,
-        'B', 16,
-        'b', 16,
-        'E', 15,
-        'e', 15,
-        'F', 106,
-        'f', 106,
-        'L', 100,
-        'l', 100,
-        'U', 105,
-        'u', 105,
-        'X', 20,
-        'x', 20,
-      );
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      END_STATE();
-    case 102:
-      ACCEPT_TOKEN(sym_number);
-      ADVANCE_MAP(
-        '.', 18,
-        '_', 17,
-        'E', 15,
-        'e', 15,
-        'F', 106,
-        'f', 106,
-        'L', 100,
-        'l', 100,
-        'U', 105,
-        'u', 105,
-      );
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(102);
-      END_STATE();
-    case 103:
-      ACCEPT_TOKEN(sym_number);
-      if (lookahead == '_') ADVANCE(16);
-      if (lookahead == 'L' ||
-          lookahead == 'l') ADVANCE(100);
-      if (lookahead == 'U' ||
-          lookahead == 'u') ADVANCE(105);
-      if (lookahead == '0' ||
-          lookahead == '1') ADVANCE(103);
-      END_STATE();
-    case 104:
-      ACCEPT_TOKEN(sym_number);
-      if (lookahead == '_') ADVANCE(20);
-      if (lookahead == 'L' ||
-          lookahead == 'l') ADVANCE(100);
-      if (lookahead == 'U' ||
-          lookahead == 'u') ADVANCE(105);
-      if (('0' <= lookahead && lookahead <= '9') ||
-          ('A' <= lookahead && lookahead <= 'F') ||
-          ('a' <= lookahead && lookahead <= 'f')) ADVANCE(104);
-      END_STATE();
-    case 105:
-      ACCEPT_TOKEN(sym_number);
-      if (lookahead == 'L' ||
-          lookahead == 'l') ADVANCE(100);
-      END_STATE();
-    case 106:
-      ACCEPT_TOKEN(sym_float);
-      END_STATE();
-    case 107:
-      ACCEPT_TOKEN(sym_float);
-      if (lookahead == '_') ADVANCE(18);
-      if (lookahead == 'E' ||
-          lookahead == 'e') ADVANCE(15);
-      if (lookahead == 'F' ||
-          lookahead == 'f') ADVANCE(106);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(107);
-      END_STATE();
-    case 108:
-      ACCEPT_TOKEN(sym_float);
-      if (lookahead == 'F' ||
-          lookahead == 'f') ADVANCE(106);
-      if (('0' <= lookahead && lookahead <= '9')) ADVANCE(108);
-      END_STATE();
-    case 109:
-      ACCEPT_TOKEN(anon_sym_SLASH_SLASH);
-      END_STATE();
-    case 110:
-      ACCEPT_TOKEN(anon_sym_SLASH_SLASH);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '\r') ADVANCE(113);
-      END_STATE();
-    case 111:
-      ACCEPT_TOKEN(aux_sym_comment_token1);
-      if (lookahead == '/') ADVANCE(112);
-      if (lookahead == '\t' ||
-          lookahead == 0x0b ||
-          lookahead == '\f' ||
-          lookahead == ' ') ADVANCE(111);
-      if (lookahead != 0 &&
-          (lookahead < '\t' || '\r' < lookahead)) ADVANCE(113);
-      END_STATE();
-    case 112:
-      ACCEPT_TOKEN(aux_sym_comment_token1);
-      if (lookahead == '/') ADVANCE(110);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '\r') ADVANCE(113);
-      END_STATE();
-    case 113:
-      ACCEPT_TOKEN(aux_sym_comment_token1);
-      if (lookahead != 0 &&
-          lookahead != '\n' &&
-          lookahead != '\r') ADVANCE(113);
-      END_STATE();
-    default:
-      return false;
-  }
-}
-
-static const TSLexerMode ts_lex_modes[STATE_COUNT] = {
-  [0] = {.lex_state = 0, .external_lex_state = 1},
-  [1] = {.lex_state = 22, .external_lex_state = 2},
-  [2] = {.lex_state = 21, .external_lex_state = 2},
-  [3] = {.lex_state = 21, .external_lex_state = 2},
-  [4] = {.lex_state = 21, .external_lex_state = 2},
-  [5] = {.lex_state = 21, .external_lex_state = 2},
-  [6] = {.lex_state = 21, .external_lex_state = 2},
-  [7] = {.lex_state = 21, .external_lex_state = 2},
-  [8] = {.lex_state = 21, .external_lex_state = 2},
-  [9] = {.lex_state = 21, .external_lex_state = 2},
-  [10] = {.lex_state = 21, .external_lex_state = 2},
-  [11] = {.lex_state = 21, .external_lex_state = 2},
-  [12] = {.lex_state = 21, .external_lex_state = 2},
-  [13] = {.lex_state = 21, .external_lex_state = 2},
-  [14] = {.lex_state = 21, .external_lex_state = 2},
-  [15] = {.lex_state = 21, .external_lex_state = 2},
-  [16] = {.lex_state = 21, .external_lex_state = 2},
-  [17] = {.lex_state = 2, .external_lex_state = 2},
-  [18] = {.lex_state = 2, .external_lex_state = 2},
-  [19] = {.lex_state = 2, .external_lex_state = 2},
-  [20] = {.lex_state = 2, .external_lex_state = 2},
-  [21] = {.lex_state = 2, .external_lex_state = 2},
-  [22] = {.lex_state = 2, .external_lex_state = 2},
-  [23] = {.lex_state = 2, .external_lex_state = 2},
-  [24] = {.lex_state = 2, .external_lex_state = 2},
-  [25] = {.lex_state = 2, .external_lex_state = 2},
-  [26] = {.lex_state = 2, .external_lex_state = 2},
-  [27] = {.lex_state = 2, .external_lex_state = 2},
-  [28] = {.lex_state = 2, .external_lex_state = 2},
-  [29] = {.lex_state = 2, .external_lex_state = 2},
-  [30] = {.lex_state = 2, .external_lex_state = 2},
-  [31] = {.lex_state = 2, .external_lex_state = 2},
-  [32] = {.lex_state = 2, .external_lex_state = 2},
-  [33] = {.lex_state = 3, .external_lex_state = 2},
-  [34] = {.lex_state = 3, .external_lex_state = 2},
-  [35] = {.lex_state = 3, .external_lex_state = 2},
-  [36] = {.lex_state = 3, .external_lex_state = 2},
-  [37] = {.lex_state = 3, .external_lex_state = 2},
-  [38] = {.lex_state = 3, .external_lex_state = 2},
-  [39] = {.lex_state = 3, .external_lex_state = 2},
-  [40] = {.lex_state = 3, .external_lex_state = 2},
-  [41] = {.lex_state = 3, .external_lex_state = 2},
-  [42] = {.lex_state = 3, .external_lex_state = 2},
-  [43] = {.lex_state = 3, .external_lex_state = 2},
-  [44] = {.lex_state = 3, .external_lex_state = 2},
-  [45] = {.lex_state = 3, .external_lex_state = 2},
-  [46] = {.lex_state = 3, .external_lex_state = 2},
-  [47] = {.lex_state = 3, .external_lex_state = 2},
-  [48] = {.lex_state = 3, .external_lex_state = 2},
-  [49] = {.lex_state = 4, .external_lex_state = 2},
-  [50] = {.lex_state = 4, .external_lex_state = 2},
-  [51] = {.lex_state = 4, .external_lex_state = 2},
-  [52] = {.lex_state = 4, .external_lex_state = 2},
-  [53] = {.lex_state = 4, .external_lex_state = 2},
-  [54] = {.lex_state = 4, .external_lex_state = 2},
-  [55] = {.lex_state = 4, .external_lex_state = 2},
-  [56] = {.lex_state = 4, .external_lex_state = 2},
-  [57] = {.lex_state = 4, .external_lex_state = 2},
-  [58] = {.lex_state = 4, .external_lex_state = 2},
-  [59] = {.lex_state = 4, .external_lex_state = 2},
-  [60] = {.lex_state = 4, .external_lex_state = 2},
-  [61] = {.lex_state = 4, .external_lex_state = 2},
-  [62] = {.lex_state = 4, .external_lex_state = 2},
-  [63] = {.lex_state = 4, .external_lex_state = 2},
-  [64] = {.lex_state = 4, .external_lex_state = 2},
-  [65] = {.lex_state = 21, .external_lex_state = 2},
-  [66] = {.lex_state = 1, .external_lex_state = 2},
-  [67] = {.lex_state = 1, .external_lex_state = 2},
-  [68] = {.lex_state = 1, .external_lex_state = 2},
-  [69] = {.lex_state = 1, .external_lex_state = 2},
-  [70] = {.lex_state = 1, .external_lex_state = 2},
-  [71] = {.lex_state = 1, .external_lex_state = 2},
-  [72] = {.lex_state = 1, .external_lex_state = 2},
-  [73] = {.lex_state = 1, .external_lex_state = 2},
-  [74] = {.lex_state = 1, .external_lex_state = 2},
-  [75] = {.lex_state = 1, .external_lex_state = 2},
-  [76] = {.lex_state = 1, .external_lex_state = 2},
-  [77] = {.lex_state = 1, .external_lex_state = 2},
-  [78] = {.lex_state = 1, .external_lex_state = 2},
-  [79] = {.lex_state = 1, .external_lex_state = 2},
-  [80] = {.lex_state = 1, .external_lex_state = 2},
-  [81] = {.lex_state = 1, .external_lex_state = 2},
-  [82] = {.lex_state = 22, .external_lex_state = 2},
-  [83] = {.lex_state = 9, .external_lex_state = 2},
-  [84] = {.lex_state = 9, .external_lex_state = 2},
-  [85] = {.lex_state = 7, .external_lex_state = 2},
-  [86] = {.lex_state = 8, .external_lex_state = 2},
-  [87] = {.lex_state = 9, .external_lex_state = 2},
-  [88] = {.lex_state = 8, .external_lex_state = 2},
-  [89] = {.lex_state = 22, .external_lex_state = 2},
-  [90] = {.lex_state = 9, .external_lex_state = 2},
-  [91] = {.lex_state = 7, .external_lex_state = 2},
-  [92] = {.lex_state = 7, .external_lex_state = 2},
-  [93] = {.lex_state = 8, .external_lex_state = 2},
-  [94] = {.lex_state = 7, .external_lex_state = 2},
-  [95] = {.lex_state = 8, .external_lex_state = 2},
-  [96] = {.lex_state = 9, .external_lex_state = 2},
-  [97] = {.lex_state = 7, .external_lex_state = 2},
-  [98] = {.lex_state = 8, .external_lex_state = 2},
-  [99] = {.lex_state = 9, .external_lex_state = 2},
-  [100] = {.lex_state = 7, .external_lex_state = 2},
-  [101] = {.lex_state = 8, .external_lex_state = 2},
-  [102] = {.lex_state = 9, .external_lex_state = 2},
-  [103] = {.lex_state = 7, .external_lex_state = 2},
-  [104] = {.lex_state = 8, .external_lex_state = 2},
-  [105] = {.lex_state = 9, .external_lex_state = 2},
-  [106] = {.lex_state = 7, .external_lex_state = 2},
-  [107] = {.lex_state = 8, .external_lex_state = 2},
-  [108] = {.lex_state = 9, .external_lex_state = 2},
-  [109] = {.lex_state = 7, .external_lex_state = 2},
-  [110] = {.lex_state = 8, .external_lex_state = 2},
-  [111] = {.lex_state = 5, .external_lex_state = 3},
-  [112] = {.lex_state = 5, .external_lex_state = 3},
-  [113] = {.lex_state = 5, .external_lex_state = 3},
-  [114] = {.lex_state = 5, .external_lex_state = 3},
-  [115] = {.lex_state = 5, .external_lex_state = 3},
-  [116] = {.lex_state = 5, .external_lex_state = 3},
-  [117] = {.lex_state = 5, .external_lex_state = 3},
-  [118] = {.lex_state = 5, .external_lex_state = 3},
-  [119] = {.lex_state = 5, .external_lex_state = 3},
-  [120] = {.lex_state = 5, .external_lex_state = 3},
-  [121] = {.lex_state = 5, .external_lex_state = 3},
-  [122] = {.lex_state = 5, .external_lex_state = 3},
-  [123] = {.lex_state = 5, .external_lex_state = 3},
-  [124] = {.lex_state = 5, .external_lex_state = 3},
-  [125] = {.lex_state = 5, .external_lex_state = 3},
-  [126] = {.lex_state = 5, .external_lex_state = 3},
-  [127] = {.lex_state = 5, .external_lex_state = 3},
-  [128] = {.lex_state = 5, .external_lex_state = 3},
-  [129] = {.lex_state = 5, .external_lex_state = 3},
-  [130] = {.lex_state = 5, .external_lex_state = 3},
-  [131] = {.lex_state = 5, .external_lex_state = 3},
-  [132] = {.lex_state = 6, .external_lex_state = 2},
-  [133] = {.lex_state = 7, .external_lex_state = 2},
-  [134] = {.lex_state = 22, .external_lex_state = 2},
-  [135] = {.lex_state = 7, .external_lex_state = 2},
-  [136] = {.lex_state = 7, .external_lex_state = 2},
-  [137] = {.lex_state = 7, .external_lex_state = 2},
-  [138] = {.lex_state = 8, .external_lex_state = 2},
-  [139] = {.lex_state = 8, .external_lex_state = 2},
-  [140] = {.lex_state = 8, .external_lex_state = 2},
-  [141] = {.lex_state = 22, .external_lex_state = 2},
-  [142] = {.lex_state = 22, .external_lex_state = 2},
-  [143] = {.lex_state = 7, .external_lex_state = 2},
-  [144] = {.lex_state = 22, .external_lex_state = 2},
-  [145] = {.lex_state = 6, .external_lex_state = 2},
-  [146] = {.lex_state = 6, .external_lex_state = 2},
-  [147] = {.lex_state = 22, .external_lex_state = 2},
-  [148] = {.lex_state = 9, .external_lex_state = 2},
-  [149] = {.lex_state = 9, .external_lex_state = 2},
-  [150] = {.lex_state = 22, .external_lex_state = 2},
-  [151] = {.lex_state = 9, .external_lex_state = 2},
-  [152] = {.lex_state = 6, .external_lex_state = 2},
-  [153] = {.lex_state = 22, .external_lex_state = 2},
-  [154] = {.lex_state = 7, .external_lex_state = 2},
-  [155] = {.lex_state = 7, .external_lex_state = 2},
-  [156] = {.lex_state = 8, .external_lex_state = 2},
-  [157] = {.lex_state = 8, .external_lex_state = 2},
-  [158] = {.lex_state = 6, .external_lex_state = 2},
-  [159] = {.lex_state = 8, .external_lex_state = 2},
-  [160] = {.lex_state = 9, .external_lex_state = 2},
-  [161] = {.lex_state = 6, .external_lex_state = 2},
-  [162] = {.lex_state = 8, .external_lex_state = 2},
-  [163] = {.lex_state = 8, .external_lex_state = 2},
-  [164] = {.lex_state = 6, .external_lex_state = 2},
-  [165] = {.lex_state = 9, .external_lex_state = 2},
-  [166] = {.lex_state = 6, .external_lex_state = 2},
-  [167] = {.lex_state = 22, .external_lex_state = 2},
-  [168] = {.lex_state = 6, .external_lex_state = 2},
-  [169] = {.lex_state = 9, .external_lex_state = 2},
-  [170] = {.lex_state = 6, .external_lex_state = 2},
-  [171] = {.lex_state = 6, .external_lex_state = 2},
-  [172] = {.lex_state = 9, .external_lex_state = 2},
-  [173] = {.lex_state = 6, .external_lex_state = 2},
-  [174] = {.lex_state = 6, .external_lex_state = 2},
-  [175] = {.lex_state = 7, .external_lex_state = 2},
-  [176] = {.lex_state = 9, .external_lex_state = 2},
-  [177] = {.lex_state = 6, .external_lex_state = 2},
-  [178] = {.lex_state = 6, .external_lex_state = 2},
-  [179] = {.lex_state = 6, .external_lex_state = 2},
-  [180] = {.lex_state = 6, .external_lex_state = 2},
-  [181] = {.lex_state = 6, .external_lex_state = 2},
-  [182] = {.lex_state = 6, .external_lex_state = 2},
-  [183] = {.lex_state = 6, .external_lex_state = 2},
-  [184] = {.lex_state = 6, .external_lex_state = 2},
-  [185] = {.lex_state = 6, .external_lex_state = 2},
-  [186] = {.lex_state = 6, .external_lex_state = 2},
-  [187] = {.lex_state = 6, .external_lex_state = 2},
-  [188] = {.lex_state = 6, .external_lex_state = 2},
-  [189] = {.lex_state = 6, .external_lex_state = 2},
-  [190] = {.lex_state = 6, .external_lex_state = 2},
-  [191] = {.lex_state = 6, .external_lex_state = 2},
-  [192] = {.lex_state = 6, .external_lex_state = 2},
-  [193] = {.lex_state = 6, .external_lex_state = 2},
-  [194] = {.lex_state = 6, .external_lex_state = 2},
-  [195] = {.lex_state = 6, .external_lex_state = 2},
-  [196] = {.lex_state = 6, .external_lex_state = 2},
-  [197] = {.lex_state = 6, .external_lex_state = 2},
-  [198] = {.lex_state = 6, .external_lex_state = 2},
-  [199] = {.lex_state = 6, .external_lex_state = 2},
-  [200] = {.lex_state = 6, .external_lex_state = 2},
-  [201] = {.lex_state = 6, .external_lex_state = 2},
-  [202] = {.lex_state = 6, .external_lex_state = 2},
-  [203] = {.lex_state = 6, .external_lex_state = 2},
-  [204] = {.lex_state = 6, .external_lex_state = 2},
-  [205] = {.lex_state = 6, .external_lex_state = 2},
-  [206] = {.lex_state = 6, .external_lex_state = 2},
-  [207] = {.lex_state = 6, .external_lex_state = 2},
-  [208] = {.lex_state = 6, .external_lex_state = 2},
-  [209] = {.lex_state = 6, .external_lex_state = 2},
-  [210] = {.lex_state = 6, .external_lex_state = 2},
-  [211] = {.lex_state = 6, .external_lex_state = 2},
-  [212] = {.lex_state = 6, .external_lex_state = 2},
-  [213] = {.lex_state = 6, .external_lex_state = 2},
-  [214] = {.lex_state = 6, .external_lex_state = 2},
-  [215] = {.lex_state = 6, .external_lex_state = 2},
-  [216] = {.lex_state = 6, .external_lex_state = 2},
-  [217] = {.lex_state = 6, .external_lex_state = 2},
-  [218] = {.lex_state = 6, .external_lex_state = 2},
-  [219] = {.lex_state = 6, .external_lex_state = 2},
-  [220] = {.lex_state = 6, .external_lex_state = 2},
-  [221] = {.lex_state = 6, .external_lex_state = 2},
-  [222] = {.lex_state = 6, .external_lex_state = 2},
-  [223] = {.lex_state = 6, .external_lex_state = 2},
-  [224] = {.lex_state = 6, .external_lex_state = 2},
-  [225] = {.lex_state = 6, .external_lex_state = 2},
-  [226] = {.lex_state = 6, .external_lex_state = 2},
-  [227] = {.lex_state = 6, .external_lex_state = 2},
-  [228] = {.lex_state = 6, .external_lex_state = 2},
-  [229] = {.lex_state = 6, .external_lex_state = 2},
-  [230] = {.lex_state = 6, .external_lex_state = 2},
-  [231] = {.lex_state = 6, .external_lex_state = 2},
-  [232] = {.lex_state = 6, .external_lex_state = 2},
-  [233] = {.lex_state = 6, .external_lex_state = 2},
-  [234] = {.lex_state = 6, .external_lex_state = 2},
-  [235] = {.lex_state = 6, .external_lex_state = 2},
-  [236] = {.lex_state = 6, .external_lex_state = 2},
-  [237] = {.lex_state = 6, .external_lex_state = 2},
-  [238] = {.lex_state = 6, .external_lex_state = 2},
-  [239] = {.lex_state = 6, .external_lex_state = 2},
-  [240] = {.lex_state = 6, .external_lex_state = 2},
-  [241] = {.lex_state = 6, .external_lex_state = 2},
-  [242] = {.lex_state = 6, .external_lex_state = 2},
-  [243] = {.lex_state = 0, .external_lex_state = 4},
-  [244] = {.lex_state = 0, .external_lex_state = 5},
-  [245] = {.lex_state = 0, .external_lex_state = 4},
-  [246] = {.lex_state = 0, .external_lex_state = 4},
-  [247] = {.lex_state = 0, .external_lex_state = 4},
-  [248] = {.lex_state = 0, .external_lex_state = 4},
-  [249] = {.lex_state = 0, .external_lex_state = 4},
-  [250] = {.lex_state = 0, .external_lex_state = 3},
-  [251] = {.lex_state = 0, .external_lex_state = 6},
-  [252] = {.lex_state = 0, .external_lex_state = 6},
-  [253] = {.lex_state = 0, .external_lex_state = 6},
-  [254] = {.lex_state = 0, .external_lex_state = 6},
-  [255] = {.lex_state = 0, .external_lex_state = 6},
-  [256] = {.lex_state = 0, .external_lex_state = 7},
-  [257] = {.lex_state = 111, .external_lex_state = 3},
-  [258] = {.lex_state = 0, .external_lex_state = 6},
-  [259] = {(TSStateId)(-1),},
-  [260] = {(TSStateId)(-1),},
-  [261] = {(TSStateId)(-1),},
-};
-
-static const uint16_t ts_parse_table[LARGE_STATE_COUNT][SYMBOL_COUNT] = {
-  [STATE(0)] = {
-    [sym_comment] = STATE(0),
-    [ts_builtin_sym_end] = ACTIONS(1),
-    [sym_id] = ACTIONS(1),
-    [anon_sym_struct] = ACTIONS(1),
-    [anon_sym_endstruct] = ACTIONS(1),
-    [anon_sym_globals] = ACTIONS(1),
-    [anon_sym_endglobals] = ACTIONS(1),
-    [anon_sym_loop] = ACTIONS(1),
-    [anon_sym_endloop] = ACTIONS(1),
-    [anon_sym_DOT] = ACTIONS(1),
-    [anon_sym_LBRACK] = ACTIONS(1),
-    [anon_sym_RBRACK] = ACTIONS(1),
-    [anon_sym_LPAREN] = ACTIONS(1),
-    [anon_sym_RPAREN] = ACTIONS(1),
-    [anon_sym_PLUS_PLUS] = ACTIONS(1),
-    [anon_sym_DASH_DASH] = ACTIONS(1),
-    [anon_sym_not] = ACTIONS(1),
-    [anon_sym_DASH] = ACTIONS(1),
-    [anon_sym_PLUS] = ACTIONS(1),
-    [anon_sym_STAR] = ACTIONS(1),
-    [anon_sym_SLASH] = ACTIONS(1),
-    [anon_sym_LT] = ACTIONS(1),
-    [anon_sym_GT] = ACTIONS(1),
-    [anon_sym_LT_EQ] = ACTIONS(1),
-    [anon_sym_GT_EQ] = ACTIONS(1),
-    [anon_sym_EQ_EQ] = ACTIONS(1),
-    [anon_sym_BANG_EQ] = ACTIONS(1),
-    [anon_sym_and] = ACTIONS(1),
-    [anon_sym_or] = ACTIONS(1),
-    [anon_sym_EQ] = ACTIONS(1),
-    [anon_sym_COMMA] = ACTIONS(1),
-    [sym_number] = ACTIONS(1),
-    [sym_float] = ACTIONS(1),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__block_comment_content] = ACTIONS(1),
-    [sym__block_comment_end] = ACTIONS(1),
-    [sym__string_start] = ACTIONS(1),
-    [sym__string_content] = ACTIONS(1),
-    [sym__string_end] = ACTIONS(1),
-  },
-  [STATE(1)] = {
-    [sym_program] = STATE(250),
-    [sym__block] = STATE(147),
-    [sym_struct] = STATE(150),
-    [sym_globals] = STATE(150),
-    [sym_loop] = STATE(150),
-    [sym_expr] = STATE(65),
-    [sym_string] = STATE(5),
-    [sym_comment] = STATE(1),
-    [aux_sym_program_repeat1] = STATE(82),
-    [ts_builtin_sym_end] = ACTIONS(7),
-    [sym_id] = ACTIONS(9),
-    [anon_sym_struct] = ACTIONS(11),
-    [anon_sym_globals] = ACTIONS(13),
-    [anon_sym_loop] = ACTIONS(15),
-    [anon_sym_LBRACK] = ACTIONS(17),
-    [anon_sym_LPAREN] = ACTIONS(19),
-    [anon_sym_PLUS_PLUS] = ACTIONS(21),
-    [anon_sym_DASH_DASH] = ACTIONS(21),
-    [anon_sym_not] = ACTIONS(21),
-    [anon_sym_DASH] = ACTIONS(23),
-    [anon_sym_PLUS] = ACTIONS(23),
-    [sym_number] = ACTIONS(9),
-    [sym_float] = ACTIONS(25),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(27),
-  },
-  [STATE(2)] = {
-    [sym_comment] = STATE(2),
-    [ts_builtin_sym_end] = ACTIONS(29),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(33),
-    [anon_sym_PLUS] = ACTIONS(33),
-    [anon_sym_STAR] = ACTIONS(35),
-    [anon_sym_SLASH] = ACTIONS(37),
-    [anon_sym_LT] = ACTIONS(39),
-    [anon_sym_GT] = ACTIONS(39),
-    [anon_sym_LT_EQ] = ACTIONS(41),
-    [anon_sym_GT_EQ] = ACTIONS(41),
-    [anon_sym_EQ_EQ] = ACTIONS(43),
-    [anon_sym_BANG_EQ] = ACTIONS(43),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(3)] = {
-    [sym_comment] = STATE(3),
-    [ts_builtin_sym_end] = ACTIONS(53),
-    [sym_id] = ACTIONS(55),
-    [anon_sym_struct] = ACTIONS(53),
-    [anon_sym_globals] = ACTIONS(53),
-    [anon_sym_loop] = ACTIONS(53),
-    [anon_sym_DOT] = ACTIONS(55),
-    [anon_sym_LBRACK] = ACTIONS(53),
-    [anon_sym_LPAREN] = ACTIONS(53),
-    [anon_sym_PLUS_PLUS] = ACTIONS(53),
-    [anon_sym_DASH_DASH] = ACTIONS(53),
-    [anon_sym_not] = ACTIONS(53),
-    [anon_sym_DASH] = ACTIONS(55),
-    [anon_sym_PLUS] = ACTIONS(55),
-    [anon_sym_STAR] = ACTIONS(53),
-    [anon_sym_SLASH] = ACTIONS(55),
-    [anon_sym_LT] = ACTIONS(55),
-    [anon_sym_GT] = ACTIONS(55),
-    [anon_sym_LT_EQ] = ACTIONS(53),
-    [anon_sym_GT_EQ] = ACTIONS(53),
-    [anon_sym_EQ_EQ] = ACTIONS(53),
-    [anon_sym_BANG_EQ] = ACTIONS(53),
-    [anon_sym_and] = ACTIONS(53),
-    [anon_sym_or] = ACTIONS(53),
-    [anon_sym_EQ] = ACTIONS(55),
-    [anon_sym_COMMA] = ACTIONS(53),
-    [sym_number] = ACTIONS(55),
-    [sym_float] = ACTIONS(53),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(53),
-  },
-  [STATE(4)] = {
-    [sym_comment] = STATE(4),
-    [ts_builtin_sym_end] = ACTIONS(29),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(31),
-    [anon_sym_PLUS] = ACTIONS(31),
-    [anon_sym_STAR] = ACTIONS(29),
-    [anon_sym_SLASH] = ACTIONS(31),
-    [anon_sym_LT] = ACTIONS(31),
-    [anon_sym_GT] = ACTIONS(31),
-    [anon_sym_LT_EQ] = ACTIONS(29),
-    [anon_sym_GT_EQ] = ACTIONS(29),
-    [anon_sym_EQ_EQ] = ACTIONS(29),
-    [anon_sym_BANG_EQ] = ACTIONS(29),
-    [anon_sym_and] = ACTIONS(29),
-    [anon_sym_or] = ACTIONS(29),
-    [anon_sym_EQ] = ACTIONS(31),
-    [anon_sym_COMMA] = ACTIONS(29),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(5)] = {
-    [sym_comment] = STATE(5),
-    [ts_builtin_sym_end] = ACTIONS(57),
-    [sym_id] = ACTIONS(59),
-    [anon_sym_struct] = ACTIONS(57),
-    [anon_sym_globals] = ACTIONS(57),
-    [anon_sym_loop] = ACTIONS(57),
-    [anon_sym_DOT] = ACTIONS(59),
-    [anon_sym_LBRACK] = ACTIONS(57),
-    [anon_sym_LPAREN] = ACTIONS(57),
-    [anon_sym_PLUS_PLUS] = ACTIONS(57),
-    [anon_sym_DASH_DASH] = ACTIONS(57),
-    [anon_sym_not] = ACTIONS(57),
-    [anon_sym_DASH] = ACTIONS(59),
-    [anon_sym_PLUS] = ACTIONS(59),
-    [anon_sym_STAR] = ACTIONS(57),
-    [anon_sym_SLASH] = ACTIONS(59),
-    [anon_sym_LT] = ACTIONS(59),
-    [anon_sym_GT] = ACTIONS(59),
-    [anon_sym_LT_EQ] = ACTIONS(57),
-    [anon_sym_GT_EQ] = ACTIONS(57),
-    [anon_sym_EQ_EQ] = ACTIONS(57),
-    [anon_sym_BANG_EQ] = ACTIONS(57),
-    [anon_sym_and] = ACTIONS(57),
-    [anon_sym_or] = ACTIONS(57),
-    [anon_sym_EQ] = ACTIONS(59),
-    [anon_sym_COMMA] = ACTIONS(57),
-    [sym_number] = ACTIONS(59),
-    [sym_float] = ACTIONS(57),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(57),
-  },
-  [STATE(6)] = {
-    [sym_comment] = STATE(6),
-    [ts_builtin_sym_end] = ACTIONS(61),
-    [sym_id] = ACTIONS(63),
-    [anon_sym_struct] = ACTIONS(61),
-    [anon_sym_globals] = ACTIONS(61),
-    [anon_sym_loop] = ACTIONS(61),
-    [anon_sym_DOT] = ACTIONS(63),
-    [anon_sym_LBRACK] = ACTIONS(61),
-    [anon_sym_LPAREN] = ACTIONS(61),
-    [anon_sym_PLUS_PLUS] = ACTIONS(61),
-    [anon_sym_DASH_DASH] = ACTIONS(61),
-    [anon_sym_not] = ACTIONS(61),
-    [anon_sym_DASH] = ACTIONS(63),
-    [anon_sym_PLUS] = ACTIONS(63),
-    [anon_sym_STAR] = ACTIONS(61),
-    [anon_sym_SLASH] = ACTIONS(63),
-    [anon_sym_LT] = ACTIONS(63),
-    [anon_sym_GT] = ACTIONS(63),
-    [anon_sym_LT_EQ] = ACTIONS(61),
-    [anon_sym_GT_EQ] = ACTIONS(61),
-    [anon_sym_EQ_EQ] = ACTIONS(61),
-    [anon_sym_BANG_EQ] = ACTIONS(61),
-    [anon_sym_and] = ACTIONS(61),
-    [anon_sym_or] = ACTIONS(61),
-    [anon_sym_EQ] = ACTIONS(63),
-    [anon_sym_COMMA] = ACTIONS(61),
-    [sym_number] = ACTIONS(63),
-    [sym_float] = ACTIONS(61),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(61),
-  },
-  [STATE(7)] = {
-    [sym_comment] = STATE(7),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(8)] = {
-    [sym_comment] = STATE(8),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(33),
-    [anon_sym_PLUS] = ACTIONS(33),
-    [anon_sym_STAR] = ACTIONS(35),
-    [anon_sym_SLASH] = ACTIONS(37),
-    [anon_sym_LT] = ACTIONS(39),
-    [anon_sym_GT] = ACTIONS(39),
-    [anon_sym_LT_EQ] = ACTIONS(41),
-    [anon_sym_GT_EQ] = ACTIONS(41),
-    [anon_sym_EQ_EQ] = ACTIONS(43),
-    [anon_sym_BANG_EQ] = ACTIONS(43),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(9)] = {
-    [sym_comment] = STATE(9),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(39),
-    [anon_sym_GT] = ACTIONS(39),
-    [anon_sym_LT_EQ] = ACTIONS(41),
-    [anon_sym_GT_EQ] = ACTIONS(41),
-    [anon_sym_EQ_EQ] = ACTIONS(43),
-    [anon_sym_BANG_EQ] = ACTIONS(43),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(10)] = {
-    [sym_comment] = STATE(10),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(33),
-    [anon_sym_PLUS] = ACTIONS(33),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(39),
-    [anon_sym_GT] = ACTIONS(39),
-    [anon_sym_LT_EQ] = ACTIONS(41),
-    [anon_sym_GT_EQ] = ACTIONS(41),
-    [anon_sym_EQ_EQ] = ACTIONS(43),
-    [anon_sym_BANG_EQ] = ACTIONS(43),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(11)] = {
-    [sym_comment] = STATE(11),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(43),
-    [anon_sym_BANG_EQ] = ACTIONS(43),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(12)] = {
-    [sym_comment] = STATE(12),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(13)] = {
-    [sym_comment] = STATE(13),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(14)] = {
-    [sym_comment] = STATE(14),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(15)] = {
-    [sym_comment] = STATE(15),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(16)] = {
-    [sym_comment] = STATE(16),
-    [ts_builtin_sym_end] = ACTIONS(65),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(17)] = {
-    [sym_comment] = STATE(17),
-    [sym_id] = ACTIONS(59),
-    [anon_sym_struct] = ACTIONS(57),
-    [anon_sym_endstruct] = ACTIONS(57),
-    [anon_sym_globals] = ACTIONS(57),
-    [anon_sym_loop] = ACTIONS(57),
-    [anon_sym_DOT] = ACTIONS(59),
-    [anon_sym_LBRACK] = ACTIONS(57),
-    [anon_sym_LPAREN] = ACTIONS(57),
-    [anon_sym_PLUS_PLUS] = ACTIONS(57),
-    [anon_sym_DASH_DASH] = ACTIONS(57),
-    [anon_sym_not] = ACTIONS(57),
-    [anon_sym_DASH] = ACTIONS(59),
-    [anon_sym_PLUS] = ACTIONS(59),
-    [anon_sym_STAR] = ACTIONS(57),
-    [anon_sym_SLASH] = ACTIONS(59),
-    [anon_sym_LT] = ACTIONS(59),
-    [anon_sym_GT] = ACTIONS(59),
-    [anon_sym_LT_EQ] = ACTIONS(57),
-    [anon_sym_GT_EQ] = ACTIONS(57),
-    [anon_sym_EQ_EQ] = ACTIONS(57),
-    [anon_sym_BANG_EQ] = ACTIONS(57),
-    [anon_sym_and] = ACTIONS(57),
-    [anon_sym_or] = ACTIONS(57),
-    [anon_sym_EQ] = ACTIONS(59),
-    [anon_sym_COMMA] = ACTIONS(57),
-    [sym_number] = ACTIONS(59),
-    [sym_float] = ACTIONS(57),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(57),
-  },
-  [STATE(18)] = {
-    [sym_comment] = STATE(18),
-    [sym_id] = ACTIONS(69),
-    [anon_sym_struct] = ACTIONS(71),
-    [anon_sym_endstruct] = ACTIONS(71),
-    [anon_sym_globals] = ACTIONS(71),
-    [anon_sym_loop] = ACTIONS(71),
-    [anon_sym_DOT] = ACTIONS(73),
-    [anon_sym_LBRACK] = ACTIONS(71),
-    [anon_sym_LPAREN] = ACTIONS(71),
-    [anon_sym_PLUS_PLUS] = ACTIONS(75),
-    [anon_sym_DASH_DASH] = ACTIONS(71),
-    [anon_sym_not] = ACTIONS(71),
-    [anon_sym_DASH] = ACTIONS(77),
-    [anon_sym_PLUS] = ACTIONS(77),
-    [anon_sym_STAR] = ACTIONS(79),
-    [anon_sym_SLASH] = ACTIONS(81),
-    [anon_sym_LT] = ACTIONS(83),
-    [anon_sym_GT] = ACTIONS(83),
-    [anon_sym_LT_EQ] = ACTIONS(85),
-    [anon_sym_GT_EQ] = ACTIONS(85),
-    [anon_sym_EQ_EQ] = ACTIONS(87),
-    [anon_sym_BANG_EQ] = ACTIONS(87),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(69),
-    [sym_float] = ACTIONS(71),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(71),
-  },
-  [STATE(19)] = {
-    [sym_comment] = STATE(19),
-    [sym_id] = ACTIONS(55),
-    [anon_sym_struct] = ACTIONS(53),
-    [anon_sym_endstruct] = ACTIONS(53),
-    [anon_sym_globals] = ACTIONS(53),
-    [anon_sym_loop] = ACTIONS(53),
-    [anon_sym_DOT] = ACTIONS(55),
-    [anon_sym_LBRACK] = ACTIONS(53),
-    [anon_sym_LPAREN] = ACTIONS(53),
-    [anon_sym_PLUS_PLUS] = ACTIONS(53),
-    [anon_sym_DASH_DASH] = ACTIONS(53),
-    [anon_sym_not] = ACTIONS(53),
-    [anon_sym_DASH] = ACTIONS(55),
-    [anon_sym_PLUS] = ACTIONS(55),
-    [anon_sym_STAR] = ACTIONS(53),
-    [anon_sym_SLASH] = ACTIONS(55),
-    [anon_sym_LT] = ACTIONS(55),
-    [anon_sym_GT] = ACTIONS(55),
-    [anon_sym_LT_EQ] = ACTIONS(53),
-    [anon_sym_GT_EQ] = ACTIONS(53),
-    [anon_sym_EQ_EQ] = ACTIONS(53),
-    [anon_sym_BANG_EQ] = ACTIONS(53),
-    [anon_sym_and] = ACTIONS(53),
-    [anon_sym_or] = ACTIONS(53),
-    [anon_sym_EQ] = ACTIONS(55),
-    [anon_sym_COMMA] = ACTIONS(53),
-    [sym_number] = ACTIONS(55),
-    [sym_float] = ACTIONS(53),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(53),
-  },
-  [STATE(20)] = {
-    [sym_comment] = STATE(20),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_endstruct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(31),
-    [anon_sym_PLUS] = ACTIONS(31),
-    [anon_sym_STAR] = ACTIONS(29),
-    [anon_sym_SLASH] = ACTIONS(31),
-    [anon_sym_LT] = ACTIONS(31),
-    [anon_sym_GT] = ACTIONS(31),
-    [anon_sym_LT_EQ] = ACTIONS(29),
-    [anon_sym_GT_EQ] = ACTIONS(29),
-    [anon_sym_EQ_EQ] = ACTIONS(29),
-    [anon_sym_BANG_EQ] = ACTIONS(29),
-    [anon_sym_and] = ACTIONS(29),
-    [anon_sym_or] = ACTIONS(29),
-    [anon_sym_EQ] = ACTIONS(31),
-    [anon_sym_COMMA] = ACTIONS(29),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(21)] = {
-    [sym_comment] = STATE(21),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_endstruct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(77),
-    [anon_sym_PLUS] = ACTIONS(77),
-    [anon_sym_STAR] = ACTIONS(79),
-    [anon_sym_SLASH] = ACTIONS(81),
-    [anon_sym_LT] = ACTIONS(83),
-    [anon_sym_GT] = ACTIONS(83),
-    [anon_sym_LT_EQ] = ACTIONS(85),
-    [anon_sym_GT_EQ] = ACTIONS(85),
-    [anon_sym_EQ_EQ] = ACTIONS(87),
-    [anon_sym_BANG_EQ] = ACTIONS(87),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(22)] = {
-    [sym_comment] = STATE(22),
-    [sym_id] = ACTIONS(63),
-    [anon_sym_struct] = ACTIONS(61),
-    [anon_sym_endstruct] = ACTIONS(61),
-    [anon_sym_globals] = ACTIONS(61),
-    [anon_sym_loop] = ACTIONS(61),
-    [anon_sym_DOT] = ACTIONS(63),
-    [anon_sym_LBRACK] = ACTIONS(61),
-    [anon_sym_LPAREN] = ACTIONS(61),
-    [anon_sym_PLUS_PLUS] = ACTIONS(61),
-    [anon_sym_DASH_DASH] = ACTIONS(61),
-    [anon_sym_not] = ACTIONS(61),
-    [anon_sym_DASH] = ACTIONS(63),
-    [anon_sym_PLUS] = ACTIONS(63),
-    [anon_sym_STAR] = ACTIONS(61),
-    [anon_sym_SLASH] = ACTIONS(63),
-    [anon_sym_LT] = ACTIONS(63),
-    [anon_sym_GT] = ACTIONS(63),
-    [anon_sym_LT_EQ] = ACTIONS(61),
-    [anon_sym_GT_EQ] = ACTIONS(61),
-    [anon_sym_EQ_EQ] = ACTIONS(61),
-    [anon_sym_BANG_EQ] = ACTIONS(61),
-    [anon_sym_and] = ACTIONS(61),
-    [anon_sym_or] = ACTIONS(61),
-    [anon_sym_EQ] = ACTIONS(63),
-    [anon_sym_COMMA] = ACTIONS(61),
-    [sym_number] = ACTIONS(63),
-    [sym_float] = ACTIONS(61),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(61),
-  },
-  [STATE(23)] = {
-    [sym_comment] = STATE(23),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(24)] = {
-    [sym_comment] = STATE(24),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(77),
-    [anon_sym_PLUS] = ACTIONS(77),
-    [anon_sym_STAR] = ACTIONS(79),
-    [anon_sym_SLASH] = ACTIONS(81),
-    [anon_sym_LT] = ACTIONS(83),
-    [anon_sym_GT] = ACTIONS(83),
-    [anon_sym_LT_EQ] = ACTIONS(85),
-    [anon_sym_GT_EQ] = ACTIONS(85),
-    [anon_sym_EQ_EQ] = ACTIONS(87),
-    [anon_sym_BANG_EQ] = ACTIONS(87),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(25)] = {
-    [sym_comment] = STATE(25),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(83),
-    [anon_sym_GT] = ACTIONS(83),
-    [anon_sym_LT_EQ] = ACTIONS(85),
-    [anon_sym_GT_EQ] = ACTIONS(85),
-    [anon_sym_EQ_EQ] = ACTIONS(87),
-    [anon_sym_BANG_EQ] = ACTIONS(87),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(26)] = {
-    [sym_comment] = STATE(26),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(77),
-    [anon_sym_PLUS] = ACTIONS(77),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(83),
-    [anon_sym_GT] = ACTIONS(83),
-    [anon_sym_LT_EQ] = ACTIONS(85),
-    [anon_sym_GT_EQ] = ACTIONS(85),
-    [anon_sym_EQ_EQ] = ACTIONS(87),
-    [anon_sym_BANG_EQ] = ACTIONS(87),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(27)] = {
-    [sym_comment] = STATE(27),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(87),
-    [anon_sym_BANG_EQ] = ACTIONS(87),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(28)] = {
-    [sym_comment] = STATE(28),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(91),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(29)] = {
-    [sym_comment] = STATE(29),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(30)] = {
-    [sym_comment] = STATE(30),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(89),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(31)] = {
-    [sym_comment] = STATE(31),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(93),
-    [anon_sym_COMMA] = ACTIONS(95),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(32)] = {
-    [sym_comment] = STATE(32),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_endstruct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(33)] = {
-    [sym_comment] = STATE(33),
-    [sym_id] = ACTIONS(59),
-    [anon_sym_struct] = ACTIONS(57),
-    [anon_sym_globals] = ACTIONS(57),
-    [anon_sym_endglobals] = ACTIONS(57),
-    [anon_sym_loop] = ACTIONS(57),
-    [anon_sym_DOT] = ACTIONS(59),
-    [anon_sym_LBRACK] = ACTIONS(57),
-    [anon_sym_LPAREN] = ACTIONS(57),
-    [anon_sym_PLUS_PLUS] = ACTIONS(57),
-    [anon_sym_DASH_DASH] = ACTIONS(57),
-    [anon_sym_not] = ACTIONS(57),
-    [anon_sym_DASH] = ACTIONS(59),
-    [anon_sym_PLUS] = ACTIONS(59),
-    [anon_sym_STAR] = ACTIONS(57),
-    [anon_sym_SLASH] = ACTIONS(59),
-    [anon_sym_LT] = ACTIONS(59),
-    [anon_sym_GT] = ACTIONS(59),
-    [anon_sym_LT_EQ] = ACTIONS(57),
-    [anon_sym_GT_EQ] = ACTIONS(57),
-    [anon_sym_EQ_EQ] = ACTIONS(57),
-    [anon_sym_BANG_EQ] = ACTIONS(57),
-    [anon_sym_and] = ACTIONS(57),
-    [anon_sym_or] = ACTIONS(57),
-    [anon_sym_EQ] = ACTIONS(59),
-    [anon_sym_COMMA] = ACTIONS(57),
-    [sym_number] = ACTIONS(59),
-    [sym_float] = ACTIONS(57),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(57),
-  },
-  [STATE(34)] = {
-    [sym_comment] = STATE(34),
-    [sym_id] = ACTIONS(69),
-    [anon_sym_struct] = ACTIONS(71),
-    [anon_sym_globals] = ACTIONS(71),
-    [anon_sym_endglobals] = ACTIONS(71),
-    [anon_sym_loop] = ACTIONS(71),
-    [anon_sym_DOT] = ACTIONS(97),
-    [anon_sym_LBRACK] = ACTIONS(71),
-    [anon_sym_LPAREN] = ACTIONS(71),
-    [anon_sym_PLUS_PLUS] = ACTIONS(99),
-    [anon_sym_DASH_DASH] = ACTIONS(71),
-    [anon_sym_not] = ACTIONS(71),
-    [anon_sym_DASH] = ACTIONS(101),
-    [anon_sym_PLUS] = ACTIONS(101),
-    [anon_sym_STAR] = ACTIONS(103),
-    [anon_sym_SLASH] = ACTIONS(105),
-    [anon_sym_LT] = ACTIONS(107),
-    [anon_sym_GT] = ACTIONS(107),
-    [anon_sym_LT_EQ] = ACTIONS(109),
-    [anon_sym_GT_EQ] = ACTIONS(109),
-    [anon_sym_EQ_EQ] = ACTIONS(111),
-    [anon_sym_BANG_EQ] = ACTIONS(111),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(69),
-    [sym_float] = ACTIONS(71),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(71),
-  },
-  [STATE(35)] = {
-    [sym_comment] = STATE(35),
-    [sym_id] = ACTIONS(55),
-    [anon_sym_struct] = ACTIONS(53),
-    [anon_sym_globals] = ACTIONS(53),
-    [anon_sym_endglobals] = ACTIONS(53),
-    [anon_sym_loop] = ACTIONS(53),
-    [anon_sym_DOT] = ACTIONS(55),
-    [anon_sym_LBRACK] = ACTIONS(53),
-    [anon_sym_LPAREN] = ACTIONS(53),
-    [anon_sym_PLUS_PLUS] = ACTIONS(53),
-    [anon_sym_DASH_DASH] = ACTIONS(53),
-    [anon_sym_not] = ACTIONS(53),
-    [anon_sym_DASH] = ACTIONS(55),
-    [anon_sym_PLUS] = ACTIONS(55),
-    [anon_sym_STAR] = ACTIONS(53),
-    [anon_sym_SLASH] = ACTIONS(55),
-    [anon_sym_LT] = ACTIONS(55),
-    [anon_sym_GT] = ACTIONS(55),
-    [anon_sym_LT_EQ] = ACTIONS(53),
-    [anon_sym_GT_EQ] = ACTIONS(53),
-    [anon_sym_EQ_EQ] = ACTIONS(53),
-    [anon_sym_BANG_EQ] = ACTIONS(53),
-    [anon_sym_and] = ACTIONS(53),
-    [anon_sym_or] = ACTIONS(53),
-    [anon_sym_EQ] = ACTIONS(55),
-    [anon_sym_COMMA] = ACTIONS(53),
-    [sym_number] = ACTIONS(55),
-    [sym_float] = ACTIONS(53),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(53),
-  },
-  [STATE(36)] = {
-    [sym_comment] = STATE(36),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_endglobals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(31),
-    [anon_sym_PLUS] = ACTIONS(31),
-    [anon_sym_STAR] = ACTIONS(29),
-    [anon_sym_SLASH] = ACTIONS(31),
-    [anon_sym_LT] = ACTIONS(31),
-    [anon_sym_GT] = ACTIONS(31),
-    [anon_sym_LT_EQ] = ACTIONS(29),
-    [anon_sym_GT_EQ] = ACTIONS(29),
-    [anon_sym_EQ_EQ] = ACTIONS(29),
-    [anon_sym_BANG_EQ] = ACTIONS(29),
-    [anon_sym_and] = ACTIONS(29),
-    [anon_sym_or] = ACTIONS(29),
-    [anon_sym_EQ] = ACTIONS(31),
-    [anon_sym_COMMA] = ACTIONS(29),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(37)] = {
-    [sym_comment] = STATE(37),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_endglobals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(101),
-    [anon_sym_PLUS] = ACTIONS(101),
-    [anon_sym_STAR] = ACTIONS(103),
-    [anon_sym_SLASH] = ACTIONS(105),
-    [anon_sym_LT] = ACTIONS(107),
-    [anon_sym_GT] = ACTIONS(107),
-    [anon_sym_LT_EQ] = ACTIONS(109),
-    [anon_sym_GT_EQ] = ACTIONS(109),
-    [anon_sym_EQ_EQ] = ACTIONS(111),
-    [anon_sym_BANG_EQ] = ACTIONS(111),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(38)] = {
-    [sym_comment] = STATE(38),
-    [sym_id] = ACTIONS(63),
-    [anon_sym_struct] = ACTIONS(61),
-    [anon_sym_globals] = ACTIONS(61),
-    [anon_sym_endglobals] = ACTIONS(61),
-    [anon_sym_loop] = ACTIONS(61),
-    [anon_sym_DOT] = ACTIONS(63),
-    [anon_sym_LBRACK] = ACTIONS(61),
-    [anon_sym_LPAREN] = ACTIONS(61),
-    [anon_sym_PLUS_PLUS] = ACTIONS(61),
-    [anon_sym_DASH_DASH] = ACTIONS(61),
-    [anon_sym_not] = ACTIONS(61),
-    [anon_sym_DASH] = ACTIONS(63),
-    [anon_sym_PLUS] = ACTIONS(63),
-    [anon_sym_STAR] = ACTIONS(61),
-    [anon_sym_SLASH] = ACTIONS(63),
-    [anon_sym_LT] = ACTIONS(63),
-    [anon_sym_GT] = ACTIONS(63),
-    [anon_sym_LT_EQ] = ACTIONS(61),
-    [anon_sym_GT_EQ] = ACTIONS(61),
-    [anon_sym_EQ_EQ] = ACTIONS(61),
-    [anon_sym_BANG_EQ] = ACTIONS(61),
-    [anon_sym_and] = ACTIONS(61),
-    [anon_sym_or] = ACTIONS(61),
-    [anon_sym_EQ] = ACTIONS(63),
-    [anon_sym_COMMA] = ACTIONS(61),
-    [sym_number] = ACTIONS(63),
-    [sym_float] = ACTIONS(61),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(61),
-  },
-  [STATE(39)] = {
-    [sym_comment] = STATE(39),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(40)] = {
-    [sym_comment] = STATE(40),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(101),
-    [anon_sym_PLUS] = ACTIONS(101),
-    [anon_sym_STAR] = ACTIONS(103),
-    [anon_sym_SLASH] = ACTIONS(105),
-    [anon_sym_LT] = ACTIONS(107),
-    [anon_sym_GT] = ACTIONS(107),
-    [anon_sym_LT_EQ] = ACTIONS(109),
-    [anon_sym_GT_EQ] = ACTIONS(109),
-    [anon_sym_EQ_EQ] = ACTIONS(111),
-    [anon_sym_BANG_EQ] = ACTIONS(111),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(41)] = {
-    [sym_comment] = STATE(41),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(107),
-    [anon_sym_GT] = ACTIONS(107),
-    [anon_sym_LT_EQ] = ACTIONS(109),
-    [anon_sym_GT_EQ] = ACTIONS(109),
-    [anon_sym_EQ_EQ] = ACTIONS(111),
-    [anon_sym_BANG_EQ] = ACTIONS(111),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(42)] = {
-    [sym_comment] = STATE(42),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(101),
-    [anon_sym_PLUS] = ACTIONS(101),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(107),
-    [anon_sym_GT] = ACTIONS(107),
-    [anon_sym_LT_EQ] = ACTIONS(109),
-    [anon_sym_GT_EQ] = ACTIONS(109),
-    [anon_sym_EQ_EQ] = ACTIONS(111),
-    [anon_sym_BANG_EQ] = ACTIONS(111),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(43)] = {
-    [sym_comment] = STATE(43),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(111),
-    [anon_sym_BANG_EQ] = ACTIONS(111),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(44)] = {
-    [sym_comment] = STATE(44),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(115),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(45)] = {
-    [sym_comment] = STATE(45),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(46)] = {
-    [sym_comment] = STATE(46),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(113),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(47)] = {
-    [sym_comment] = STATE(47),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(117),
-    [anon_sym_COMMA] = ACTIONS(119),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(48)] = {
-    [sym_comment] = STATE(48),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_endglobals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(49)] = {
-    [sym_comment] = STATE(49),
-    [sym_id] = ACTIONS(59),
-    [anon_sym_struct] = ACTIONS(57),
-    [anon_sym_globals] = ACTIONS(57),
-    [anon_sym_loop] = ACTIONS(57),
-    [anon_sym_endloop] = ACTIONS(57),
-    [anon_sym_DOT] = ACTIONS(59),
-    [anon_sym_LBRACK] = ACTIONS(57),
-    [anon_sym_LPAREN] = ACTIONS(57),
-    [anon_sym_PLUS_PLUS] = ACTIONS(57),
-    [anon_sym_DASH_DASH] = ACTIONS(57),
-    [anon_sym_not] = ACTIONS(57),
-    [anon_sym_DASH] = ACTIONS(59),
-    [anon_sym_PLUS] = ACTIONS(59),
-    [anon_sym_STAR] = ACTIONS(57),
-    [anon_sym_SLASH] = ACTIONS(59),
-    [anon_sym_LT] = ACTIONS(59),
-    [anon_sym_GT] = ACTIONS(59),
-    [anon_sym_LT_EQ] = ACTIONS(57),
-    [anon_sym_GT_EQ] = ACTIONS(57),
-    [anon_sym_EQ_EQ] = ACTIONS(57),
-    [anon_sym_BANG_EQ] = ACTIONS(57),
-    [anon_sym_and] = ACTIONS(57),
-    [anon_sym_or] = ACTIONS(57),
-    [anon_sym_EQ] = ACTIONS(59),
-    [anon_sym_COMMA] = ACTIONS(57),
-    [sym_number] = ACTIONS(59),
-    [sym_float] = ACTIONS(57),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(57),
-  },
-  [STATE(50)] = {
-    [sym_comment] = STATE(50),
-    [sym_id] = ACTIONS(69),
-    [anon_sym_struct] = ACTIONS(71),
-    [anon_sym_globals] = ACTIONS(71),
-    [anon_sym_loop] = ACTIONS(71),
-    [anon_sym_endloop] = ACTIONS(71),
-    [anon_sym_DOT] = ACTIONS(121),
-    [anon_sym_LBRACK] = ACTIONS(71),
-    [anon_sym_LPAREN] = ACTIONS(71),
-    [anon_sym_PLUS_PLUS] = ACTIONS(123),
-    [anon_sym_DASH_DASH] = ACTIONS(71),
-    [anon_sym_not] = ACTIONS(71),
-    [anon_sym_DASH] = ACTIONS(125),
-    [anon_sym_PLUS] = ACTIONS(125),
-    [anon_sym_STAR] = ACTIONS(127),
-    [anon_sym_SLASH] = ACTIONS(129),
-    [anon_sym_LT] = ACTIONS(131),
-    [anon_sym_GT] = ACTIONS(131),
-    [anon_sym_LT_EQ] = ACTIONS(133),
-    [anon_sym_GT_EQ] = ACTIONS(133),
-    [anon_sym_EQ_EQ] = ACTIONS(135),
-    [anon_sym_BANG_EQ] = ACTIONS(135),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(69),
-    [sym_float] = ACTIONS(71),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(71),
-  },
-  [STATE(51)] = {
-    [sym_comment] = STATE(51),
-    [sym_id] = ACTIONS(55),
-    [anon_sym_struct] = ACTIONS(53),
-    [anon_sym_globals] = ACTIONS(53),
-    [anon_sym_loop] = ACTIONS(53),
-    [anon_sym_endloop] = ACTIONS(53),
-    [anon_sym_DOT] = ACTIONS(55),
-    [anon_sym_LBRACK] = ACTIONS(53),
-    [anon_sym_LPAREN] = ACTIONS(53),
-    [anon_sym_PLUS_PLUS] = ACTIONS(53),
-    [anon_sym_DASH_DASH] = ACTIONS(53),
-    [anon_sym_not] = ACTIONS(53),
-    [anon_sym_DASH] = ACTIONS(55),
-    [anon_sym_PLUS] = ACTIONS(55),
-    [anon_sym_STAR] = ACTIONS(53),
-    [anon_sym_SLASH] = ACTIONS(55),
-    [anon_sym_LT] = ACTIONS(55),
-    [anon_sym_GT] = ACTIONS(55),
-    [anon_sym_LT_EQ] = ACTIONS(53),
-    [anon_sym_GT_EQ] = ACTIONS(53),
-    [anon_sym_EQ_EQ] = ACTIONS(53),
-    [anon_sym_BANG_EQ] = ACTIONS(53),
-    [anon_sym_and] = ACTIONS(53),
-    [anon_sym_or] = ACTIONS(53),
-    [anon_sym_EQ] = ACTIONS(55),
-    [anon_sym_COMMA] = ACTIONS(53),
-    [sym_number] = ACTIONS(55),
-    [sym_float] = ACTIONS(53),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(53),
-  },
-  [STATE(52)] = {
-    [sym_comment] = STATE(52),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_endloop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(31),
-    [anon_sym_PLUS] = ACTIONS(31),
-    [anon_sym_STAR] = ACTIONS(29),
-    [anon_sym_SLASH] = ACTIONS(31),
-    [anon_sym_LT] = ACTIONS(31),
-    [anon_sym_GT] = ACTIONS(31),
-    [anon_sym_LT_EQ] = ACTIONS(29),
-    [anon_sym_GT_EQ] = ACTIONS(29),
-    [anon_sym_EQ_EQ] = ACTIONS(29),
-    [anon_sym_BANG_EQ] = ACTIONS(29),
-    [anon_sym_and] = ACTIONS(29),
-    [anon_sym_or] = ACTIONS(29),
-    [anon_sym_EQ] = ACTIONS(31),
-    [anon_sym_COMMA] = ACTIONS(29),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(53)] = {
-    [sym_comment] = STATE(53),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_struct] = ACTIONS(29),
-    [anon_sym_globals] = ACTIONS(29),
-    [anon_sym_loop] = ACTIONS(29),
-    [anon_sym_endloop] = ACTIONS(29),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(125),
-    [anon_sym_PLUS] = ACTIONS(125),
-    [anon_sym_STAR] = ACTIONS(127),
-    [anon_sym_SLASH] = ACTIONS(129),
-    [anon_sym_LT] = ACTIONS(131),
-    [anon_sym_GT] = ACTIONS(131),
-    [anon_sym_LT_EQ] = ACTIONS(133),
-    [anon_sym_GT_EQ] = ACTIONS(133),
-    [anon_sym_EQ_EQ] = ACTIONS(135),
-    [anon_sym_BANG_EQ] = ACTIONS(135),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(54)] = {
-    [sym_comment] = STATE(54),
-    [sym_id] = ACTIONS(63),
-    [anon_sym_struct] = ACTIONS(61),
-    [anon_sym_globals] = ACTIONS(61),
-    [anon_sym_loop] = ACTIONS(61),
-    [anon_sym_endloop] = ACTIONS(61),
-    [anon_sym_DOT] = ACTIONS(63),
-    [anon_sym_LBRACK] = ACTIONS(61),
-    [anon_sym_LPAREN] = ACTIONS(61),
-    [anon_sym_PLUS_PLUS] = ACTIONS(61),
-    [anon_sym_DASH_DASH] = ACTIONS(61),
-    [anon_sym_not] = ACTIONS(61),
-    [anon_sym_DASH] = ACTIONS(63),
-    [anon_sym_PLUS] = ACTIONS(63),
-    [anon_sym_STAR] = ACTIONS(61),
-    [anon_sym_SLASH] = ACTIONS(63),
-    [anon_sym_LT] = ACTIONS(63),
-    [anon_sym_GT] = ACTIONS(63),
-    [anon_sym_LT_EQ] = ACTIONS(61),
-    [anon_sym_GT_EQ] = ACTIONS(61),
-    [anon_sym_EQ_EQ] = ACTIONS(61),
-    [anon_sym_BANG_EQ] = ACTIONS(61),
-    [anon_sym_and] = ACTIONS(61),
-    [anon_sym_or] = ACTIONS(61),
-    [anon_sym_EQ] = ACTIONS(63),
-    [anon_sym_COMMA] = ACTIONS(61),
-    [sym_number] = ACTIONS(63),
-    [sym_float] = ACTIONS(61),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(61),
-  },
-  [STATE(55)] = {
-    [sym_comment] = STATE(55),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(56)] = {
-    [sym_comment] = STATE(56),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(125),
-    [anon_sym_PLUS] = ACTIONS(125),
-    [anon_sym_STAR] = ACTIONS(127),
-    [anon_sym_SLASH] = ACTIONS(129),
-    [anon_sym_LT] = ACTIONS(131),
-    [anon_sym_GT] = ACTIONS(131),
-    [anon_sym_LT_EQ] = ACTIONS(133),
-    [anon_sym_GT_EQ] = ACTIONS(133),
-    [anon_sym_EQ_EQ] = ACTIONS(135),
-    [anon_sym_BANG_EQ] = ACTIONS(135),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(57)] = {
-    [sym_comment] = STATE(57),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(131),
-    [anon_sym_GT] = ACTIONS(131),
-    [anon_sym_LT_EQ] = ACTIONS(133),
-    [anon_sym_GT_EQ] = ACTIONS(133),
-    [anon_sym_EQ_EQ] = ACTIONS(135),
-    [anon_sym_BANG_EQ] = ACTIONS(135),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(58)] = {
-    [sym_comment] = STATE(58),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(125),
-    [anon_sym_PLUS] = ACTIONS(125),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(131),
-    [anon_sym_GT] = ACTIONS(131),
-    [anon_sym_LT_EQ] = ACTIONS(133),
-    [anon_sym_GT_EQ] = ACTIONS(133),
-    [anon_sym_EQ_EQ] = ACTIONS(135),
-    [anon_sym_BANG_EQ] = ACTIONS(135),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(59)] = {
-    [sym_comment] = STATE(59),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(135),
-    [anon_sym_BANG_EQ] = ACTIONS(135),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(60)] = {
-    [sym_comment] = STATE(60),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(139),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(61)] = {
-    [sym_comment] = STATE(61),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(62)] = {
-    [sym_comment] = STATE(62),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(137),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(63)] = {
-    [sym_comment] = STATE(63),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(141),
-    [anon_sym_COMMA] = ACTIONS(143),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(64)] = {
-    [sym_comment] = STATE(64),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_struct] = ACTIONS(65),
-    [anon_sym_globals] = ACTIONS(65),
-    [anon_sym_loop] = ACTIONS(65),
-    [anon_sym_endloop] = ACTIONS(65),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(65)] = {
-    [sym_comment] = STATE(65),
-    [ts_builtin_sym_end] = ACTIONS(71),
-    [sym_id] = ACTIONS(69),
-    [anon_sym_struct] = ACTIONS(71),
-    [anon_sym_globals] = ACTIONS(71),
-    [anon_sym_loop] = ACTIONS(71),
-    [anon_sym_DOT] = ACTIONS(145),
-    [anon_sym_LBRACK] = ACTIONS(71),
-    [anon_sym_LPAREN] = ACTIONS(71),
-    [anon_sym_PLUS_PLUS] = ACTIONS(147),
-    [anon_sym_DASH_DASH] = ACTIONS(71),
-    [anon_sym_not] = ACTIONS(71),
-    [anon_sym_DASH] = ACTIONS(33),
-    [anon_sym_PLUS] = ACTIONS(33),
-    [anon_sym_STAR] = ACTIONS(35),
-    [anon_sym_SLASH] = ACTIONS(37),
-    [anon_sym_LT] = ACTIONS(39),
-    [anon_sym_GT] = ACTIONS(39),
-    [anon_sym_LT_EQ] = ACTIONS(41),
-    [anon_sym_GT_EQ] = ACTIONS(41),
-    [anon_sym_EQ_EQ] = ACTIONS(43),
-    [anon_sym_BANG_EQ] = ACTIONS(43),
-    [anon_sym_and] = ACTIONS(45),
-    [anon_sym_or] = ACTIONS(47),
-    [anon_sym_EQ] = ACTIONS(49),
-    [anon_sym_COMMA] = ACTIONS(51),
-    [sym_number] = ACTIONS(69),
-    [sym_float] = ACTIONS(71),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(71),
-  },
-  [STATE(66)] = {
-    [sym_comment] = STATE(66),
-    [sym_id] = ACTIONS(149),
-    [anon_sym_DOT] = ACTIONS(151),
-    [anon_sym_LBRACK] = ACTIONS(153),
-    [anon_sym_LPAREN] = ACTIONS(153),
-    [anon_sym_RPAREN] = ACTIONS(153),
-    [anon_sym_PLUS_PLUS] = ACTIONS(155),
-    [anon_sym_DASH_DASH] = ACTIONS(153),
-    [anon_sym_not] = ACTIONS(153),
-    [anon_sym_DASH] = ACTIONS(157),
-    [anon_sym_PLUS] = ACTIONS(157),
-    [anon_sym_STAR] = ACTIONS(159),
-    [anon_sym_SLASH] = ACTIONS(161),
-    [anon_sym_LT] = ACTIONS(163),
-    [anon_sym_GT] = ACTIONS(163),
-    [anon_sym_LT_EQ] = ACTIONS(165),
-    [anon_sym_GT_EQ] = ACTIONS(165),
-    [anon_sym_EQ_EQ] = ACTIONS(167),
-    [anon_sym_BANG_EQ] = ACTIONS(167),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(149),
-    [sym_float] = ACTIONS(153),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(153),
-  },
-  [STATE(67)] = {
-    [sym_comment] = STATE(67),
-    [sym_id] = ACTIONS(59),
-    [anon_sym_DOT] = ACTIONS(59),
-    [anon_sym_LBRACK] = ACTIONS(57),
-    [anon_sym_LPAREN] = ACTIONS(57),
-    [anon_sym_RPAREN] = ACTIONS(57),
-    [anon_sym_PLUS_PLUS] = ACTIONS(57),
-    [anon_sym_DASH_DASH] = ACTIONS(57),
-    [anon_sym_not] = ACTIONS(57),
-    [anon_sym_DASH] = ACTIONS(59),
-    [anon_sym_PLUS] = ACTIONS(59),
-    [anon_sym_STAR] = ACTIONS(57),
-    [anon_sym_SLASH] = ACTIONS(59),
-    [anon_sym_LT] = ACTIONS(59),
-    [anon_sym_GT] = ACTIONS(59),
-    [anon_sym_LT_EQ] = ACTIONS(57),
-    [anon_sym_GT_EQ] = ACTIONS(57),
-    [anon_sym_EQ_EQ] = ACTIONS(57),
-    [anon_sym_BANG_EQ] = ACTIONS(57),
-    [anon_sym_and] = ACTIONS(57),
-    [anon_sym_or] = ACTIONS(57),
-    [anon_sym_EQ] = ACTIONS(59),
-    [anon_sym_COMMA] = ACTIONS(57),
-    [sym_number] = ACTIONS(59),
-    [sym_float] = ACTIONS(57),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(57),
-  },
-  [STATE(68)] = {
-    [sym_comment] = STATE(68),
-    [sym_id] = ACTIONS(55),
-    [anon_sym_DOT] = ACTIONS(55),
-    [anon_sym_LBRACK] = ACTIONS(53),
-    [anon_sym_LPAREN] = ACTIONS(53),
-    [anon_sym_RPAREN] = ACTIONS(53),
-    [anon_sym_PLUS_PLUS] = ACTIONS(53),
-    [anon_sym_DASH_DASH] = ACTIONS(53),
-    [anon_sym_not] = ACTIONS(53),
-    [anon_sym_DASH] = ACTIONS(55),
-    [anon_sym_PLUS] = ACTIONS(55),
-    [anon_sym_STAR] = ACTIONS(53),
-    [anon_sym_SLASH] = ACTIONS(55),
-    [anon_sym_LT] = ACTIONS(55),
-    [anon_sym_GT] = ACTIONS(55),
-    [anon_sym_LT_EQ] = ACTIONS(53),
-    [anon_sym_GT_EQ] = ACTIONS(53),
-    [anon_sym_EQ_EQ] = ACTIONS(53),
-    [anon_sym_BANG_EQ] = ACTIONS(53),
-    [anon_sym_and] = ACTIONS(53),
-    [anon_sym_or] = ACTIONS(53),
-    [anon_sym_EQ] = ACTIONS(55),
-    [anon_sym_COMMA] = ACTIONS(53),
-    [sym_number] = ACTIONS(55),
-    [sym_float] = ACTIONS(53),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(53),
-  },
-  [STATE(69)] = {
-    [sym_comment] = STATE(69),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_RPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(31),
-    [anon_sym_PLUS] = ACTIONS(31),
-    [anon_sym_STAR] = ACTIONS(29),
-    [anon_sym_SLASH] = ACTIONS(31),
-    [anon_sym_LT] = ACTIONS(31),
-    [anon_sym_GT] = ACTIONS(31),
-    [anon_sym_LT_EQ] = ACTIONS(29),
-    [anon_sym_GT_EQ] = ACTIONS(29),
-    [anon_sym_EQ_EQ] = ACTIONS(29),
-    [anon_sym_BANG_EQ] = ACTIONS(29),
-    [anon_sym_and] = ACTIONS(29),
-    [anon_sym_or] = ACTIONS(29),
-    [anon_sym_EQ] = ACTIONS(31),
-    [anon_sym_COMMA] = ACTIONS(29),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(70)] = {
-    [sym_comment] = STATE(70),
-    [sym_id] = ACTIONS(31),
-    [anon_sym_DOT] = ACTIONS(31),
-    [anon_sym_LBRACK] = ACTIONS(29),
-    [anon_sym_LPAREN] = ACTIONS(29),
-    [anon_sym_RPAREN] = ACTIONS(29),
-    [anon_sym_PLUS_PLUS] = ACTIONS(29),
-    [anon_sym_DASH_DASH] = ACTIONS(29),
-    [anon_sym_not] = ACTIONS(29),
-    [anon_sym_DASH] = ACTIONS(157),
-    [anon_sym_PLUS] = ACTIONS(157),
-    [anon_sym_STAR] = ACTIONS(159),
-    [anon_sym_SLASH] = ACTIONS(161),
-    [anon_sym_LT] = ACTIONS(163),
-    [anon_sym_GT] = ACTIONS(163),
-    [anon_sym_LT_EQ] = ACTIONS(165),
-    [anon_sym_GT_EQ] = ACTIONS(165),
-    [anon_sym_EQ_EQ] = ACTIONS(167),
-    [anon_sym_BANG_EQ] = ACTIONS(167),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(31),
-    [sym_float] = ACTIONS(29),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(29),
-  },
-  [STATE(71)] = {
-    [sym_comment] = STATE(71),
-    [sym_id] = ACTIONS(63),
-    [anon_sym_DOT] = ACTIONS(63),
-    [anon_sym_LBRACK] = ACTIONS(61),
-    [anon_sym_LPAREN] = ACTIONS(61),
-    [anon_sym_RPAREN] = ACTIONS(61),
-    [anon_sym_PLUS_PLUS] = ACTIONS(61),
-    [anon_sym_DASH_DASH] = ACTIONS(61),
-    [anon_sym_not] = ACTIONS(61),
-    [anon_sym_DASH] = ACTIONS(63),
-    [anon_sym_PLUS] = ACTIONS(63),
-    [anon_sym_STAR] = ACTIONS(61),
-    [anon_sym_SLASH] = ACTIONS(63),
-    [anon_sym_LT] = ACTIONS(63),
-    [anon_sym_GT] = ACTIONS(63),
-    [anon_sym_LT_EQ] = ACTIONS(61),
-    [anon_sym_GT_EQ] = ACTIONS(61),
-    [anon_sym_EQ_EQ] = ACTIONS(61),
-    [anon_sym_BANG_EQ] = ACTIONS(61),
-    [anon_sym_and] = ACTIONS(61),
-    [anon_sym_or] = ACTIONS(61),
-    [anon_sym_EQ] = ACTIONS(63),
-    [anon_sym_COMMA] = ACTIONS(61),
-    [sym_number] = ACTIONS(63),
-    [sym_float] = ACTIONS(61),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(61),
-  },
-  [STATE(72)] = {
-    [sym_comment] = STATE(72),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(73)] = {
-    [sym_comment] = STATE(73),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(157),
-    [anon_sym_PLUS] = ACTIONS(157),
-    [anon_sym_STAR] = ACTIONS(159),
-    [anon_sym_SLASH] = ACTIONS(161),
-    [anon_sym_LT] = ACTIONS(163),
-    [anon_sym_GT] = ACTIONS(163),
-    [anon_sym_LT_EQ] = ACTIONS(165),
-    [anon_sym_GT_EQ] = ACTIONS(165),
-    [anon_sym_EQ_EQ] = ACTIONS(167),
-    [anon_sym_BANG_EQ] = ACTIONS(167),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(74)] = {
-    [sym_comment] = STATE(74),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(163),
-    [anon_sym_GT] = ACTIONS(163),
-    [anon_sym_LT_EQ] = ACTIONS(165),
-    [anon_sym_GT_EQ] = ACTIONS(165),
-    [anon_sym_EQ_EQ] = ACTIONS(167),
-    [anon_sym_BANG_EQ] = ACTIONS(167),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(75)] = {
-    [sym_comment] = STATE(75),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(157),
-    [anon_sym_PLUS] = ACTIONS(157),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(163),
-    [anon_sym_GT] = ACTIONS(163),
-    [anon_sym_LT_EQ] = ACTIONS(165),
-    [anon_sym_GT_EQ] = ACTIONS(165),
-    [anon_sym_EQ_EQ] = ACTIONS(167),
-    [anon_sym_BANG_EQ] = ACTIONS(167),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(76)] = {
-    [sym_comment] = STATE(76),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(167),
-    [anon_sym_BANG_EQ] = ACTIONS(167),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(77)] = {
-    [sym_comment] = STATE(77),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(171),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(78)] = {
-    [sym_comment] = STATE(78),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(79)] = {
-    [sym_comment] = STATE(79),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(169),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(80)] = {
-    [sym_comment] = STATE(80),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(173),
-    [anon_sym_COMMA] = ACTIONS(175),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-  [STATE(81)] = {
-    [sym_comment] = STATE(81),
-    [sym_id] = ACTIONS(67),
-    [anon_sym_DOT] = ACTIONS(67),
-    [anon_sym_LBRACK] = ACTIONS(65),
-    [anon_sym_LPAREN] = ACTIONS(65),
-    [anon_sym_RPAREN] = ACTIONS(65),
-    [anon_sym_PLUS_PLUS] = ACTIONS(65),
-    [anon_sym_DASH_DASH] = ACTIONS(65),
-    [anon_sym_not] = ACTIONS(65),
-    [anon_sym_DASH] = ACTIONS(67),
-    [anon_sym_PLUS] = ACTIONS(67),
-    [anon_sym_STAR] = ACTIONS(65),
-    [anon_sym_SLASH] = ACTIONS(67),
-    [anon_sym_LT] = ACTIONS(67),
-    [anon_sym_GT] = ACTIONS(67),
-    [anon_sym_LT_EQ] = ACTIONS(65),
-    [anon_sym_GT_EQ] = ACTIONS(65),
-    [anon_sym_EQ_EQ] = ACTIONS(65),
-    [anon_sym_BANG_EQ] = ACTIONS(65),
-    [anon_sym_and] = ACTIONS(65),
-    [anon_sym_or] = ACTIONS(65),
-    [anon_sym_EQ] = ACTIONS(67),
-    [anon_sym_COMMA] = ACTIONS(65),
-    [sym_number] = ACTIONS(67),
-    [sym_float] = ACTIONS(65),
-    [anon_sym_SLASH_SLASH] = ACTIONS(3),
-    [sym__block_comment_start] = ACTIONS(5),
-    [sym__string_start] = ACTIONS(65),
-  },
-};
-
-static const uint16_t ts_small_parse_table[] = {
-  [0] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(11), 1,
-      anon_sym_struct,
-    ACTIONS(13), 1,
-      anon_sym_globals,
-    ACTIONS(15), 1,
-      anon_sym_loop,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    ACTIONS(177), 1,
-      ts_builtin_sym_end,
-    STATE(5), 1,
-      sym_string,
-    STATE(65), 1,
-      sym_expr,
-    STATE(82), 1,
-      sym_comment,
-    STATE(89), 1,
-      aux_sym_program_repeat1,
-    STATE(147), 1,
-      sym__block,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(150), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [64] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(187), 1,
-      anon_sym_endloop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(83), 1,
-      sym_comment,
-    STATE(90), 1,
-      aux_sym_program_repeat1,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [128] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(201), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(84), 1,
-      sym_comment,
-    STATE(90), 1,
-      aux_sym_program_repeat1,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [192] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(207), 1,
-      anon_sym_endstruct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(85), 1,
-      sym_comment,
-    STATE(91), 1,
-      aux_sym_program_repeat1,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [256] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(231), 1,
-      anon_sym_endglobals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(86), 1,
-      sym_comment,
-    STATE(93), 1,
-      aux_sym_program_repeat1,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [320] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(247), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(84), 1,
-      aux_sym_program_repeat1,
-    STATE(87), 1,
-      sym_comment,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [384] = 18,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(252), 1,
-      anon_sym_struct,
-    ACTIONS(255), 1,
-      anon_sym_globals,
-    ACTIONS(258), 1,
-      anon_sym_endglobals,
-    ACTIONS(260), 1,
-      anon_sym_loop,
-    ACTIONS(263), 1,
-      anon_sym_LBRACK,
-    ACTIONS(266), 1,
-      anon_sym_LPAREN,
-    ACTIONS(275), 1,
-      sym_float,
-    ACTIONS(278), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(249), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(272), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    STATE(88), 2,
-      sym_comment,
-      aux_sym_program_repeat1,
-    ACTIONS(269), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [446] = 18,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(258), 1,
-      ts_builtin_sym_end,
-    ACTIONS(284), 1,
-      anon_sym_struct,
-    ACTIONS(287), 1,
-      anon_sym_globals,
-    ACTIONS(290), 1,
-      anon_sym_loop,
-    ACTIONS(293), 1,
-      anon_sym_LBRACK,
-    ACTIONS(296), 1,
-      anon_sym_LPAREN,
-    ACTIONS(305), 1,
-      sym_float,
-    ACTIONS(308), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(65), 1,
-      sym_expr,
-    STATE(147), 1,
-      sym__block,
-    ACTIONS(281), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(302), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    STATE(89), 2,
-      sym_comment,
-      aux_sym_program_repeat1,
-    ACTIONS(299), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(150), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [508] = 18,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(258), 1,
-      anon_sym_endloop,
-    ACTIONS(314), 1,
-      anon_sym_struct,
-    ACTIONS(317), 1,
-      anon_sym_globals,
-    ACTIONS(320), 1,
-      anon_sym_loop,
-    ACTIONS(323), 1,
-      anon_sym_LBRACK,
-    ACTIONS(326), 1,
-      anon_sym_LPAREN,
-    ACTIONS(335), 1,
-      sym_float,
-    ACTIONS(338), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(311), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(332), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    STATE(90), 2,
-      sym_comment,
-      aux_sym_program_repeat1,
-    ACTIONS(329), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [570] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(341), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(91), 1,
-      sym_comment,
-    STATE(92), 1,
-      aux_sym_program_repeat1,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [634] = 18,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(258), 1,
-      anon_sym_endstruct,
-    ACTIONS(346), 1,
-      anon_sym_struct,
-    ACTIONS(349), 1,
-      anon_sym_globals,
-    ACTIONS(352), 1,
-      anon_sym_loop,
-    ACTIONS(355), 1,
-      anon_sym_LBRACK,
-    ACTIONS(358), 1,
-      anon_sym_LPAREN,
-    ACTIONS(367), 1,
-      sym_float,
-    ACTIONS(370), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(343), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(364), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    STATE(92), 2,
-      sym_comment,
-      aux_sym_program_repeat1,
-    ACTIONS(361), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [696] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(373), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(88), 1,
-      aux_sym_program_repeat1,
-    STATE(93), 1,
-      sym_comment,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [760] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(375), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(94), 1,
-      sym_comment,
-    STATE(97), 1,
-      aux_sym_program_repeat1,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [824] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(377), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(95), 1,
-      sym_comment,
-    STATE(98), 1,
-      aux_sym_program_repeat1,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [888] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(379), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(96), 1,
-      sym_comment,
-    STATE(99), 1,
-      aux_sym_program_repeat1,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [952] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(381), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(92), 1,
-      aux_sym_program_repeat1,
-    STATE(97), 1,
-      sym_comment,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1016] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(383), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(88), 1,
-      aux_sym_program_repeat1,
-    STATE(98), 1,
-      sym_comment,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1080] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(385), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(90), 1,
-      aux_sym_program_repeat1,
-    STATE(99), 1,
-      sym_comment,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1144] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(387), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(100), 1,
-      sym_comment,
-    STATE(103), 1,
-      aux_sym_program_repeat1,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1208] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(389), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(101), 1,
-      sym_comment,
-    STATE(104), 1,
-      aux_sym_program_repeat1,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1272] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(391), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(102), 1,
-      sym_comment,
-    STATE(105), 1,
-      aux_sym_program_repeat1,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1336] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(393), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(92), 1,
-      aux_sym_program_repeat1,
-    STATE(103), 1,
-      sym_comment,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1400] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(395), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(88), 1,
-      aux_sym_program_repeat1,
-    STATE(104), 1,
-      sym_comment,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1464] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(397), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(90), 1,
-      aux_sym_program_repeat1,
-    STATE(105), 1,
-      sym_comment,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1528] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(399), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(106), 1,
-      sym_comment,
-    STATE(109), 1,
-      aux_sym_program_repeat1,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1592] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(401), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(107), 1,
-      sym_comment,
-    STATE(110), 1,
-      aux_sym_program_repeat1,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1656] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(181), 1,
-      anon_sym_struct,
-    ACTIONS(183), 1,
-      anon_sym_globals,
-    ACTIONS(185), 1,
-      anon_sym_loop,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    ACTIONS(403), 1,
-      anon_sym_endloop,
-    STATE(49), 1,
-      sym_string,
-    STATE(50), 1,
-      sym_expr,
-    STATE(83), 1,
-      aux_sym_program_repeat1,
-    STATE(108), 1,
-      sym_comment,
-    STATE(148), 1,
-      sym__block,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(149), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1720] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(205), 1,
-      anon_sym_struct,
-    ACTIONS(209), 1,
-      anon_sym_globals,
-    ACTIONS(211), 1,
-      anon_sym_loop,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    ACTIONS(405), 1,
-      anon_sym_endstruct,
-    STATE(17), 1,
-      sym_string,
-    STATE(18), 1,
-      sym_expr,
-    STATE(92), 1,
-      aux_sym_program_repeat1,
-    STATE(109), 1,
-      sym_comment,
-    STATE(175), 1,
-      sym__block,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(133), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1784] = 19,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(227), 1,
-      anon_sym_struct,
-    ACTIONS(229), 1,
-      anon_sym_globals,
-    ACTIONS(233), 1,
-      anon_sym_loop,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    ACTIONS(407), 1,
-      anon_sym_endglobals,
-    STATE(33), 1,
-      sym_string,
-    STATE(34), 1,
-      sym_expr,
-    STATE(88), 1,
-      aux_sym_program_repeat1,
-    STATE(110), 1,
-      sym_comment,
-    STATE(156), 1,
-      sym__block,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-    STATE(157), 3,
-      sym_struct,
-      sym_globals,
-      sym_loop,
-  [1848] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(111), 1,
-      sym_comment,
-    ACTIONS(67), 5,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_EQ,
-    ACTIONS(65), 12,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-      anon_sym_COMMA,
-  [1879] = 17,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(409), 1,
-      anon_sym_DOT,
-    ACTIONS(411), 1,
-      anon_sym_RBRACK,
-    ACTIONS(413), 1,
-      anon_sym_PLUS_PLUS,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(112), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [1934] = 17,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(409), 1,
-      anon_sym_DOT,
-    ACTIONS(413), 1,
-      anon_sym_PLUS_PLUS,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    ACTIONS(437), 1,
-      anon_sym_RBRACK,
-    STATE(113), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [1989] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(114), 1,
-      sym_comment,
-    ACTIONS(59), 5,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_EQ,
-    ACTIONS(57), 12,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-      anon_sym_COMMA,
-  [2020] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(115), 1,
-      sym_comment,
-    ACTIONS(55), 5,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_EQ,
-    ACTIONS(53), 12,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-      anon_sym_COMMA,
-  [2051] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(116), 1,
-      sym_comment,
-    ACTIONS(31), 5,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_EQ,
-    ACTIONS(29), 12,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-      anon_sym_COMMA,
-  [2082] = 15,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(117), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(29), 3,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-  [2133] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(118), 1,
-      sym_comment,
-    ACTIONS(63), 5,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_EQ,
-    ACTIONS(61), 12,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-      anon_sym_COMMA,
-  [2164] = 15,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(119), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(65), 3,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-  [2215] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(120), 1,
-      sym_comment,
-    ACTIONS(67), 2,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(65), 5,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-  [2260] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(67), 1,
-      anon_sym_SLASH,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(121), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(65), 4,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_STAR,
-  [2309] = 10,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(122), 1,
-      sym_comment,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-    ACTIONS(67), 4,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(65), 7,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-  [2350] = 9,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(123), 1,
-      sym_comment,
-    ACTIONS(67), 4,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(65), 9,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [2389] = 7,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(124), 1,
-      sym_comment,
-    ACTIONS(67), 4,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(65), 11,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-  [2424] = 8,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(125), 1,
-      sym_comment,
-    ACTIONS(67), 4,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(65), 10,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_or,
-  [2461] = 7,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    STATE(126), 1,
-      sym_comment,
-    ACTIONS(67), 4,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(65), 11,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-  [2496] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(127), 1,
-      sym_comment,
-    ACTIONS(67), 5,
-      anon_sym_PLUS,
-      anon_sym_SLASH,
-      anon_sym_LT,
-      anon_sym_GT,
-      anon_sym_EQ,
-    ACTIONS(65), 12,
-      anon_sym_DOT,
-      anon_sym_RBRACK,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH,
-      anon_sym_STAR,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-      anon_sym_and,
-      anon_sym_or,
-      anon_sym_COMMA,
-  [2527] = 17,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(409), 1,
-      anon_sym_DOT,
-    ACTIONS(413), 1,
-      anon_sym_PLUS_PLUS,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    ACTIONS(439), 1,
-      anon_sym_RBRACK,
-    STATE(128), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [2582] = 17,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(409), 1,
-      anon_sym_DOT,
-    ACTIONS(413), 1,
-      anon_sym_PLUS_PLUS,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    ACTIONS(441), 1,
-      anon_sym_RBRACK,
-    STATE(129), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [2637] = 17,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(409), 1,
-      anon_sym_DOT,
-    ACTIONS(413), 1,
-      anon_sym_PLUS_PLUS,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    ACTIONS(443), 1,
-      anon_sym_RBRACK,
-    STATE(130), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [2692] = 17,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(409), 1,
-      anon_sym_DOT,
-    ACTIONS(413), 1,
-      anon_sym_PLUS_PLUS,
-    ACTIONS(415), 1,
-      anon_sym_DASH,
-    ACTIONS(417), 1,
-      anon_sym_PLUS,
-    ACTIONS(419), 1,
-      anon_sym_STAR,
-    ACTIONS(421), 1,
-      anon_sym_SLASH,
-    ACTIONS(429), 1,
-      anon_sym_and,
-    ACTIONS(431), 1,
-      anon_sym_or,
-    ACTIONS(433), 1,
-      anon_sym_EQ,
-    ACTIONS(435), 1,
-      anon_sym_COMMA,
-    ACTIONS(445), 1,
-      anon_sym_RBRACK,
-    STATE(131), 1,
-      sym_comment,
-    ACTIONS(423), 2,
-      anon_sym_LT,
-      anon_sym_GT,
-    ACTIONS(425), 2,
-      anon_sym_LT_EQ,
-      anon_sym_GT_EQ,
-    ACTIONS(427), 2,
-      anon_sym_EQ_EQ,
-      anon_sym_BANG_EQ,
-  [2747] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(413), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(132), 1,
-      sym_comment,
-    STATE(173), 1,
-      aux_sym_expr_repeat1,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [2794] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(133), 1,
-      sym_comment,
-    ACTIONS(69), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(71), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2823] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(134), 1,
-      sym_comment,
-    ACTIONS(463), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(461), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2852] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(135), 1,
-      sym_comment,
-    ACTIONS(463), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(461), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2881] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(136), 1,
-      sym_comment,
-    ACTIONS(465), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(467), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2910] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(137), 1,
-      sym_comment,
-    ACTIONS(469), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(471), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2939] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(138), 1,
-      sym_comment,
-    ACTIONS(473), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(475), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2968] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(139), 1,
-      sym_comment,
-    ACTIONS(477), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(479), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [2997] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(140), 1,
-      sym_comment,
-    ACTIONS(481), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(483), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3026] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(141), 1,
-      sym_comment,
-    ACTIONS(481), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(483), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3055] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(142), 1,
-      sym_comment,
-    ACTIONS(473), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(475), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3084] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(143), 1,
-      sym_comment,
-    ACTIONS(477), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(479), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3113] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(144), 1,
-      sym_comment,
-    ACTIONS(477), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(479), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3142] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(147), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(145), 1,
-      sym_comment,
-    STATE(152), 1,
-      aux_sym_expr_repeat1,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3189] = 13,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(488), 1,
-      anon_sym_LBRACK,
-    ACTIONS(491), 1,
-      anon_sym_LPAREN,
-    ACTIONS(494), 1,
-      anon_sym_RPAREN,
-    ACTIONS(502), 1,
-      sym_float,
-    ACTIONS(505), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    ACTIONS(485), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(499), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    STATE(146), 2,
-      sym_comment,
-      aux_sym_expr_repeat1,
-    ACTIONS(496), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3234] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(147), 1,
-      sym_comment,
-    ACTIONS(510), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(508), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3263] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(148), 1,
-      sym_comment,
-    ACTIONS(510), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(508), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3292] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(149), 1,
-      sym_comment,
-    ACTIONS(69), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(71), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3321] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(150), 1,
-      sym_comment,
-    ACTIONS(69), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(71), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3350] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(151), 1,
-      sym_comment,
-    ACTIONS(463), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(461), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3379] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(437), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(146), 1,
-      aux_sym_expr_repeat1,
-    STATE(152), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3426] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(153), 1,
-      sym_comment,
-    ACTIONS(465), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(467), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3455] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(154), 1,
-      sym_comment,
-    ACTIONS(481), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(483), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3484] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(155), 1,
-      sym_comment,
-    ACTIONS(473), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(475), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3513] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(156), 1,
-      sym_comment,
-    ACTIONS(510), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(508), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3542] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(157), 1,
-      sym_comment,
-    ACTIONS(69), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(71), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3571] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(75), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(158), 1,
-      sym_comment,
-    STATE(161), 1,
-      aux_sym_expr_repeat1,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3618] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(159), 1,
-      sym_comment,
-    ACTIONS(463), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(461), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3647] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(160), 1,
-      sym_comment,
-    ACTIONS(469), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(471), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3676] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(439), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(146), 1,
-      aux_sym_expr_repeat1,
-    STATE(161), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3723] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(162), 1,
-      sym_comment,
-    ACTIONS(465), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(467), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3752] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(163), 1,
-      sym_comment,
-    ACTIONS(469), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(471), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_endglobals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3781] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(99), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(164), 1,
-      sym_comment,
-    STATE(166), 1,
-      aux_sym_expr_repeat1,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3828] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(165), 1,
-      sym_comment,
-    ACTIONS(481), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(483), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3857] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(441), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(146), 1,
-      aux_sym_expr_repeat1,
-    STATE(166), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3904] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(167), 1,
-      sym_comment,
-    ACTIONS(469), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(471), 11,
-      sym__string_start,
-      ts_builtin_sym_end,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [3933] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(123), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(168), 1,
-      sym_comment,
-    STATE(170), 1,
-      aux_sym_expr_repeat1,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [3980] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(169), 1,
-      sym_comment,
-    ACTIONS(473), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(475), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [4009] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(443), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(146), 1,
-      aux_sym_expr_repeat1,
-    STATE(170), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4056] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(411), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(146), 1,
-      aux_sym_expr_repeat1,
-    STATE(171), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4103] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(172), 1,
-      sym_comment,
-    ACTIONS(477), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(479), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [4132] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(445), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(146), 1,
-      aux_sym_expr_repeat1,
-    STATE(173), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4179] = 14,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(155), 1,
-      anon_sym_RPAREN,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(66), 1,
-      sym_expr,
-    STATE(67), 1,
-      sym_string,
-    STATE(171), 1,
-      aux_sym_expr_repeat1,
-    STATE(174), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4226] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(175), 1,
-      sym_comment,
-    ACTIONS(510), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(508), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_endstruct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [4255] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    STATE(176), 1,
-      sym_comment,
-    ACTIONS(465), 4,
-      sym_id,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-      sym_number,
-    ACTIONS(467), 11,
-      sym__string_start,
-      anon_sym_struct,
-      anon_sym_globals,
-      anon_sym_loop,
-      anon_sym_endloop,
-      anon_sym_LBRACK,
-      anon_sym_LPAREN,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-      sym_float,
-  [4284] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(43), 1,
-      sym_expr,
-    STATE(177), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4325] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(61), 1,
-      sym_expr,
-    STATE(178), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4366] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(62), 1,
-      sym_expr,
-    STATE(179), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4407] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(63), 1,
-      sym_expr,
-    STATE(180), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4448] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(64), 1,
-      sym_expr,
-    STATE(181), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4489] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(8), 1,
-      sym_expr,
-    STATE(182), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4530] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(16), 1,
-      sym_expr,
-    STATE(183), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4571] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(2), 1,
-      sym_expr,
-    STATE(5), 1,
-      sym_string,
-    STATE(184), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4612] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(9), 1,
-      sym_expr,
-    STATE(185), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4653] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(70), 1,
-      sym_expr,
-    STATE(186), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4694] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(24), 1,
-      sym_expr,
-    STATE(187), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4735] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(25), 1,
-      sym_expr,
-    STATE(188), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4776] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(73), 1,
-      sym_expr,
-    STATE(189), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4817] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(74), 1,
-      sym_expr,
-    STATE(190), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4858] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(75), 1,
-      sym_expr,
-    STATE(191), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4899] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(76), 1,
-      sym_expr,
-    STATE(192), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4940] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(77), 1,
-      sym_expr,
-    STATE(193), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [4981] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(78), 1,
-      sym_expr,
-    STATE(194), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5022] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(79), 1,
-      sym_expr,
-    STATE(195), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5063] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(80), 1,
-      sym_expr,
-    STATE(196), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5104] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(449), 1,
-      anon_sym_LBRACK,
-    ACTIONS(451), 1,
-      anon_sym_LPAREN,
-    ACTIONS(457), 1,
-      sym_float,
-    ACTIONS(459), 1,
-      sym__string_start,
-    STATE(67), 1,
-      sym_string,
-    STATE(81), 1,
-      sym_expr,
-    STATE(197), 1,
-      sym_comment,
-    ACTIONS(447), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(455), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(453), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5145] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(26), 1,
-      sym_expr,
-    STATE(198), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5186] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(27), 1,
-      sym_expr,
-    STATE(199), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5227] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(28), 1,
-      sym_expr,
-    STATE(200), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5268] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(29), 1,
-      sym_expr,
-    STATE(201), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5309] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(30), 1,
-      sym_expr,
-    STATE(202), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5350] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(31), 1,
-      sym_expr,
-    STATE(203), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5391] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(32), 1,
-      sym_expr,
-    STATE(204), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5432] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(10), 1,
-      sym_expr,
-    STATE(205), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5473] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(11), 1,
-      sym_expr,
-    STATE(206), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5514] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(213), 1,
-      anon_sym_LBRACK,
-    ACTIONS(215), 1,
-      anon_sym_LPAREN,
-    ACTIONS(221), 1,
-      sym_float,
-    ACTIONS(223), 1,
-      sym__string_start,
-    STATE(17), 1,
-      sym_string,
-    STATE(21), 1,
-      sym_expr,
-    STATE(207), 1,
-      sym_comment,
-    ACTIONS(203), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(219), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(217), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5555] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(37), 1,
-      sym_expr,
-    STATE(208), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5596] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(48), 1,
-      sym_expr,
-    STATE(209), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5637] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(12), 1,
-      sym_expr,
-    STATE(210), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5678] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(13), 1,
-      sym_expr,
-    STATE(211), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5719] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(53), 1,
-      sym_expr,
-    STATE(212), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5760] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(56), 1,
-      sym_expr,
-    STATE(213), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5801] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(117), 1,
-      sym_expr,
-    STATE(214), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5842] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(14), 1,
-      sym_expr,
-    STATE(215), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5883] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(57), 1,
-      sym_expr,
-    STATE(216), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5924] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(17), 1,
-      anon_sym_LBRACK,
-    ACTIONS(19), 1,
-      anon_sym_LPAREN,
-    ACTIONS(25), 1,
-      sym_float,
-    ACTIONS(27), 1,
-      sym__string_start,
-    STATE(5), 1,
-      sym_string,
-    STATE(15), 1,
-      sym_expr,
-    STATE(217), 1,
-      sym_comment,
-    ACTIONS(9), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(23), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(21), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [5965] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(40), 1,
-      sym_expr,
-    STATE(218), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6006] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(41), 1,
-      sym_expr,
-    STATE(219), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6047] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(58), 1,
-      sym_expr,
-    STATE(220), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6088] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(59), 1,
-      sym_expr,
-    STATE(221), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6129] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(42), 1,
-      sym_expr,
-    STATE(222), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6170] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(119), 1,
-      sym_expr,
-    STATE(223), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6211] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(44), 1,
-      sym_expr,
-    STATE(224), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6252] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(120), 1,
-      sym_expr,
-    STATE(225), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6293] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(45), 1,
-      sym_expr,
-    STATE(226), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6334] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(46), 1,
-      sym_expr,
-    STATE(227), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6375] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(235), 1,
-      anon_sym_LBRACK,
-    ACTIONS(237), 1,
-      anon_sym_LPAREN,
-    ACTIONS(243), 1,
-      sym_float,
-    ACTIONS(245), 1,
-      sym__string_start,
-    STATE(33), 1,
-      sym_string,
-    STATE(47), 1,
-      sym_expr,
-    STATE(228), 1,
-      sym_comment,
-    ACTIONS(225), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(241), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(239), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6416] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(121), 1,
-      sym_expr,
-    STATE(229), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6457] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(122), 1,
-      sym_expr,
-    STATE(230), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6498] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(123), 1,
-      sym_expr,
-    STATE(231), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6539] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(124), 1,
-      sym_expr,
-    STATE(232), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6580] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(125), 1,
-      sym_expr,
-    STATE(233), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6621] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(126), 1,
-      sym_expr,
-    STATE(234), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6662] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(127), 1,
-      sym_expr,
-    STATE(235), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6703] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(189), 1,
-      anon_sym_LBRACK,
-    ACTIONS(191), 1,
-      anon_sym_LPAREN,
-    ACTIONS(197), 1,
-      sym_float,
-    ACTIONS(199), 1,
-      sym__string_start,
-    STATE(49), 1,
-      sym_string,
-    STATE(60), 1,
-      sym_expr,
-    STATE(236), 1,
-      sym_comment,
-    ACTIONS(179), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(195), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(193), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6744] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(128), 1,
-      sym_expr,
-    STATE(237), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6785] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(129), 1,
-      sym_expr,
-    STATE(238), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6826] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(130), 1,
-      sym_expr,
-    STATE(239), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6867] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(114), 1,
-      sym_string,
-    STATE(131), 1,
-      sym_expr,
-    STATE(240), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6908] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(112), 1,
-      sym_expr,
-    STATE(114), 1,
-      sym_string,
-    STATE(241), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6949] = 12,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(514), 1,
-      anon_sym_LBRACK,
-    ACTIONS(516), 1,
-      anon_sym_LPAREN,
-    ACTIONS(522), 1,
-      sym_float,
-    ACTIONS(524), 1,
-      sym__string_start,
-    STATE(113), 1,
-      sym_expr,
-    STATE(114), 1,
-      sym_string,
-    STATE(242), 1,
-      sym_comment,
-    ACTIONS(512), 2,
-      sym_id,
-      sym_number,
-    ACTIONS(520), 2,
-      anon_sym_DASH,
-      anon_sym_PLUS,
-    ACTIONS(518), 3,
-      anon_sym_PLUS_PLUS,
-      anon_sym_DASH_DASH,
-      anon_sym_not,
-  [6990] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(526), 1,
-      sym__string_content,
-    ACTIONS(528), 1,
-      sym__string_end,
-    STATE(243), 1,
-      sym_comment,
-  [7006] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(530), 1,
-      sym__block_comment_content,
-    ACTIONS(532), 1,
-      sym__block_comment_end,
-    STATE(244), 1,
-      sym_comment,
-  [7022] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(534), 1,
-      sym__string_content,
-    ACTIONS(536), 1,
-      sym__string_end,
-    STATE(245), 1,
-      sym_comment,
-  [7038] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(538), 1,
-      sym__string_content,
-    ACTIONS(540), 1,
-      sym__string_end,
-    STATE(246), 1,
-      sym_comment,
-  [7054] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(542), 1,
-      sym__string_content,
-    ACTIONS(544), 1,
-      sym__string_end,
-    STATE(247), 1,
-      sym_comment,
-  [7070] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(546), 1,
-      sym__string_content,
-    ACTIONS(548), 1,
-      sym__string_end,
-    STATE(248), 1,
-      sym_comment,
-  [7086] = 5,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(550), 1,
-      sym__string_content,
-    ACTIONS(552), 1,
-      sym__string_end,
-    STATE(249), 1,
-      sym_comment,
-  [7102] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(554), 1,
-      ts_builtin_sym_end,
-    STATE(250), 1,
-      sym_comment,
-  [7115] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(556), 1,
-      sym__string_end,
-    STATE(251), 1,
-      sym_comment,
-  [7128] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(558), 1,
-      sym__string_end,
-    STATE(252), 1,
-      sym_comment,
-  [7141] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(560), 1,
-      sym__string_end,
-    STATE(253), 1,
-      sym_comment,
-  [7154] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(562), 1,
-      sym__string_end,
-    STATE(254), 1,
-      sym_comment,
-  [7167] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(564), 1,
-      sym__string_end,
-    STATE(255), 1,
-      sym_comment,
-  [7180] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(566), 1,
-      sym__block_comment_end,
-    STATE(256), 1,
-      sym_comment,
-  [7193] = 4,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(568), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(570), 1,
-      aux_sym_comment_token1,
-    STATE(257), 1,
-      sym_comment,
-  [7206] = 4,
-    ACTIONS(3), 1,
-      anon_sym_SLASH_SLASH,
-    ACTIONS(5), 1,
-      sym__block_comment_start,
-    ACTIONS(572), 1,
-      sym__string_end,
-    STATE(258), 1,
-      sym_comment,
-  [7219] = 1,
-    ACTIONS(574), 1,
-      ts_builtin_sym_end,
-  [7223] = 1,
-    ACTIONS(576), 1,
-      ts_builtin_sym_end,
-  [7227] = 1,
-    ACTIONS(578), 1,
-      ts_builtin_sym_end,
-};
-
-static const uint32_t ts_small_parse_table_map[] = {
-  [SMALL_STATE(82)] = 0,
-  [SMALL_STATE(83)] = 64,
-  [SMALL_STATE(84)] = 128,
-  [SMALL_STATE(85)] = 192,
-  [SMALL_STATE(86)] = 256,
-  [SMALL_STATE(87)] = 320,
-  [SMALL_STATE(88)] = 384,
-  [SMALL_STATE(89)] = 446,
-  [SMALL_STATE(90)] = 508,
-  [SMALL_STATE(91)] = 570,
-  [SMALL_STATE(92)] = 634,
-  [SMALL_STATE(93)] = 696,
-  [SMALL_STATE(94)] = 760,
-  [SMALL_STATE(95)] = 824,
-  [SMALL_STATE(96)] = 888,
-  [SMALL_STATE(97)] = 952,
-  [SMALL_STATE(98)] = 1016,
-  [SMALL_STATE(99)] = 1080,
-  [SMALL_STATE(100)] = 1144,
-  [SMALL_STATE(101)] = 1208,
-  [SMALL_STATE(102)] = 1272,
-  [SMALL_STATE(103)] = 1336,
-  [SMALL_STATE(104)] = 1400,
-  [SMALL_STATE(105)] = 1464,
-  [SMALL_STATE(106)] = 1528,
-  [SMALL_STATE(107)] = 1592,
-  [SMALL_STATE(108)] = 1656,
-  [SMALL_STATE(109)] = 1720,
-  [SMALL_STATE(110)] = 1784,
-  [SMALL_STATE(111)] = 1848,
-  [SMALL_STATE(112)] = 1879,
-  [SMALL_STATE(113)] = 1934,
-  [SMALL_STATE(114)] = 1989,
-  [SMALL_STATE(115)] = 2020,
-  [SMALL_STATE(116)] = 2051,
-  [SMALL_STATE(117)] = 2082,
-  [SMALL_STATE(118)] = 2133,
-  [SMALL_STATE(119)] = 2164,
-  [SMALL_STATE(120)] = 2215,
-  [SMALL_STATE(121)] = 2260,
-  [SMALL_STATE(122)] = 2309,
-  [SMALL_STATE(123)] = 2350,
-  [SMALL_STATE(124)] = 2389,
-  [SMALL_STATE(125)] = 2424,
-  [SMALL_STATE(126)] = 2461,
-  [SMALL_STATE(127)] = 2496,
-  [SMALL_STATE(128)] = 2527,
-  [SMALL_STATE(129)] = 2582,
-  [SMALL_STATE(130)] = 2637,
-  [SMALL_STATE(131)] = 2692,
-  [SMALL_STATE(132)] = 2747,
-  [SMALL_STATE(133)] = 2794,
-  [SMALL_STATE(134)] = 2823,
-  [SMALL_STATE(135)] = 2852,
-  [SMALL_STATE(136)] = 2881,
-  [SMALL_STATE(137)] = 2910,
-  [SMALL_STATE(138)] = 2939,
-  [SMALL_STATE(139)] = 2968,
-  [SMALL_STATE(140)] = 2997,
-  [SMALL_STATE(141)] = 3026,
-  [SMALL_STATE(142)] = 3055,
-  [SMALL_STATE(143)] = 3084,
-  [SMALL_STATE(144)] = 3113,
-  [SMALL_STATE(145)] = 3142,
-  [SMALL_STATE(146)] = 3189,
-  [SMALL_STATE(147)] = 3234,
-  [SMALL_STATE(148)] = 3263,
-  [SMALL_STATE(149)] = 3292,
-  [SMALL_STATE(150)] = 3321,
-  [SMALL_STATE(151)] = 3350,
-  [SMALL_STATE(152)] = 3379,
-  [SMALL_STATE(153)] = 3426,
-  [SMALL_STATE(154)] = 3455,
-  [SMALL_STATE(155)] = 3484,
-  [SMALL_STATE(156)] = 3513,
-  [SMALL_STATE(157)] = 3542,
-  [SMALL_STATE(158)] = 3571,
-  [SMALL_STATE(159)] = 3618,
-  [SMALL_STATE(160)] = 3647,
-  [SMALL_STATE(161)] = 3676,
-  [SMALL_STATE(162)] = 3723,
-  [SMALL_STATE(163)] = 3752,
-  [SMALL_STATE(164)] = 3781,
-  [SMALL_STATE(165)] = 3828,
-  [SMALL_STATE(166)] = 3857,
-  [SMALL_STATE(167)] = 3904,
-  [SMALL_STATE(168)] = 3933,
-  [SMALL_STATE(169)] = 3980,
-  [SMALL_STATE(170)] = 4009,
-  [SMALL_STATE(171)] = 4056,
-  [SMALL_STATE(172)] = 4103,
-  [SMALL_STATE(173)] = 4132,
-  [SMALL_STATE(174)] = 4179,
-  [SMALL_STATE(175)] = 4226,
-  [SMALL_STATE(176)] = 4255,
-  [SMALL_STATE(177)] = 4284,
-  [SMALL_STATE(178)] = 4325,
-  [SMALL_STATE(179)] = 4366,
-  [SMALL_STATE(180)] = 4407,
-  [SMALL_STATE(181)] = 4448,
-  [SMALL_STATE(182)] = 4489,
-  [SMALL_STATE(183)] = 4530,
-  [SMALL_STATE(184)] = 4571,
-  [SMALL_STATE(185)] = 4612,
-  [SMALL_STATE(186)] = 4653,
-  [SMALL_STATE(187)] = 4694,
-  [SMALL_STATE(188)] = 4735,
-  [SMALL_STATE(189)] = 4776,
-  [SMALL_STATE(190)] = 4817,
-  [SMALL_STATE(191)] = 4858,
-  [SMALL_STATE(192)] = 4899,
-  [SMALL_STATE(193)] = 4940,
-  [SMALL_STATE(194)] = 4981,
-  [SMALL_STATE(195)] = 5022,
-  [SMALL_STATE(196)] = 5063,
-  [SMALL_STATE(197)] = 5104,
-  [SMALL_STATE(198)] = 5145,
-  [SMALL_STATE(199)] = 5186,
-  [SMALL_STATE(200)] = 5227,
-  [SMALL_STATE(201)] = 5268,
-  [SMALL_STATE(202)] = 5309,
-  [SMALL_STATE(203)] = 5350,
-  [SMALL_STATE(204)] = 5391,
-  [SMALL_STATE(205)] = 5432,
-  [SMALL_STATE(206)] = 5473,
-  [SMALL_STATE(207)] = 5514,
-  [SMALL_STATE(208)] = 5555,
-  [SMALL_STATE(209)] = 5596,
-  [SMALL_STATE(210)] = 5637,
-  [SMALL_STATE(211)] = 5678,
-  [SMALL_STATE(212)] = 5719,
-  [SMALL_STATE(213)] = 5760,
-  [SMALL_STATE(214)] = 5801,
-  [SMALL_STATE(215)] = 5842,
-  [SMALL_STATE(216)] = 5883,
-  [SMALL_STATE(217)] = 5924,
-  [SMALL_STATE(218)] = 5965,
-  [SMALL_STATE(219)] = 6006,
-  [SMALL_STATE(220)] = 6047,
-  [SMALL_STATE(221)] = 6088,
-  [SMALL_STATE(222)] = 6129,
-  [SMALL_STATE(223)] = 6170,
-  [SMALL_STATE(224)] = 6211,
-  [SMALL_STATE(225)] = 6252,
-  [SMALL_STATE(226)] = 6293,
-  [SMALL_STATE(227)] = 6334,
-  [SMALL_STATE(228)] = 6375,
-  [SMALL_STATE(229)] = 6416,
-  [SMALL_STATE(230)] = 6457,
-  [SMALL_STATE(231)] = 6498,
-  [SMALL_STATE(232)] = 6539,
-  [SMALL_STATE(233)] = 6580,
-  [SMALL_STATE(234)] = 6621,
-  [SMALL_STATE(235)] = 6662,
-  [SMALL_STATE(236)] = 6703,
-  [SMALL_STATE(237)] = 6744,
-  [SMALL_STATE(238)] = 6785,
-  [SMALL_STATE(239)] = 6826,
-  [SMALL_STATE(240)] = 6867,
-  [SMALL_STATE(241)] = 6908,
-  [SMALL_STATE(242)] = 6949,
-  [SMALL_STATE(243)] = 6990,
-  [SMALL_STATE(244)] = 7006,
-  [SMALL_STATE(245)] = 7022,
-  [SMALL_STATE(246)] = 7038,
-  [SMALL_STATE(247)] = 7054,
-  [SMALL_STATE(248)] = 7070,
-  [SMALL_STATE(249)] = 7086,
-  [SMALL_STATE(250)] = 7102,
-  [SMALL_STATE(251)] = 7115,
-  [SMALL_STATE(252)] = 7128,
-  [SMALL_STATE(253)] = 7141,
-  [SMALL_STATE(254)] = 7154,
-  [SMALL_STATE(255)] = 7167,
-  [SMALL_STATE(256)] = 7180,
-  [SMALL_STATE(257)] = 7193,
-  [SMALL_STATE(258)] = 7206,
-  [SMALL_STATE(259)] = 7219,
-  [SMALL_STATE(260)] = 7223,
-  [SMALL_STATE(261)] = 7227,
-};
-
-static const TSParseActionEntry ts_parse_actions[] = {
-  [0] = {.entry = {.count = 0, .reusable = false}},
-  [1] = {.entry = {.count = 1, .reusable = false}}, RECOVER(),
-  [3] = {.entry = {.count = 1, .reusable = true}}, SHIFT(257),
-  [5] = {.entry = {.count = 1, .reusable = true}}, SHIFT(244),
-  [7] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_program, 0, 0, 0),
-  [9] = {.entry = {.count = 1, .reusable = false}}, SHIFT(5),
-  [11] = {.entry = {.count = 1, .reusable = true}}, SHIFT(85),
-  [13] = {.entry = {.count = 1, .reusable = true}}, SHIFT(86),
-  [15] = {.entry = {.count = 1, .reusable = true}}, SHIFT(87),
-  [17] = {.entry = {.count = 1, .reusable = true}}, SHIFT(242),
-  [19] = {.entry = {.count = 1, .reusable = true}}, SHIFT(145),
-  [21] = {.entry = {.count = 1, .reusable = true}}, SHIFT(184),
-  [23] = {.entry = {.count = 1, .reusable = false}}, SHIFT(184),
-  [25] = {.entry = {.count = 1, .reusable = true}}, SHIFT(5),
-  [27] = {.entry = {.count = 1, .reusable = true}}, SHIFT(247),
-  [29] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr, 2, 0, 0),
-  [31] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_expr, 2, 0, 0),
-  [33] = {.entry = {.count = 1, .reusable = false}}, SHIFT(185),
-  [35] = {.entry = {.count = 1, .reusable = true}}, SHIFT(205),
-  [37] = {.entry = {.count = 1, .reusable = false}}, SHIFT(205),
-  [39] = {.entry = {.count = 1, .reusable = false}}, SHIFT(206),
-  [41] = {.entry = {.count = 1, .reusable = true}}, SHIFT(206),
-  [43] = {.entry = {.count = 1, .reusable = true}}, SHIFT(210),
-  [45] = {.entry = {.count = 1, .reusable = true}}, SHIFT(211),
-  [47] = {.entry = {.count = 1, .reusable = true}}, SHIFT(215),
-  [49] = {.entry = {.count = 1, .reusable = false}}, SHIFT(217),
-  [51] = {.entry = {.count = 1, .reusable = true}}, SHIFT(183),
-  [53] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_string, 2, 0, 1),
-  [55] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_string, 2, 0, 1),
-  [57] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr, 1, 0, 0),
-  [59] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_expr, 1, 0, 0),
-  [61] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_string, 3, 0, 3),
-  [63] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_string, 3, 0, 3),
-  [65] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_expr, 3, 0, 0),
-  [67] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_expr, 3, 0, 0),
-  [69] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym__block, 1, 0, 0),
-  [71] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym__block, 1, 0, 0),
-  [73] = {.entry = {.count = 1, .reusable = false}}, SHIFT(187),
-  [75] = {.entry = {.count = 1, .reusable = true}}, SHIFT(20),
-  [77] = {.entry = {.count = 1, .reusable = false}}, SHIFT(188),
-  [79] = {.entry = {.count = 1, .reusable = true}}, SHIFT(198),
-  [81] = {.entry = {.count = 1, .reusable = false}}, SHIFT(198),
-  [83] = {.entry = {.count = 1, .reusable = false}}, SHIFT(199),
-  [85] = {.entry = {.count = 1, .reusable = true}}, SHIFT(199),
-  [87] = {.entry = {.count = 1, .reusable = true}}, SHIFT(200),
-  [89] = {.entry = {.count = 1, .reusable = true}}, SHIFT(201),
-  [91] = {.entry = {.count = 1, .reusable = true}}, SHIFT(202),
-  [93] = {.entry = {.count = 1, .reusable = false}}, SHIFT(203),
-  [95] = {.entry = {.count = 1, .reusable = true}}, SHIFT(204),
-  [97] = {.entry = {.count = 1, .reusable = false}}, SHIFT(218),
-  [99] = {.entry = {.count = 1, .reusable = true}}, SHIFT(36),
-  [101] = {.entry = {.count = 1, .reusable = false}}, SHIFT(219),
-  [103] = {.entry = {.count = 1, .reusable = true}}, SHIFT(222),
-  [105] = {.entry = {.count = 1, .reusable = false}}, SHIFT(222),
-  [107] = {.entry = {.count = 1, .reusable = false}}, SHIFT(177),
-  [109] = {.entry = {.count = 1, .reusable = true}}, SHIFT(177),
-  [111] = {.entry = {.count = 1, .reusable = true}}, SHIFT(224),
-  [113] = {.entry = {.count = 1, .reusable = true}}, SHIFT(226),
-  [115] = {.entry = {.count = 1, .reusable = true}}, SHIFT(227),
-  [117] = {.entry = {.count = 1, .reusable = false}}, SHIFT(228),
-  [119] = {.entry = {.count = 1, .reusable = true}}, SHIFT(209),
-  [121] = {.entry = {.count = 1, .reusable = false}}, SHIFT(213),
-  [123] = {.entry = {.count = 1, .reusable = true}}, SHIFT(52),
-  [125] = {.entry = {.count = 1, .reusable = false}}, SHIFT(216),
-  [127] = {.entry = {.count = 1, .reusable = true}}, SHIFT(220),
-  [129] = {.entry = {.count = 1, .reusable = false}}, SHIFT(220),
-  [131] = {.entry = {.count = 1, .reusable = false}}, SHIFT(221),
-  [133] = {.entry = {.count = 1, .reusable = true}}, SHIFT(221),
-  [135] = {.entry = {.count = 1, .reusable = true}}, SHIFT(236),
-  [137] = {.entry = {.count = 1, .reusable = true}}, SHIFT(178),
-  [139] = {.entry = {.count = 1, .reusable = true}}, SHIFT(179),
-  [141] = {.entry = {.count = 1, .reusable = false}}, SHIFT(180),
-  [143] = {.entry = {.count = 1, .reusable = true}}, SHIFT(181),
-  [145] = {.entry = {.count = 1, .reusable = false}}, SHIFT(182),
-  [147] = {.entry = {.count = 1, .reusable = true}}, SHIFT(4),
-  [149] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_expr_repeat1, 1, 0, 0),
-  [151] = {.entry = {.count = 1, .reusable = false}}, SHIFT(189),
-  [153] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 1, 0, 0),
-  [155] = {.entry = {.count = 1, .reusable = true}}, SHIFT(69),
-  [157] = {.entry = {.count = 1, .reusable = false}}, SHIFT(190),
-  [159] = {.entry = {.count = 1, .reusable = true}}, SHIFT(191),
-  [161] = {.entry = {.count = 1, .reusable = false}}, SHIFT(191),
-  [163] = {.entry = {.count = 1, .reusable = false}}, SHIFT(192),
-  [165] = {.entry = {.count = 1, .reusable = true}}, SHIFT(192),
-  [167] = {.entry = {.count = 1, .reusable = true}}, SHIFT(193),
-  [169] = {.entry = {.count = 1, .reusable = true}}, SHIFT(194),
-  [171] = {.entry = {.count = 1, .reusable = true}}, SHIFT(195),
-  [173] = {.entry = {.count = 1, .reusable = false}}, SHIFT(196),
-  [175] = {.entry = {.count = 1, .reusable = true}}, SHIFT(197),
-  [177] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_program, 1, 0, 0),
-  [179] = {.entry = {.count = 1, .reusable = false}}, SHIFT(49),
-  [181] = {.entry = {.count = 1, .reusable = true}}, SHIFT(106),
-  [183] = {.entry = {.count = 1, .reusable = true}}, SHIFT(107),
-  [185] = {.entry = {.count = 1, .reusable = true}}, SHIFT(108),
-  [187] = {.entry = {.count = 1, .reusable = true}}, SHIFT(172),
-  [189] = {.entry = {.count = 1, .reusable = true}}, SHIFT(239),
-  [191] = {.entry = {.count = 1, .reusable = true}}, SHIFT(168),
-  [193] = {.entry = {.count = 1, .reusable = true}}, SHIFT(212),
-  [195] = {.entry = {.count = 1, .reusable = false}}, SHIFT(212),
-  [197] = {.entry = {.count = 1, .reusable = true}}, SHIFT(49),
-  [199] = {.entry = {.count = 1, .reusable = true}}, SHIFT(248),
-  [201] = {.entry = {.count = 1, .reusable = true}}, SHIFT(144),
-  [203] = {.entry = {.count = 1, .reusable = false}}, SHIFT(17),
-  [205] = {.entry = {.count = 1, .reusable = true}}, SHIFT(94),
-  [207] = {.entry = {.count = 1, .reusable = true}}, SHIFT(134),
-  [209] = {.entry = {.count = 1, .reusable = true}}, SHIFT(95),
-  [211] = {.entry = {.count = 1, .reusable = true}}, SHIFT(96),
-  [213] = {.entry = {.count = 1, .reusable = true}}, SHIFT(237),
-  [215] = {.entry = {.count = 1, .reusable = true}}, SHIFT(158),
-  [217] = {.entry = {.count = 1, .reusable = true}}, SHIFT(207),
-  [219] = {.entry = {.count = 1, .reusable = false}}, SHIFT(207),
-  [221] = {.entry = {.count = 1, .reusable = true}}, SHIFT(17),
-  [223] = {.entry = {.count = 1, .reusable = true}}, SHIFT(246),
-  [225] = {.entry = {.count = 1, .reusable = false}}, SHIFT(33),
-  [227] = {.entry = {.count = 1, .reusable = true}}, SHIFT(100),
-  [229] = {.entry = {.count = 1, .reusable = true}}, SHIFT(101),
-  [231] = {.entry = {.count = 1, .reusable = true}}, SHIFT(153),
-  [233] = {.entry = {.count = 1, .reusable = true}}, SHIFT(102),
-  [235] = {.entry = {.count = 1, .reusable = true}}, SHIFT(238),
-  [237] = {.entry = {.count = 1, .reusable = true}}, SHIFT(164),
-  [239] = {.entry = {.count = 1, .reusable = true}}, SHIFT(208),
-  [241] = {.entry = {.count = 1, .reusable = false}}, SHIFT(208),
-  [243] = {.entry = {.count = 1, .reusable = true}}, SHIFT(33),
-  [245] = {.entry = {.count = 1, .reusable = true}}, SHIFT(249),
-  [247] = {.entry = {.count = 1, .reusable = true}}, SHIFT(167),
-  [249] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(33),
-  [252] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(100),
-  [255] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(101),
-  [258] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0),
-  [260] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(102),
-  [263] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(238),
-  [266] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(164),
-  [269] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(208),
-  [272] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(208),
-  [275] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(33),
-  [278] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(249),
-  [281] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(5),
-  [284] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(85),
-  [287] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(86),
-  [290] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(87),
-  [293] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(242),
-  [296] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(145),
-  [299] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(184),
-  [302] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(184),
-  [305] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(5),
-  [308] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(247),
-  [311] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(49),
-  [314] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(106),
-  [317] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(107),
-  [320] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(108),
-  [323] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(239),
-  [326] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(168),
-  [329] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(212),
-  [332] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(212),
-  [335] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(49),
-  [338] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(248),
-  [341] = {.entry = {.count = 1, .reusable = true}}, SHIFT(141),
-  [343] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(17),
-  [346] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(94),
-  [349] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(95),
-  [352] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(96),
-  [355] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(237),
-  [358] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(158),
-  [361] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(207),
-  [364] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(207),
-  [367] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(17),
-  [370] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 2, 0, 0), SHIFT_REPEAT(246),
-  [373] = {.entry = {.count = 1, .reusable = true}}, SHIFT(142),
-  [375] = {.entry = {.count = 1, .reusable = true}}, SHIFT(135),
-  [377] = {.entry = {.count = 1, .reusable = true}}, SHIFT(136),
-  [379] = {.entry = {.count = 1, .reusable = true}}, SHIFT(137),
-  [381] = {.entry = {.count = 1, .reusable = true}}, SHIFT(154),
-  [383] = {.entry = {.count = 1, .reusable = true}}, SHIFT(155),
-  [385] = {.entry = {.count = 1, .reusable = true}}, SHIFT(143),
-  [387] = {.entry = {.count = 1, .reusable = true}}, SHIFT(159),
-  [389] = {.entry = {.count = 1, .reusable = true}}, SHIFT(162),
-  [391] = {.entry = {.count = 1, .reusable = true}}, SHIFT(163),
-  [393] = {.entry = {.count = 1, .reusable = true}}, SHIFT(140),
-  [395] = {.entry = {.count = 1, .reusable = true}}, SHIFT(138),
-  [397] = {.entry = {.count = 1, .reusable = true}}, SHIFT(139),
-  [399] = {.entry = {.count = 1, .reusable = true}}, SHIFT(151),
-  [401] = {.entry = {.count = 1, .reusable = true}}, SHIFT(176),
-  [403] = {.entry = {.count = 1, .reusable = true}}, SHIFT(160),
-  [405] = {.entry = {.count = 1, .reusable = true}}, SHIFT(165),
-  [407] = {.entry = {.count = 1, .reusable = true}}, SHIFT(169),
-  [409] = {.entry = {.count = 1, .reusable = true}}, SHIFT(223),
-  [411] = {.entry = {.count = 1, .reusable = true}}, SHIFT(72),
-  [413] = {.entry = {.count = 1, .reusable = true}}, SHIFT(116),
-  [415] = {.entry = {.count = 1, .reusable = true}}, SHIFT(225),
-  [417] = {.entry = {.count = 1, .reusable = false}}, SHIFT(225),
-  [419] = {.entry = {.count = 1, .reusable = true}}, SHIFT(229),
-  [421] = {.entry = {.count = 1, .reusable = false}}, SHIFT(229),
-  [423] = {.entry = {.count = 1, .reusable = false}}, SHIFT(230),
-  [425] = {.entry = {.count = 1, .reusable = true}}, SHIFT(230),
-  [427] = {.entry = {.count = 1, .reusable = true}}, SHIFT(231),
-  [429] = {.entry = {.count = 1, .reusable = true}}, SHIFT(232),
-  [431] = {.entry = {.count = 1, .reusable = true}}, SHIFT(233),
-  [433] = {.entry = {.count = 1, .reusable = false}}, SHIFT(234),
-  [435] = {.entry = {.count = 1, .reusable = true}}, SHIFT(235),
-  [437] = {.entry = {.count = 1, .reusable = true}}, SHIFT(7),
-  [439] = {.entry = {.count = 1, .reusable = true}}, SHIFT(23),
-  [441] = {.entry = {.count = 1, .reusable = true}}, SHIFT(39),
-  [443] = {.entry = {.count = 1, .reusable = true}}, SHIFT(55),
-  [445] = {.entry = {.count = 1, .reusable = true}}, SHIFT(111),
-  [447] = {.entry = {.count = 1, .reusable = false}}, SHIFT(67),
-  [449] = {.entry = {.count = 1, .reusable = true}}, SHIFT(241),
-  [451] = {.entry = {.count = 1, .reusable = true}}, SHIFT(174),
-  [453] = {.entry = {.count = 1, .reusable = true}}, SHIFT(186),
-  [455] = {.entry = {.count = 1, .reusable = false}}, SHIFT(186),
-  [457] = {.entry = {.count = 1, .reusable = true}}, SHIFT(67),
-  [459] = {.entry = {.count = 1, .reusable = true}}, SHIFT(245),
-  [461] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_struct, 2, 0, 0),
-  [463] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_struct, 2, 0, 0),
-  [465] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_globals, 2, 0, 0),
-  [467] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_globals, 2, 0, 0),
-  [469] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop, 2, 0, 0),
-  [471] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop, 2, 0, 0),
-  [473] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_globals, 3, 0, 0),
-  [475] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_globals, 3, 0, 0),
-  [477] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_loop, 3, 0, 0),
-  [479] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_loop, 3, 0, 0),
-  [481] = {.entry = {.count = 1, .reusable = false}}, REDUCE(sym_struct, 3, 0, 0),
-  [483] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_struct, 3, 0, 0),
-  [485] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(67),
-  [488] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(241),
-  [491] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(174),
-  [494] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0),
-  [496] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(186),
-  [499] = {.entry = {.count = 2, .reusable = false}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(186),
-  [502] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(67),
-  [505] = {.entry = {.count = 2, .reusable = true}}, REDUCE(aux_sym_expr_repeat1, 2, 0, 0), SHIFT_REPEAT(245),
-  [508] = {.entry = {.count = 1, .reusable = true}}, REDUCE(aux_sym_program_repeat1, 1, 0, 0),
-  [510] = {.entry = {.count = 1, .reusable = false}}, REDUCE(aux_sym_program_repeat1, 1, 0, 0),
-  [512] = {.entry = {.count = 1, .reusable = false}}, SHIFT(114),
-  [514] = {.entry = {.count = 1, .reusable = true}}, SHIFT(240),
-  [516] = {.entry = {.count = 1, .reusable = true}}, SHIFT(132),
-  [518] = {.entry = {.count = 1, .reusable = true}}, SHIFT(214),
-  [520] = {.entry = {.count = 1, .reusable = false}}, SHIFT(214),
-  [522] = {.entry = {.count = 1, .reusable = true}}, SHIFT(114),
-  [524] = {.entry = {.count = 1, .reusable = true}}, SHIFT(243),
-  [526] = {.entry = {.count = 1, .reusable = true}}, SHIFT(251),
-  [528] = {.entry = {.count = 1, .reusable = true}}, SHIFT(115),
-  [530] = {.entry = {.count = 1, .reusable = true}}, SHIFT(256),
-  [532] = {.entry = {.count = 1, .reusable = true}}, SHIFT(259),
-  [534] = {.entry = {.count = 1, .reusable = true}}, SHIFT(255),
-  [536] = {.entry = {.count = 1, .reusable = true}}, SHIFT(68),
-  [538] = {.entry = {.count = 1, .reusable = true}}, SHIFT(253),
-  [540] = {.entry = {.count = 1, .reusable = true}}, SHIFT(19),
-  [542] = {.entry = {.count = 1, .reusable = true}}, SHIFT(254),
-  [544] = {.entry = {.count = 1, .reusable = true}}, SHIFT(3),
-  [546] = {.entry = {.count = 1, .reusable = true}}, SHIFT(258),
-  [548] = {.entry = {.count = 1, .reusable = true}}, SHIFT(51),
-  [550] = {.entry = {.count = 1, .reusable = true}}, SHIFT(252),
-  [552] = {.entry = {.count = 1, .reusable = true}}, SHIFT(35),
-  [554] = {.entry = {.count = 1, .reusable = true}},  ACCEPT_INPUT(),
-  [556] = {.entry = {.count = 1, .reusable = true}}, SHIFT(118),
-  [558] = {.entry = {.count = 1, .reusable = true}}, SHIFT(38),
-  [560] = {.entry = {.count = 1, .reusable = true}}, SHIFT(22),
-  [562] = {.entry = {.count = 1, .reusable = true}}, SHIFT(6),
-  [564] = {.entry = {.count = 1, .reusable = true}}, SHIFT(71),
-  [566] = {.entry = {.count = 1, .reusable = true}}, SHIFT(261),
-  [568] = {.entry = {.count = 1, .reusable = false}}, SHIFT(257),
-  [570] = {.entry = {.count = 1, .reusable = false}}, SHIFT(260),
-  [572] = {.entry = {.count = 1, .reusable = true}}, SHIFT(54),
-  [574] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 2, 0, 1),
-  [576] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 2, 0, 2),
-  [578] = {.entry = {.count = 1, .reusable = true}}, REDUCE(sym_comment, 3, 0, 3),
-};
-
-enum ts_external_scanner_symbol_identifiers {
-  ts_external_token__block_comment_start = 0,
-  ts_external_token__block_comment_content = 1,
-  ts_external_token__block_comment_end = 2,
-  ts_external_token__string_start = 3,
-  ts_external_token__string_content = 4,
-  ts_external_token__string_end = 5,
-};
-
-static const TSSymbol ts_external_scanner_symbol_map[EXTERNAL_TOKEN_COUNT] = {
-  [ts_external_token__block_comment_start] = sym__block_comment_start,
-  [ts_external_token__block_comment_content] = sym__block_comment_content,
-  [ts_external_token__block_comment_end] = sym__block_comment_end,
-  [ts_external_token__string_start] = sym__string_start,
-  [ts_external_token__string_content] = sym__string_content,
-  [ts_external_token__string_end] = sym__string_end,
-};
-
-static const bool ts_external_scanner_states[8][EXTERNAL_TOKEN_COUNT] = {
-  [1] = {
-    [ts_external_token__block_comment_start] = true,
-    [ts_external_token__block_comment_content] = true,
-    [ts_external_token__block_comment_end] = true,
-    [ts_external_token__string_start] = true,
-    [ts_external_token__string_content] = true,
-    [ts_external_token__string_end] = true,
-  },
-  [2] = {
-    [ts_external_token__block_comment_start] = true,
-    [ts_external_token__string_start] = true,
-  },
-  [3] = {
-    [ts_external_token__block_comment_start] = true,
-  },
-  [4] = {
-    [ts_external_token__block_comment_start] = true,
-    [ts_external_token__string_content] = true,
-    [ts_external_token__string_end] = true,
-  },
-  [5] = {
-    [ts_external_token__block_comment_start] = true,
-    [ts_external_token__block_comment_content] = true,
-    [ts_external_token__block_comment_end] = true,
-  },
-  [6] = {
-    [ts_external_token__block_comment_start] = true,
-    [ts_external_token__string_end] = true,
-  },
-  [7] = {
-    [ts_external_token__block_comment_start] = true,
-    [ts_external_token__block_comment_end] = true,
-  },
-};
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-void *tree_sitter_vjass_external_scanner_create(void);
-void tree_sitter_vjass_external_scanner_destroy(void *);
-bool tree_sitter_vjass_external_scanner_scan(void *, TSLexer *, const bool *);
-unsigned tree_sitter_vjass_external_scanner_serialize(void *, char *);
-void tree_sitter_vjass_external_scanner_deserialize(void *, const char *, unsigned);
-
-#ifdef TREE_SITTER_HIDE_SYMBOLS
-#define TS_PUBLIC
-#elif defined(_WIN32)
-#define TS_PUBLIC __declspec(dllexport)
-#else
-#define TS_PUBLIC __attribute__((visibility("default")))
-#endif
-
-TS_PUBLIC const TSLanguage *tree_sitter_vjass(void) {
-  static const TSLanguage language = {
-    .abi_version = LANGUAGE_VERSION,
-    .symbol_count = SYMBOL_COUNT,
-    .alias_count = ALIAS_COUNT,
-    .token_count = TOKEN_COUNT,
-    .external_token_count = EXTERNAL_TOKEN_COUNT,
-    .state_count = STATE_COUNT,
-    .large_state_count = LARGE_STATE_COUNT,
-    .production_id_count = PRODUCTION_ID_COUNT,
-    .supertype_count = SUPERTYPE_COUNT,
-    .field_count = FIELD_COUNT,
-    .max_alias_sequence_length = MAX_ALIAS_SEQUENCE_LENGTH,
-    .parse_table = &ts_parse_table[0][0],
-    .small_parse_table = ts_small_parse_table,
-    .small_parse_table_map = ts_small_parse_table_map,
-    .parse_actions = ts_parse_actions,
-    .symbol_names = ts_symbol_names,
-    .field_names = ts_field_names,
-    .field_map_slices = ts_field_map_slices,
-    .field_map_entries = ts_field_map_entries,
-    .symbol_metadata = ts_symbol_metadata,
-    .public_symbol_map = ts_symbol_map,
-    .alias_map = ts_non_terminal_alias_map,
-    .alias_sequences = &ts_alias_sequences[0][0],
-    .lex_modes = (const void*)ts_lex_modes,
-    .lex_fn = ts_lex,
-    .external_scanner = {
-      &ts_external_scanner_states[0][0],
-      ts_external_scanner_symbol_map,
-      tree_sitter_vjass_external_scanner_create,
-      tree_sitter_vjass_external_scanner_destroy,
-      tree_sitter_vjass_external_scanner_scan,
-      tree_sitter_vjass_external_scanner_serialize,
-      tree_sitter_vjass_external_scanner_deserialize,
-    },
-    .primary_state_ids = ts_primary_state_ids,
-    .name = "vjass",
-    .max_reserved_word_set_size = 0,
-    .metadata = {
-      .major_version = 0,
-      .minor_version = 1,
-      .patch_version = 0,
-    },
-  };
-  return &language;
-}
-#ifdef __cplusplus
-}
-#endif
@@ -1,6 +1,8 @@
+#include <tree_sitter/alloc.h>
 #include <tree_sitter/parser.h>
 #include <wctype.h>
 #include <stdio.h>
+#include <string.h>
 
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
@@ -12,6 +14,10 @@ enum TokenType {
   STRING_START,
   STRING_CONTENT,
   STRING_END,
+
+#ifdef TREE_SITTER_VJASS_OUTLINE
+  FUNCTION_BODY,
+#endif
 };
 
 static inline void consume(TSLexer *lexer) { lexer->advance(lexer, false); }
@@ -26,8 +32,8 @@ static inline bool consume_char(char c, TSLexer *lexer) {
   return true;
 }
 
-static inline uint8_t consume_and_count_char(char c, TSLexer *lexer) {
-  uint8_t count = 0;
+static inline uint32_t consume_and_count_char(char c, TSLexer *lexer) {
+  uint32_t count = 0;
   while (lexer->lookahead == c) {
     ++count;
     consume(lexer);
@@ -35,42 +41,79 @@ static inline uint8_t consume_and_count_char(char c, TSLexer *lexer) {
   return count;
 }
 
+#ifdef TREE_SITTER_VJASS_LIBC_WHITESPACE
+static inline bool is_whitespace(int32_t c) { return iswspace(c); }
+#else
+// ASCII whitespace as iswspace() classifies it in every locale: \t \n \v \f
+// \r and space. Anything outside ASCII still goes through iswspace().
+static const bool ascii_whitespace[128] = {
+  ['\t'] = true, ['\n'] = true, ['\v'] = true, ['\f'] = true, ['\r'] = true, [' '] = true,
+};
+
+static inline bool is_whitespace(int32_t c) {
+  if ((uint32_t)c < 128) {
+    return ascii_whitespace[c];
+  }
+
+  return c > 0 && iswspace(c);
+}
+#endif
+
 static inline void skip_whitespaces(TSLexer *lexer) {
-  while (iswspace(lexer->lookahead)) {
+  while (is_whitespace(lexer->lookahead)) {
     skip(lexer);
   }
 }
 
-void *tree_sitter_vjass_external_scanner_create() { return NULL; }
-void tree_sitter_vjass_external_scanner_destroy(void *payload) {}
+typedef struct {
+  char ending_char;
+  bool c_comment; // inside a JASS `/* */` comment
+  uint32_t level_count;
+} Scanner;
 
-char ending_char = 0;
-uint8_t level_count = 0;
+static inline void reset_state(Scanner *scanner) {
+  scanner->ending_char = 0;
+  scanner->level_count = 0;
+  scanner->c_comment = false;
+}
 
-static inline void reset_state() {
-  ending_char = 0;
-  level_count = 0;
+void *tree_sitter_vjass_external_scanner_create() {
+  Scanner *scanner = ts_malloc(sizeof(Scanner));
+  reset_state(scanner);
+  return scanner;
 }
 
+void tree_sitter_vjass_external_scanner_destroy(void *payload) { ts_free(payload); }
+
+// Outside strings and block comments the state is all zero and serializes
+// to nothing, which is what every token after the closing one carries.
 unsigned tree_sitter_vjass_external_scanner_serialize(void *payload, char *buffer) {
-  buffer[0] = ending_char;
-  buffer[1] = level_count;
-  return 2;
+  Scanner *scanner = (Scanner *)payload;
+  if (scanner->ending_char == 0 && !scanner->c_comment && scanner->level_count == 0) {
+    return 0;
+  }
+
+  buffer[0] = scanner->ending_char;
+  buffer[1] = scanner->c_comment;
+  memcpy(&buffer[2], &scanner->level_count, sizeof(scanner->level_count));
+  return 2 + sizeof(scanner->level_count);
 }
 
 void tree_sitter_vjass_external_scanner_deserialize(void *payload, const char *buffer, unsigned length) {
-  if (length == 0) return;
-  ending_char = buffer[0];
-  if (length == 1) return;
-  level_count = buffer[1];
+  Scanner *scanner = (Scanner *)payload;
+  reset_state(scanner);
+  if (length < 2 + sizeof(scanner->level_count)) return;
+  scanner->ending_char = buffer[0];
+  scanner->c_comment = buffer[1];
+  memcpy(&scanner->level_count, &buffer[2], sizeof(scanner->level_count));
 }
 
-static bool scan_block_start(TSLexer *lexer) {
+static bool scan_block_start(Scanner *scanner, TSLexer *lexer) {
   if (consume_char('[', lexer)) {
-    uint8_t level = consume_and_count_char('=', lexer);
+    uint32_t level = consume_and_count_char('=', lexer);
 
     if (consume_char('[', lexer)) {
-      level_count = level;
+      scanner->level_count = level;
       return true;
     }
   }
@@ -78,11 +121,11 @@ static bool scan_block_start(TSLexer *lexer) {
   return false;
 }
 
-static bool scan_block_end(TSLexer *lexer) {
+static bool scan_block_end(Scanner *scanner, TSLexer *lexer) {
   if (consume_char(']', lexer)) {
-    uint8_t level = consume_and_count_char('=', lexer);
+    uint32_t level = consume_and_count_char('=', lexer);
 
-    if (level_count == level && consume_char(']', lexer)) {
+    if (scanner->level_count == level && consume_char(']', lexer)) {
       return true;
     }
   }
@@ -90,12 +133,12 @@ static bool scan_block_end(TSLexer *lexer) {
   return false;
 }
 
-static bool scan_block_content(TSLexer *lexer) {
+static bool scan_block_content(Scanner *scanner, TSLexer *lexer) {
   while (lexer->lookahead != 0) {
     if (lexer->lookahead == ']') {
       lexer->mark_end(lexer);
 
-      if (scan_block_end(lexer)) {
+      if (scan_block_end(scanner, lexer)) {
         return true;
       }
     } else {
@@ -106,11 +149,52 @@ static bool scan_block_content(TSLexer *lexer) {
   return false;
 }
 
-static bool scan_comment_start(TSLexer *lexer) {
+// `/* */` comments are returned as one content token per line, so an edit
+// inside a large commented-out region only re-lexes the line it touches
+// and the following lines are reused from the old tree.
+static bool scan_c_comment_content(TSLexer *lexer) {
+  for (;;) {
+    // Fast path: everything up to the next '*' or line break is content.
+    while (lexer->lookahead != '*' && lexer->lookahead != '\n') {
+      if (lexer->lookahead == 0 && lexer->eof(lexer)) {
+        return false;
+      }
+      consume(lexer);
+    }
+
+    if (lexer->lookahead == '\n') {
+      consume(lexer);
+      lexer->mark_end(lexer);
+      return true;
+    }
+
+    lexer->mark_end(lexer);
+    consume(lexer);
+    if (lexer->lookahead == '/') {
+      return true;
+    }
+  }
+}
+
+static bool scan_c_comment_end(TSLexer *lexer) {
+  return consume_char('*', lexer) && consume_char('/', lexer);
+}
+
+static bool scan_comment_start(Scanner *scanner, TSLexer *lexer) {
+  if (lexer->lookahead == '/') {
+    consume(lexer);
+    if (consume_char('*', lexer)) {
+      scanner->c_comment = true;
+      lexer->result_symbol = BLOCK_COMMENT_START;
+      return true;
+    }
+    return false;
+  }
+
   if (consume_char('-', lexer) && consume_char('-', lexer)) {
     lexer->mark_end(lexer);
 
-    if (scan_block_start(lexer)) {
+    if (scan_block_start(scanner, lexer)) {
       lexer->mark_end(lexer);
       lexer->result_symbol = BLOCK_COMMENT_START;
       return true;
@@ -120,9 +204,18 @@ static bool scan_comment_start(TSLexer *lexer) {
   return false;
 }
 
-static bool scan_comment_content(TSLexer *lexer) {
-  if (ending_char == 0) { // block comment
-    if (scan_block_content(lexer)) {
+static bool scan_comment_content(Scanner *scanner, TSLexer *lexer) {
+  if (scanner->c_comment) {
+    if (scan_c_comment_content(lexer)) {
+      lexer->result_symbol = BLOCK_COMMENT_CONTENT;
+      return true;
+    }
+
+    return false;
+  }
+
+  if (scanner->ending_char == 0) { // block comment
+    if (scan_block_content(scanner, lexer)) {
       lexer->result_symbol = BLOCK_COMMENT_CONTENT;
       return true;
     }
@@ -131,8 +224,8 @@ static bool scan_comment_content(TSLexer *lexer) {
   }
 
   while (lexer->lookahead != 0) {
-    if (lexer->lookahead == ending_char) {
-      reset_state();
+    if (lexer->lookahead == scanner->ending_char) {
+      reset_state(scanner);
       lexer->result_symbol = BLOCK_COMMENT_CONTENT;
       return true;
     }
@@ -143,40 +236,65 @@ static bool scan_comment_content(TSLexer *lexer) {
   return false;
 }
 
-static bool scan_string_start(TSLexer *lexer) {
-  if (lexer->lookahead == '"' || lexer->lookahead == '\'') {
-    ending_char = lexer->lookahead;
+// Called just past an opening `'`. Rawcodes ('A000', 'hfoo', 'a') are one
+// token of the main lexer; everything else single-quoted is a string.
+static bool is_rawcode(TSLexer *lexer) {
+  for (int length = 0; length <= 4; length++) {
+    if (lexer->lookahead == '\'') {
+      return length == 1 || length == 4;
+    }
+    if (lexer->lookahead == '\\' || lexer->lookahead == '\n' || lexer->lookahead == '\r' || lexer->eof(lexer)) {
+      return false;
+    }
+    consume(lexer);
+  }
+  return false;
+}
+
+static bool scan_string_start(Scanner *scanner, TSLexer *lexer) {
+  if (lexer->lookahead == '"') {
+    scanner->ending_char = '"';
+    consume(lexer);
+    return true;
+  }
+
+  if (lexer->lookahead == '\'') {
     consume(lexer);
+    lexer->mark_end(lexer);
+    if (is_rawcode(lexer)) {
+      return false;
+    }
+    scanner->ending_char = '\'';
     return true;
   }
 
-  if (scan_block_start(lexer)) {
+  if (scan_block_start(scanner, lexer)) {
     return true;
   }
 
   return false;
 }
 
-static bool scan_string_end(TSLexer *lexer) {
-  if (ending_char == 0) { // block string
-    return scan_block_end(lexer);
+static bool scan_string_end(Scanner *scanner, TSLexer *lexer) {
+  if (scanner->ending_char == 0) { // block string
+    return scan_block_end(scanner, lexer);
   }
 
-  if (consume_char(ending_char, lexer)) {
+  if (consume_char(scanner->ending_char, lexer)) {
     return true;
   }
 
   return false;
 }
 
-static bool scan_string_content(TSLexer *lexer) {
-  if (ending_char == 0) { // block string
-    return scan_block_content(lexer);
+static bool scan_string_content(Scanner *scanner, TSLexer *lexer) {
+  if (scanner->ending_char == 0) { // block string
+    return scan_block_content(scanner, lexer);
   }
 
-  while (lexer->lookahead != '\n' && lexer->lookahead != 0 && lexer->lookahead != ending_char) {
+  while (lexer->lookahead != '\n' && lexer->lookahead != 0 && lexer->lookahead != scanner->ending_char) {
     if (consume_char('\\', lexer) && consume_char('z', lexer)) {
-      while (iswspace(lexer->lookahead)) {
+      while (is_whitespace(lexer->lookahead)) {
         consume(lexer);
       }
       continue;
@@ -192,37 +310,135 @@ static bool scan_string_content(TSLexer *lexer) {
   return true;
 }
 
+#ifdef TREE_SITTER_VJASS_OUTLINE
+static inline bool is_word_char(int32_t c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static void skip_quoted(TSLexer *lexer) {
+  int32_t quote = lexer->lookahead;
+  consume(lexer);
+  while (lexer->lookahead != quote && lexer->lookahead != '\n' && !lexer->eof(lexer)) {
+    if (lexer->lookahead == '\\') {
+      consume(lexer);
+      if (lexer->eof(lexer)) return;
+    }
+    consume(lexer);
+  }
+  consume_char(quote, lexer);
+}
+
+// The outline language skips everything up to the `endfunction` that closes
+// the function as one token, stepping over strings, `[[ ]]` block strings,
+// rawcodes and comments so an `endfunction` inside them does not end it.
+// The token stops after the last non-blank character; an empty body has
+// none.
+static bool scan_function_body(TSLexer *lexer) {
+  static const char keyword[] = "endfunction";
+  const unsigned keyword_length = sizeof(keyword) - 1;
+  bool has_content = false;
+
+  while (!lexer->eof(lexer)) {
+    int32_t c = lexer->lookahead;
+    if (is_whitespace(c)) {
+      consume(lexer);
+      continue;
+    }
+
+    if (is_word_char(c)) {
+      unsigned length = 0;
+      bool matches = true;
+      while (is_word_char(lexer->lookahead)) {
+        matches = matches && length < keyword_length && lexer->lookahead == keyword[length];
+        length++;
+        consume(lexer);
+      }
+      if (matches && length == keyword_length) {
+        return has_content;
+      }
+    } else if (c == '"' || c == '\'') {
+      skip_quoted(lexer);
+    } else if (c == '/') {
+      consume(lexer);
+      if (consume_char('/', lexer)) {
+        while (lexer->lookahead != '\n' && !lexer->eof(lexer)) consume(lexer);
+      } else if (consume_char('*', lexer)) {
+        while (!lexer->eof(lexer) && !(consume_char('*', lexer) && consume_char('/', lexer))) {
+          if (lexer->lookahead != '*') consume(lexer);
+        }
+      }
+    } else if (c == '-') {
+      consume(lexer);
+      Scanner block = {0, false, 0};
+      if (consume_char('-', lexer) && scan_block_start(&block, lexer)) {
+        scan_block_content(&block, lexer);
+      }
+    } else if (c == '[') {
+      Scanner block = {0, false, 0};
+      if (scan_block_start(&block, lexer)) {
+        scan_block_content(&block, lexer);
+      }
+    } else {
+      consume(lexer);
+    }
+
+    lexer->mark_end(lexer);
+    has_content = true;
+  }
+
+  return has_content;
+}
+#endif
+
 bool tree_sitter_vjass_external_scanner_scan(void *payload, TSLexer *lexer, const bool *valid_symbols) {
-  if (valid_symbols[STRING_END] && scan_string_end(lexer)) {
-    reset_state();
+  Scanner *scanner = (Scanner *)payload;
+
+  if (valid_symbols[STRING_END] && scan_string_end(scanner, lexer)) {
+    reset_state(scanner);
     lexer->result_symbol = STRING_END;
     return true;
   }
 
-  if (valid_symbols[STRING_CONTENT] && scan_string_content(lexer)) {
+  if (valid_symbols[STRING_CONTENT] && scan_string_content(scanner, lexer)) {
     lexer->result_symbol = STRING_CONTENT;
     return true;
   }
 
-  if (valid_symbols[BLOCK_COMMENT_END] && ending_char == 0 && scan_block_end(lexer)) {
-    reset_state();
+  if (valid_symbols[BLOCK_COMMENT_END] && scanner->c_comment && scan_c_comment_end(lexer)) {
+    reset_state(scanner);
     lexer->result_symbol = BLOCK_COMMENT_END;
     return true;
   }
 
-  if (valid_symbols[BLOCK_COMMENT_CONTENT] && scan_comment_content(lexer)) {
+  if (valid_symbols[BLOCK_COMMENT_END] && !scanner->c_comment && scanner->ending_char == 0 &&
+      scan_block_end(scanner, lexer)) {
+    reset_state(scanner);
+    lexer->result_symbol = BLOCK_COMMENT_END;
+    return true;
+  }
+
+  if (valid_symbols[BLOCK_COMMENT_CONTENT] && scan_comment_content(scanner, lexer)) {
     return true;
   }
 
   skip_whitespaces(lexer);
 
-  if (valid_symbols[STRING_START] && scan_string_start(lexer)) {
+#ifdef TREE_SITTER_VJASS_OUTLINE
+  // STRING_END is never valid where a body can start; both are valid only
+  // during error recovery, which should not swallow the rest of a function.
+  if (valid_symbols[FUNCTION_BODY] && !valid_symbols[STRING_END] && scan_function_body(lexer)) {
+    lexer->result_symbol = FUNCTION_BODY;
+    return true;
+  }
+#endif
+
+  if (valid_symbols[STRING_START] && scan_string_start(scanner, lexer)) {
     lexer->result_symbol = STRING_START;
     return true;
   }
 
   if (valid_symbols[BLOCK_COMMENT_START]) {
-    if (scan_comment_start(lexer)) {
+    if (scan_comment_start(scanner, lexer)) {
       return true;
     }
   }
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Runs test/outline/corpus against the outline language in src/outline.
+# `tree-sitter test` takes the parser from ./src and the corpus from
+# ./test/corpus, so it runs in a scratch directory laid out that way.
+#
+#   test/outline.sh [tree-sitter test options]
+
+set -e
+
+TS=${TS:-tree-sitter}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+DIR=$(mktemp -d)
+trap 'rm -rf "$DIR"' EXIT
+
+mkdir "$DIR/test"
+ln -s "$ROOT/src/outline" "$DIR/src"
+ln -s "$ROOT/test/outline/corpus" "$DIR/test/corpus"
+sed 's/"name": "vjass"/"name": "vjass_outline"/; s/"camelcase": "VJASS"/"camelcase": "VJASSOutline"/' \
+  "$ROOT/tree-sitter.json" > "$DIR/tree-sitter.json"
+
+cd "$DIR"
+"$TS" test "$@"